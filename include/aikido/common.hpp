@@ -1,9 +1,12 @@
+#include "aikido/common/BoundedLeastSquares.hpp"
 #include "aikido/common/ExecutorMultiplexer.hpp"
 #include "aikido/common/ExecutorThread.hpp"
+#include "aikido/common/FixedSizePool.hpp"
 #include "aikido/common/PseudoInverse.hpp"
 #include "aikido/common/RNG.hpp"
 #include "aikido/common/Spline.hpp"
 #include "aikido/common/StepSequence.hpp"
+#include "aikido/common/ThreadPool.hpp"
 #include "aikido/common/VanDerCorput.hpp"
 #include "aikido/common/metaprogramming.hpp"
 #include "aikido/common/stream.hpp"
@@ -0,0 +1,99 @@
+#ifndef AIKIDO_COMMON_BOUNDEDLEASTSQUARES_HPP_
+#define AIKIDO_COMMON_BOUNDEDLEASTSQUARES_HPP_
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace aikido {
+namespace common {
+
+/// Active-set solver for small box-constrained least-squares problems
+///
+///   minimize   1/2 |A x - b|^2 + 1/2 r^2 |x - x_ref|^2
+///   subject to lower <= x <= upper
+///
+/// The regularization term r makes the minimizer unique. For a small r it
+/// selects, among the minimizers of |A x - b|, the one closest to x_ref.
+///
+/// The solver keeps its storage between calls, so solving problems of the same
+/// size repeatedly does not allocate. Because the minimizer is unique, the
+/// starting point only affects the number of iterations; passing the previous
+/// solution warm-starts the solver.
+class BoundedLeastSquares
+{
+public:
+  /// Constructor.
+  ///
+  /// \param regularization Weight r of the regularization term; must be
+  /// positive.
+  explicit BoundedLeastSquares(double regularization = 1e-4);
+
+  /// Solves the problem.
+  ///
+  /// \param[in] mat Matrix A.
+  /// \param[in] rhs Vector b.
+  /// \param[in] lower Lower bounds on x.
+  /// \param[in] upper Upper bounds on x.
+  /// \param[in] reference Reference point x_ref of the regularization term.
+  /// \param[in,out] x On input, the starting point, which is clamped to the
+  /// bounds; ignored if it has the wrong size or is not finite. On output, the
+  /// solution.
+  /// \return Whether the solver converged; if not, \c x is feasible but not
+  /// optimal.
+  /// \throw std::invalid_argument if the sizes are inconsistent or a lower
+  /// bound exceeds its upper bound.
+  bool solve(
+      const Eigen::Ref<const Eigen::MatrixXd>& mat,
+      const Eigen::Ref<const Eigen::VectorXd>& rhs,
+      const Eigen::VectorXd& lower,
+      const Eigen::VectorXd& upper,
+      const Eigen::VectorXd& reference,
+      Eigen::VectorXd& x);
+
+  /// Returns the number of iterations taken by the last call to \c solve.
+  int getNumIterations() const;
+
+private:
+  /// Whether a variable is free or held at one of its bounds.
+  enum class BoundState
+  {
+    Free,
+    AtLower,
+    AtUpper
+  };
+
+  /// Regularization weight.
+  double mRegularization;
+
+  /// Number of iterations taken by the last call to solve.
+  int mNumIterations;
+
+  /// Hessian A^T A + r^2 I of the objective.
+  Eigen::MatrixXd mHessian;
+
+  /// Linear term A^T b + r^2 x_ref of the objective.
+  Eigen::VectorXd mLinear;
+
+  /// Gradient of the objective at the current iterate.
+  Eigen::VectorXd mGradient;
+
+  /// Hessian restricted to the free variables.
+  Eigen::MatrixXd mReducedHessian;
+  Eigen::LDLT<Eigen::MatrixXd> mReducedSolver;
+
+  /// Newton step on the free variables.
+  Eigen::VectorXd mStep;
+
+  /// Fraction of the Newton step each free variable can take before it
+  /// reaches a bound.
+  Eigen::VectorXd mStepRatios;
+
+  /// Bound state of each variable.
+  std::vector<BoundState> mBoundStates;
+};
+
+} // namespace common
+} // namespace aikido
+
+#endif // AIKIDO_COMMON_BOUNDEDLEASTSQUARES_HPP_
@@ -0,0 +1,104 @@
+#ifndef AIKIDO_COMMON_FIXEDSIZEPOOL_HPP_
+#define AIKIDO_COMMON_FIXEDSIZEPOOL_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aikido {
+namespace common {
+
+/// Thread-safe slab allocator that hands out fixed-size, cache-line-aligned
+/// blocks of memory. Blocks are carved out of geometrically growing slabs and
+/// recycled through an intrusive free list, so steady-state allocation and
+/// deallocation never touch the global heap. When the last outstanding block
+/// is returned, every slab but the first is released, so the pool does not
+/// hold on to the memory of a past burst of allocations. All slabs are
+/// released at once when the pool is destroyed or \c clear() is called.
+class FixedSizePool
+{
+public:
+  /// Alignment, in bytes, of every block returned by \c allocate().
+  static constexpr std::size_t ALIGNMENT = 64;
+
+  /// Constructs an empty pool. No memory is allocated until the first call to
+  /// \c allocate().
+  ///
+  /// \param blockSize minimum size, in bytes, of each block; rounded up to a
+  /// multiple of \c ALIGNMENT
+  /// \param initialBlocksPerSlab number of blocks in the first slab; each
+  /// subsequent slab doubles in size up to \c MAX_BLOCKS_PER_SLAB
+  explicit FixedSizePool(
+      std::size_t blockSize, std::size_t initialBlocksPerSlab = 16);
+
+  FixedSizePool(const FixedSizePool&) = delete;
+  FixedSizePool(FixedSizePool&&) = delete;
+  FixedSizePool& operator=(const FixedSizePool&) = delete;
+  FixedSizePool& operator=(FixedSizePool&&) = delete;
+
+  ~FixedSizePool() = default;
+
+  /// Returns an uninitialized block of \c getBlockSize() bytes.
+  ///
+  /// \return pointer to the block, aligned to \c ALIGNMENT
+  void* allocate();
+
+  /// Returns a block previously obtained from \c allocate() on this pool. It
+  /// is undefined behavior to access \c block after calling this function.
+  /// Returning the last outstanding block shrinks the pool to its first slab.
+  ///
+  /// \param block block to recycle; may be nullptr
+  void deallocate(void* block);
+
+  /// Releases every slab owned by the pool in bulk. All blocks previously
+  /// returned by \c allocate() are invalidated.
+  void clear();
+
+  /// Returns the size, in bytes, of each block.
+  std::size_t getBlockSize() const;
+
+  /// Returns the number of blocks currently handed out.
+  std::size_t getNumAllocatedBlocks() const;
+
+  /// Returns the number of slabs requested from the global heap since
+  /// construction or the last call to \c clear().
+  std::size_t getNumSlabs() const;
+
+private:
+  /// Upper bound on the number of blocks in a single slab.
+  static constexpr std::size_t MAX_BLOCKS_PER_SLAB = 4096;
+
+  /// Node of the intrusive free list, stored in the unused block itself.
+  struct FreeBlock
+  {
+    FreeBlock* mNext;
+  };
+
+  /// Allocates a new slab and threads its blocks onto the free list. Must be
+  /// called with \c mMutex held.
+  void grow();
+
+  /// Drops every slab but the first and rebuilds the free list from it. Must
+  /// be called with \c mMutex held and no blocks allocated.
+  void releaseExtraSlabs();
+
+  /// Threads the \c numBlocks blocks of \c slab onto the free list. Must be
+  /// called with \c mMutex held.
+  void pushSlab(char* slab, std::size_t numBlocks);
+
+  const std::size_t mBlockSize;
+  const std::size_t mInitialBlocksPerSlab;
+  std::size_t mNextBlocksPerSlab;
+
+  std::vector<std::unique_ptr<char[]>> mSlabs;
+  FreeBlock* mFreeList;
+  std::size_t mNumAllocatedBlocks;
+
+  mutable std::mutex mMutex;
+};
+
+} // namespace common
+} // namespace aikido
+
+#endif // AIKIDO_COMMON_FIXEDSIZEPOOL_HPP_
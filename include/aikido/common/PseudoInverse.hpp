@@ -13,7 +13,85 @@ namespace common {
 /// \return pseudo-inverse of \c mat
 Eigen::MatrixXd pseudoinverse(const Eigen::MatrixXd& mat, double eps = 1e-6);
 
+namespace detail {
+
+template <typename MatrixType, bool ThinSvd>
+struct LeastSquaresSvd;
+
+} // namespace detail
+
+/// Storage reused by \c solveLeastSquares and \c solveDampedLeastSquares.
+/// After the first call, reusing a workspace for matrices of the same size
+/// performs no heap allocation. \c Rows and \c Cols may be fixed, e.g. for
+/// 6 x N Jacobians, to keep the small factors on the stack.
+///
+/// The members are implementation details of the solvers.
+template <int Rows = Eigen::Dynamic, int Cols = Eigen::Dynamic>
+struct LeastSquaresWorkspace
+{
+  using Matrix = Eigen::Matrix<double, Rows, Cols>;
+
+  /// Singular value decomposition used by \c solveLeastSquares.
+  detail::LeastSquaresSvd<Matrix, Cols == Eigen::Dynamic> mSvd;
+
+  /// Normal equations of \c solveDampedLeastSquares for matrices with no
+  /// more rows than columns.
+  Eigen::Matrix<double, Rows, Rows> mRowNormalMatrix;
+  Eigen::LDLT<Eigen::Matrix<double, Rows, Rows>> mRowNormalSolver;
+  Eigen::Matrix<double, Rows, 1> mRowSolution;
+
+  /// Normal equations of \c solveDampedLeastSquares for matrices with more
+  /// rows than columns.
+  Eigen::Matrix<double, Cols, Cols> mColNormalMatrix;
+  Eigen::LDLT<Eigen::Matrix<double, Cols, Cols>> mColNormalSolver;
+  Eigen::Matrix<double, Cols, 1> mColRhs;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Computes the minimum-norm least-squares solution of mat * out = rhs, i.e.
+/// pseudoinverse(mat, eps) * rhs, without forming the pseudoinverse.
+///
+/// Small matrices are decomposed with \c Eigen::JacobiSVD. Dynamic-size
+/// matrices whose smaller dimension is at least 16 use the faster
+/// \c Eigen::BDCSVD. Only the thin factors are computed when \c Cols is
+/// dynamic.
+///
+/// \param mat input matrix
+/// \param rhs right-hand side
+/// \param[out] out least-squares solution
+/// \param workspace storage reused across calls
+/// \param eps singular values below this tolerance are treated as zero
+template <int Rows, int Cols>
+void solveLeastSquares(
+    const Eigen::Matrix<double, Rows, Cols>& mat,
+    const Eigen::Matrix<double, Rows, 1>& rhs,
+    Eigen::Matrix<double, Cols, 1>& out,
+    LeastSquaresWorkspace<Rows, Cols>& workspace,
+    double eps = 1e-6);
+
+/// Computes the damped least-squares solution of mat * out = rhs, i.e. the
+/// minimizer of |mat * out - rhs|^2 + damping^2 * |out|^2. The normal
+/// equations of whichever of mat * mat^T and mat^T * mat is smaller are
+/// solved with an LDLT factorization.
+///
+/// \param mat input matrix
+/// \param rhs right-hand side
+/// \param damping damping factor; must be positive unless \c mat has full
+///        rank
+/// \param[out] out damped least-squares solution
+/// \param workspace storage reused across calls
+template <int Rows, int Cols>
+void solveDampedLeastSquares(
+    const Eigen::Matrix<double, Rows, Cols>& mat,
+    const Eigen::Matrix<double, Rows, 1>& rhs,
+    double damping,
+    Eigen::Matrix<double, Cols, 1>& out,
+    LeastSquaresWorkspace<Rows, Cols>& workspace);
+
 } // namespace common
 } // namespace aikido
 
+#include "aikido/common/detail/PseudoInverse-impl.hpp"
+
 #endif // AIKIDO_COMMON_PSEUDOINVERSE_HPP_
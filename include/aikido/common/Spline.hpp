@@ -333,6 +333,60 @@ public:
       || ProblemMatrix::NeedsToAlign || ProblemVector::NeedsToAlign)
 };
 
+/// Fits the linear polynomial that takes the value \c _startValue at time zero
+/// and \c _endValue at time \c _duration. This is equivalent to, but much
+/// faster than, fitting a \c SplineProblem with two coefficients and two
+/// knots, since the coefficients of all outputs are computed in closed form.
+///
+/// \param _startValue value at time zero
+/// \param _endValue value at time \c _duration
+/// \param _duration duration of the segment, must be positive
+/// \return (num outputs) x 2 matrix, where element (i, j) is the coefficient
+/// on the \c x^j term for output \c i
+Eigen::Matrix<double, Eigen::Dynamic, 2> fitLinearSegment(
+    const Eigen::VectorXd& _startValue,
+    const Eigen::VectorXd& _endValue,
+    double _duration);
+
+/// Fits the cubic Hermite polynomial with the specified values and first
+/// derivatives at time zero and time \c _duration. This is equivalent to
+/// fitting a \c SplineProblem with four coefficients and two knots.
+///
+/// \param _startValue value at time zero
+/// \param _startVelocity first derivative at time zero
+/// \param _endValue value at time \c _duration
+/// \param _endVelocity first derivative at time \c _duration
+/// \param _duration duration of the segment, must be positive
+/// \return (num outputs) x 4 matrix of polynomial coefficients
+Eigen::Matrix<double, Eigen::Dynamic, 4> fitCubicSegment(
+    const Eigen::VectorXd& _startValue,
+    const Eigen::VectorXd& _startVelocity,
+    const Eigen::VectorXd& _endValue,
+    const Eigen::VectorXd& _endVelocity,
+    double _duration);
+
+/// Fits the quintic polynomial with the specified values, first derivatives
+/// and second derivatives at time zero and time \c _duration. This is
+/// equivalent to fitting a \c SplineProblem with six coefficients and two
+/// knots.
+///
+/// \param _startValue value at time zero
+/// \param _startVelocity first derivative at time zero
+/// \param _startAcceleration second derivative at time zero
+/// \param _endValue value at time \c _duration
+/// \param _endVelocity first derivative at time \c _duration
+/// \param _endAcceleration second derivative at time \c _duration
+/// \param _duration duration of the segment, must be positive
+/// \return (num outputs) x 6 matrix of polynomial coefficients
+Eigen::Matrix<double, Eigen::Dynamic, 6> fitQuinticSegment(
+    const Eigen::VectorXd& _startValue,
+    const Eigen::VectorXd& _startVelocity,
+    const Eigen::VectorXd& _startAcceleration,
+    const Eigen::VectorXd& _endValue,
+    const Eigen::VectorXd& _endVelocity,
+    const Eigen::VectorXd& _endAcceleration,
+    double _duration);
+
 } // namespace common
 } // namespace aikido
 
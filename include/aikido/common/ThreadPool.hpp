@@ -0,0 +1,76 @@
+#ifndef AIKIDO_COMMON_THREADPOOL_HPP_
+#define AIKIDO_COMMON_THREADPOOL_HPP_
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace aikido {
+namespace common {
+
+/// Fixed-size pool of worker threads that execute submitted tasks in FIFO
+/// order.
+///
+/// \code
+/// ThreadPool pool(4);
+/// auto result = pool.submit([]() { return 42; });
+/// result.get(); // 42
+/// \endcode
+class ThreadPool final
+{
+public:
+  /// Constructs the pool. The worker threads are started immediately.
+  ///
+  /// \param[in] numThreads Number of worker threads; must be positive.
+  /// \throw std::invalid_argument if \c numThreads is zero.
+  explicit ThreadPool(std::size_t numThreads);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// Runs every task that has already been submitted, then joins the worker
+  /// threads.
+  ~ThreadPool();
+
+  /// Returns the number of worker threads.
+  std::size_t getNumThreads() const;
+
+  /// Queues \c callback for execution on a worker thread.
+  ///
+  /// \param[in] callback Callable that takes no arguments.
+  /// \return Future that holds the return value of \c callback, or the
+  /// exception that it threw.
+  template <typename Callback>
+  std::future<typename std::result_of<Callback()>::type> submit(
+      Callback&& callback);
+
+private:
+  /// The loop function executed by each worker thread.
+  void spin();
+
+  std::vector<std::thread> mThreads;
+
+  /// Tasks waiting for a worker thread.
+  std::queue<std::function<void()>> mTasks;
+
+  /// Protects \c mTasks and \c mIsStopping.
+  std::mutex mMutex;
+
+  /// Signaled when a task is queued or the pool is stopping.
+  std::condition_variable mCondition;
+
+  /// Set when the pool is being destroyed.
+  bool mIsStopping;
+};
+
+} // namespace common
+} // namespace aikido
+
+#include "aikido/common/detail/ThreadPool-impl.hpp"
+
+#endif // AIKIDO_COMMON_THREADPOOL_HPP_
@@ -0,0 +1,135 @@
+#include <algorithm>
+
+#include "aikido/common/PseudoInverse.hpp"
+
+namespace aikido {
+namespace common {
+namespace detail {
+
+//==============================================================================
+/// Computes pinv(mat) * rhs from the singular value decomposition \c svd of
+/// mat. Only the leading columns of U and V are used, so \c svd may hold
+/// either the full or the thin factors.
+template <typename Svd, typename Rhs, typename Out, typename Coefficients>
+void applyPseudoinverse(
+    const Svd& svd,
+    const Rhs& rhs,
+    Out& out,
+    Coefficients& coefficients,
+    double eps)
+{
+  const auto& singularValues = svd.singularValues();
+  const auto size = singularValues.size();
+
+  coefficients.noalias() = svd.matrixU().leftCols(size).transpose() * rhs;
+  for (Eigen::Index i = 0; i < size; ++i)
+  {
+    if (singularValues[i] > eps)
+      coefficients[i] /= singularValues[i];
+    else
+      coefficients[i] = 0;
+  }
+
+  out.noalias() = svd.matrixV().leftCols(size) * coefficients;
+}
+
+//==============================================================================
+/// Singular value decomposition of a matrix with a fixed number of columns,
+/// for which Eigen only computes the full U and V.
+template <typename MatrixType>
+struct LeastSquaresSvd<MatrixType, false>
+{
+  using Svd = Eigen::JacobiSVD<MatrixType>;
+
+  template <typename Rhs, typename Out>
+  void solve(const MatrixType& mat, const Rhs& rhs, Out& out, double eps)
+  {
+    mJacobiSvd.compute(mat, Eigen::ComputeFullU | Eigen::ComputeFullV);
+    applyPseudoinverse(mJacobiSvd, rhs, out, mCoefficients, eps);
+  }
+
+  Svd mJacobiSvd;
+  typename Svd::SingularValuesType mCoefficients;
+};
+
+//==============================================================================
+/// Singular value decomposition of a matrix with a dynamic number of columns,
+/// for which Eigen can compute the thin U and V.
+template <typename MatrixType>
+struct LeastSquaresSvd<MatrixType, true>
+{
+  using Svd = Eigen::JacobiSVD<MatrixType>;
+
+  /// Smallest matrix dimension for which BDCSVD is used; Eigen recommends
+  /// JacobiSVD for smaller matrices.
+  static constexpr Eigen::Index kMinBdcSvdSize = 16;
+
+  template <typename Rhs, typename Out>
+  void solve(const MatrixType& mat, const Rhs& rhs, Out& out, double eps)
+  {
+    static constexpr int options = Eigen::ComputeThinU | Eigen::ComputeThinV;
+
+    if (std::min(mat.rows(), mat.cols()) < kMinBdcSvdSize)
+    {
+      mJacobiSvd.compute(mat, options);
+      applyPseudoinverse(mJacobiSvd, rhs, out, mCoefficients, eps);
+    }
+    else
+    {
+      mBdcSvd.compute(mat, options);
+      applyPseudoinverse(mBdcSvd, rhs, out, mCoefficients, eps);
+    }
+  }
+
+  Svd mJacobiSvd;
+  Eigen::BDCSVD<MatrixType> mBdcSvd;
+  typename Svd::SingularValuesType mCoefficients;
+};
+
+} // namespace detail
+
+//==============================================================================
+template <int Rows, int Cols>
+void solveLeastSquares(
+    const Eigen::Matrix<double, Rows, Cols>& mat,
+    const Eigen::Matrix<double, Rows, 1>& rhs,
+    Eigen::Matrix<double, Cols, 1>& out,
+    LeastSquaresWorkspace<Rows, Cols>& workspace,
+    double eps)
+{
+  workspace.mSvd.solve(mat, rhs, out, eps);
+}
+
+//==============================================================================
+template <int Rows, int Cols>
+void solveDampedLeastSquares(
+    const Eigen::Matrix<double, Rows, Cols>& mat,
+    const Eigen::Matrix<double, Rows, 1>& rhs,
+    double damping,
+    Eigen::Matrix<double, Cols, 1>& out,
+    LeastSquaresWorkspace<Rows, Cols>& workspace)
+{
+  const double dampingSquared = damping * damping;
+
+  if (mat.rows() <= mat.cols())
+  {
+    // out = mat^T * (mat * mat^T + damping^2 * I)^-1 * rhs
+    workspace.mRowNormalMatrix.noalias() = mat * mat.transpose();
+    workspace.mRowNormalMatrix.diagonal().array() += dampingSquared;
+    workspace.mRowNormalSolver.compute(workspace.mRowNormalMatrix);
+    workspace.mRowSolution = workspace.mRowNormalSolver.solve(rhs);
+    out.noalias() = mat.transpose() * workspace.mRowSolution;
+  }
+  else
+  {
+    // out = (mat^T * mat + damping^2 * I)^-1 * mat^T * rhs
+    workspace.mColNormalMatrix.noalias() = mat.transpose() * mat;
+    workspace.mColNormalMatrix.diagonal().array() += dampingSquared;
+    workspace.mColNormalSolver.compute(workspace.mColNormalMatrix);
+    workspace.mColRhs.noalias() = mat.transpose() * rhs;
+    out = workspace.mColNormalSolver.solve(workspace.mColRhs);
+  }
+}
+
+} // namespace common
+} // namespace aikido
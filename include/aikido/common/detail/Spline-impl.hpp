@@ -420,23 +420,23 @@ auto SplineProblem<Scalar, Index, _NumCoefficients, _NumOutputs, _NumKnots>::
   // Perform the QR decomposition once.
   Eigen::SparseQR<ProblemMatrix, Eigen::COLAMDOrdering<Index> > solver(mA);
 
-  for (Index ioutput = 0; ioutput < mNumOutputs; ++ioutput)
+  // Solve for the spline coefficients of all output dimensions at once, using
+  // the right-hand sides as the columns of a single matrix.
+  //
+  // TODO: As of Eigen 3.3.5, the output type of SparseQR::solve() is not
+  // assignable to a fixed size matrix, so we use Eigen::Dynamic here instead
+  // of DimensionAtCompileTime and NumOutputsAtCompileTime.
+  const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> solutionMatrices
+      = solver.solve(
+          Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>(mB));
+
+  // Split the coefficients by segment.
+  for (Index isegment = 0; isegment < mNumSegments; ++isegment)
   {
-    // Solve for the spline coefficients for each output dimension.
-    //
-    // TODO: As of Eigen 3.3.5, the output type of SparseQR::solve() is not
-    // assignable to a fixed size vector, so we use Eigen::Dynamic here instead
-    // of DimensionAtCompileTime.
-    Eigen::Matrix<Scalar, Eigen::Dynamic, 1> solutionVector
-        = solver.solve(mB.col(ioutput));
-
-    // Split the coefficients by segment.
-    for (Index isegment = 0; isegment < mNumSegments; ++isegment)
-    {
-      SolutionMatrix& solutionMatrix = mSolution[isegment];
-      solutionMatrix.row(ioutput) = solutionVector.segment(
-          isegment * mNumCoefficients, mNumCoefficients);
-    }
+    mSolution[isegment] = solutionMatrices
+                              .middleRows(
+                                  isegment * mNumCoefficients, mNumCoefficients)
+                              .transpose();
   }
 
   return Spline(mTimes, mSolution);
@@ -0,0 +1,30 @@
+#include <memory>
+
+#include "aikido/common/ThreadPool.hpp"
+
+namespace aikido {
+namespace common {
+
+//==============================================================================
+template <typename Callback>
+std::future<typename std::result_of<Callback()>::type> ThreadPool::submit(
+    Callback&& callback)
+{
+  using ReturnType = typename std::result_of<Callback()>::type;
+
+  // std::function requires a copyable target, so share the packaged_task.
+  auto task = std::make_shared<std::packaged_task<ReturnType()>>(
+      std::forward<Callback>(callback));
+  auto future = task->get_future();
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mTasks.emplace([task]() { (*task)(); });
+  }
+  mCondition.notify_one();
+
+  return future;
+}
+
+} // namespace common
+} // namespace aikido
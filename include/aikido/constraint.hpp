@@ -1,3 +1,4 @@
+#include "aikido/constraint/CachedTestable.hpp"
 #include "aikido/constraint/CartesianProductProjectable.hpp"
 #include "aikido/constraint/CartesianProductSampleable.hpp"
 #include "aikido/constraint/CartesianProductTestable.hpp"
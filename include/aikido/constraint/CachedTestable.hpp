@@ -0,0 +1,159 @@
+#ifndef AIKIDO_CONSTRAINT_CACHEDTESTABLE_HPP_
+#define AIKIDO_CONSTRAINT_CACHEDTESTABLE_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "aikido/common/pointers.hpp"
+#include "aikido/constraint/Testable.hpp"
+
+namespace aikido {
+namespace constraint {
+
+AIKIDO_DECLARE_POINTERS(CachedTestable)
+
+/// A Testable that memoizes the results of another Testable.
+///
+/// States are keyed by their log map, i.e. the tangent vector returned by
+/// \c StateSpace::logMap, rounded to a grid of the given resolution. Every
+/// state in a grid cell therefore shares the result of the first state tested
+/// in that cell, so the resolution should be well below the tolerance at which
+/// the wrapped constraint is expected to change its result. At most
+/// \c capacity results are kept; the least recently used result is evicted
+/// first.
+///
+/// If a version source is provided, the cache is cleared whenever the value it
+/// returns increases. For example, to invalidate results that depend on the
+/// obstacles of a planner::World while the robot is being checked:
+///
+/// \code
+/// const std::vector<std::string> ignored{robot->getName()};
+/// auto cached = std::make_shared<CachedTestable>(
+///     collisionConstraint, 1e-4, 100000,
+///     [world, ignored]() { return world->getVersion(ignored); });
+/// \endcode
+///
+/// This class is thread-safe if the wrapped Testable is.
+class CachedTestable : public Testable
+{
+public:
+  /// Constructor.
+  ///
+  /// \param testable Testable whose results are cached.
+  /// \param resolution Size of the grid cells states are rounded to.
+  /// \param capacity Maximum number of cached results.
+  /// \param versionSource Function that returns a value that increases
+  /// whenever the cached results may no longer be valid, e.g.
+  /// \c planner::World::getVersion; may be empty. It is called without
+  /// holding the lock of the cache.
+  CachedTestable(
+      ConstTestablePtr testable,
+      double resolution,
+      std::size_t capacity,
+      std::function<std::size_t()> versionSource = nullptr);
+
+  /// \copydoc Testable::isSatisfied()
+  /// \note Results are only cached when \c outcome is nullptr; otherwise the
+  /// wrapped Testable is called directly to populate \c outcome.
+  bool isSatisfied(
+      const statespace::StateSpace::State* state,
+      TestableOutcome* outcome = nullptr) const override;
+
+  /// \copydoc Testable::isSatisfiedBatch()
+  /// \note States whose results are not cached are forwarded to the wrapped
+  /// Testable in a single batch.
+  bool isSatisfiedBatch(
+      const std::vector<const statespace::StateSpace::State*>& states,
+      std::vector<bool>& out,
+      BatchMode mode = BatchMode::FirstFailure) const override;
+
+  // Documentation inherited.
+  statespace::ConstStateSpacePtr getStateSpace() const override;
+
+  /// Returns the outcome of the wrapped Testable.
+  std::unique_ptr<TestableOutcome> createOutcome() const override;
+
+  /// Returns the wrapped Testable.
+  ConstTestablePtr getTestable() const;
+
+  /// Returns the number of results currently cached.
+  std::size_t getSize() const;
+
+  /// Returns the number of lookups that found a cached result.
+  std::size_t getNumHits() const;
+
+  /// Returns the number of lookups that did not find a cached result.
+  std::size_t getNumMisses() const;
+
+  /// Removes every cached result and resets the hit and miss counters.
+  void clear();
+
+private:
+  using Key = std::vector<std::int64_t>;
+
+  /// Cached result of the wrapped Testable.
+  struct Entry
+  {
+    Key mKey;
+    bool mSatisfied;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  /// Computes the cache key of \c state.
+  void computeKey(const statespace::StateSpace::State* state, Key& key) const;
+
+  /// Returns the current value of the version source, or zero if there is
+  /// none. May be called without holding \c mMutex.
+  std::size_t queryVersion() const;
+
+  /// Clears the cache if \c version is newer than \c mVersion. Must be
+  /// called with \c mMutex held.
+  ///
+  /// \param version value returned by \c queryVersion
+  void updateVersion(std::size_t version) const;
+
+  /// Looks up \c key, marking it as most recently used. Must be called with
+  /// \c mMutex held.
+  ///
+  /// \param key key to look up
+  /// \param[out] satisfied cached result, if found
+  /// \return true if \c key was found
+  bool lookup(const Key& key, bool& satisfied) const;
+
+  /// Caches \c satisfied for \c key, evicting the least recently used result
+  /// if the cache is full. Must be called with \c mMutex held.
+  void insert(const Key& key, bool satisfied) const;
+
+  ConstTestablePtr mTestable;
+  statespace::ConstStateSpacePtr mStateSpace;
+  double mResolution;
+  std::size_t mCapacity;
+  std::function<std::size_t()> mVersionSource;
+
+  /// Protects every member below.
+  mutable std::mutex mMutex;
+
+  /// Cached results ordered from most to least recently used.
+  mutable EntryList mEntries;
+
+  mutable std::unordered_map<Key, EntryList::iterator, boost::hash<Key>>
+      mIndex;
+
+  /// Value of \c mVersionSource when the cache was last cleared.
+  mutable std::size_t mVersion;
+
+  mutable std::size_t mNumHits;
+  mutable std::size_t mNumMisses;
+};
+
+} // namespace constraint
+} // namespace aikido
+
+#endif // AIKIDO_CONSTRAINT_CACHEDTESTABLE_HPP_
@@ -1,6 +1,9 @@
 #ifndef AIKIDO_CONSTRAINT_NEWTONSMETHODPROJECTABLE_HPP_
 #define AIKIDO_CONSTRAINT_NEWTONSMETHODPROJECTABLE_HPP_
 
+#include <memory>
+#include <mutex>
+
 #include <Eigen/Dense>
 
 #include "aikido/constraint/Differentiable.hpp"
@@ -10,6 +13,11 @@ namespace aikido {
 namespace constraint {
 
 /// Uses Newton's method to project state.
+///
+/// Each Newton step solves for the minimum-norm tangent step, or the damped
+/// least-squares step if a positive damping is given, using storage that is
+/// allocated once per projectable. Concurrent projections are supported; a
+/// projection that finds the storage in use allocates its own.
 class NewtonsMethodProjectable : public Projectable
 {
 public:
@@ -22,28 +30,69 @@ public:
   ///        dimension.
   /// \param _maxIteration Max iteration for Newton's method.
   /// \param _minStepSize Minimum step size to be taken in Newton's method.
+  /// \param _damping Damping factor of the least-squares step. Zero takes the
+  ///        pseudoinverse step; a positive value trades convergence speed for
+  ///        robustness near singular Jacobians.
+  /// \param _warmStart Whether to seed each projection with the correction
+  ///        applied by the previous successful projection, if that reduces
+  ///        the constraint violation. Useful when consecutive projected
+  ///        states are close, e.g. when extending a constrained tree.
   NewtonsMethodProjectable(
       DifferentiablePtr _differentiable,
       std::vector<double> _tolerance,
       int _maxIteration = 1000,
-      double _minStepSize = 1e-5);
+      double _minStepSize = 1e-5,
+      double _damping = 0.0,
+      bool _warmStart = false);
+
+  ~NewtonsMethodProjectable() override;
 
   // Documentation inherited.
   bool project(
       const statespace::StateSpace::State* _s,
       statespace::StateSpace::State* _out) const override;
 
+  // Documentation inherited.
+  bool project(statespace::StateSpace::State* _s) const override;
+
   // Documentation inherited.
   statespace::ConstStateSpacePtr getStateSpace() const override;
 
 private:
+  /// Scratch storage for a single projection.
+  struct Workspace;
+
+  /// Runs Newton's method from \c _s using the storage in \c _workspace.
+  /// \c _s and \c _out must not alias.
+  bool runNewtonsMethod(
+      const statespace::StateSpace::State* _s,
+      statespace::StateSpace::State* _out,
+      Workspace& _workspace) const;
+
+  /// Returns true if \c _values satisfy the constraints within tolerance.
+  bool contains(const Eigen::VectorXd& _values) const;
+
+  /// Returns the norm of the amount by which \c _values violate the
+  /// constraints.
+  double computeViolation(const Eigen::VectorXd& _values) const;
+
+  /// Computes the tangent step that solves, in the least-squares sense,
+  /// J * step = -values for the Jacobian and values stored in \c _workspace.
+  void computeStep(Workspace& _workspace) const;
+
   DifferentiablePtr mDifferentiable;
   std::vector<double> mTolerance;
   int mMaxIteration;
   double mMinStepSize;
+  double mDamping;
+  bool mWarmStart;
   statespace::ConstStateSpacePtr mStateSpace;
+  std::vector<ConstraintType> mConstraintTypes;
 
-  bool contains(const statespace::StateSpace::State* _s) const;
+  /// Storage shared by projections that do not overlap in time. Also holds
+  /// the correction used to warm-start the next projection.
+  std::unique_ptr<Workspace> mWorkspace;
+  mutable std::mutex mWorkspaceMutex;
 };
 
 } // namespace constraint
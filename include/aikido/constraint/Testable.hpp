@@ -2,6 +2,7 @@
 #define AIKIDO_CONSTRAINT_TESTABLE_HPP_
 
 #include <memory>
+#include <vector>
 
 #include "aikido/common/pointers.hpp"
 #include "aikido/constraint/DefaultTestableOutcome.hpp"
@@ -30,6 +31,37 @@ public:
       const statespace::StateSpace::State* _state,
       TestableOutcome* outcome = nullptr) const = 0;
 
+  /// Policy for \c isSatisfiedBatch.
+  enum class BatchMode
+  {
+    /// Stop at the first state, in the order given, that does not satisfy
+    /// the constraint.
+    FirstFailure,
+
+    /// Test every state in the batch.
+    AllResults
+  };
+
+  /// Tests a batch of states against this constraint.
+  ///
+  /// In \c BatchMode::FirstFailure mode, \c out[i] is true for every state
+  /// preceding the first state that does not satisfy the constraint and false
+  /// for that state and every state after it, which may not have been tested.
+  /// In \c BatchMode::AllResults mode, \c out[i] is true if and only if
+  /// \c states[i] satisfies the constraint.
+  ///
+  /// The default implementation calls \c isSatisfied on each state in turn.
+  /// Derived classes may override this to share work across the batch.
+  ///
+  /// \param[in] states states to test
+  /// \param[out] out per-state results; resized to the size of \c states
+  /// \param[in] mode whether to stop at the first failure
+  /// \return true if every state satisfies the constraint
+  virtual bool isSatisfiedBatch(
+      const std::vector<const statespace::StateSpace::State*>& states,
+      std::vector<bool>& out,
+      BatchMode mode = BatchMode::FirstFailure) const;
+
   /// Returns StateSpace in which this constraint operates.
   virtual statespace::ConstStateSpacePtr getStateSpace() const = 0;
 
@@ -30,6 +30,14 @@ public:
       const aikido::statespace::StateSpace::State* state,
       TestableOutcome* outcome = nullptr) const override;
 
+  /// \copydoc Testable::isSatisfiedBatch()
+  /// \note Each constraint is tested as a batch, and only on the states that
+  /// satisfy every preceding constraint.
+  bool isSatisfiedBatch(
+      const std::vector<const statespace::StateSpace::State*>& states,
+      std::vector<bool>& out,
+      BatchMode mode = BatchMode::FirstFailure) const override;
+
   /// Return an instance of DefaultTestableOutcome, since this class doesn't
   /// have a more specialized TestableOutcome derivative assigned to it.
   std::unique_ptr<TestableOutcome> createOutcome() const override;
@@ -9,6 +9,7 @@
 #include <dart/collision/CollisionFilter.hpp>
 #include <dart/collision/CollisionGroup.hpp>
 #include <dart/collision/CollisionOption.hpp>
+#include <dart/collision/CollisionResult.hpp>
 
 #include "aikido/common/pointers.hpp"
 #include "aikido/constraint/Testable.hpp"
@@ -57,6 +58,16 @@ public:
       const aikido::statespace::StateSpace::State* _state,
       TestableOutcome* outcome = nullptr) const override;
 
+  /// \copydoc Testable::isSatisfiedBatch()
+  /// \note Validates the MetaSkeleton once per batch and converts every state
+  /// into one reused position vector. Within and across batches, the
+  /// collision checks start with the one that last found a collision, since
+  /// nearby configurations tend to collide in the same way.
+  bool isSatisfiedBatch(
+      const std::vector<const statespace::StateSpace::State*>& states,
+      std::vector<bool>& out,
+      BatchMode mode = BatchMode::FirstFailure) const override;
+
   /// \copydoc Testable::createOutcome()
   /// \note Returns an instance of CollisionFreeOutcome.
   std::unique_ptr<TestableOutcome> createOutcome() const override;
@@ -87,6 +98,31 @@ public:
 private:
   using CollisionGroup = ::dart::collision::CollisionGroup;
 
+  /// Returns the number of registered pairwise and self collision checks.
+  std::size_t getNumChecks() const;
+
+  /// Runs one registered collision check at the current configuration of
+  /// \c mMetaSkeleton. Pairwise checks are numbered before self checks.
+  ///
+  /// \param check index of the check
+  /// \param[out] outcome populated with the colliding contacts; may be nullptr
+  /// \return true if no collision was found
+  bool isCheckCollisionFree(
+      std::size_t check, CollisionFreeOutcome* outcome) const;
+
+  /// Runs the registered collision checks in order at the current
+  /// configuration of \c mMetaSkeleton.
+  ///
+  /// \param[out] outcome populated with the colliding contacts; may be nullptr
+  /// \return true if no collision was found
+  bool isCollisionFree(CollisionFreeOutcome* outcome) const;
+
+  /// Runs the registered collision checks at the current configuration of
+  /// \c mMetaSkeleton, starting with \c mLastCollidingCheck.
+  ///
+  /// \return true if no collision was found
+  bool isCollisionFreeFromLastCollision() const;
+
   aikido::statespace::dart::ConstMetaSkeletonStateSpacePtr
       mMetaSkeletonStateSpace;
   ::dart::dynamics::MetaSkeletonPtr mMetaSkeleton;
@@ -97,6 +133,16 @@ private:
       std::shared_ptr<CollisionGroup>>>
       mGroupsToPairwiseCheck;
   std::vector<std::shared_ptr<CollisionGroup>> mGroupsToSelfCheck;
+
+  /// Reused by every collision query to avoid reallocating contact storage.
+  mutable ::dart::collision::CollisionResult mCollisionResult;
+
+  /// Positions of the state being tested by \c isSatisfiedBatch.
+  mutable Eigen::VectorXd mPositions;
+
+  /// Index of the check that found the last collision in
+  /// \c isSatisfiedBatch.
+  mutable std::size_t mLastCollidingCheck;
 };
 
 } // namespace dart
@@ -112,6 +112,8 @@ public:
   /// se(3) tangent vector follows dart convention:
   ///   top 3 rows is the angle-axis representation of _s's rotation.
   ///   bottom 3 rows represent the translation.
+  /// The rotational rows are singular when the pitch of _s relative to w is
+  /// +/- pi/2.
   /// \param _s State to be evaluated at.
   /// \param[out] _out Jacobian, 6 x 6 matrix.
   void getJacobian(
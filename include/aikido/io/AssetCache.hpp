@@ -0,0 +1,45 @@
+#ifndef AIKIDO_IO_ASSETCACHE_HPP_
+#define AIKIDO_IO_ASSETCACHE_HPP_
+
+#include <memory>
+
+#include <dart/dart.hpp>
+
+namespace aikido {
+namespace io {
+
+/// Loads a mesh into a MeshShape, or returns the MeshShape that a previous
+/// call loaded from the same file with the same scale. The cache is shared by
+/// all threads of the process and is also used by \c readKinbody and
+/// \c readKinbodyString.
+///
+/// Meshes are cached by the local file that \c retriever resolves \c meshUri
+/// to (see \c ResourceRetriever::getFilePath, which requires DART 6.10;
+/// with older versions only file URIs are cached), so the same URI resolved
+/// by different retrievers does not share a mesh. A cached mesh is reloaded
+/// when the modification time or size of its file changes. Meshes that do
+/// not resolve to a local file are not cached. The cache does not keep meshes
+/// alive: a mesh is loaded again once every MeshShape loaded from it has been
+/// destroyed.
+///
+/// Since the returned MeshShape may be shared between Skeletons, changing it
+/// (e.g., its scale) affects every Skeleton that uses it.
+///
+/// \param[in] meshUri absolute URI of the mesh
+/// \param[in] scale scale of the mesh
+/// \param[in] retriever DART retriever for \c meshUri
+/// \return the MeshShape; nullptr if the mesh cannot be loaded
+std::shared_ptr<dart::dynamics::MeshShape> loadMeshShape(
+    const dart::common::Uri& meshUri,
+    const Eigen::Vector3d& scale,
+    const dart::common::ResourceRetrieverPtr& retriever);
+
+/// Removes all meshes and parsed Skeletons from the cache used by
+/// \c loadMeshShape, \c readKinbody and \c loadSkeletonFromURDF. Skeletons and
+/// shapes that were already returned remain valid.
+void clearAssetCache();
+
+} // namespace io
+} // namespace aikido
+
+#endif // AIKIDO_IO_ASSETCACHE_HPP_
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include <dart/common/ResourceRetriever.hpp>
+#include <dart/config.hpp>
 
 namespace aikido {
 namespace io {
@@ -36,6 +37,11 @@ public:
   // Documentation inherited.
   dart::common::ResourcePtr retrieve(const dart::common::Uri& _uri) override;
 
+#if DART_VERSION_AT_LEAST(6, 10, 0)
+  // Documentation inherited.
+  std::string getFilePath(const dart::common::Uri& _uri) override;
+#endif
+
 private:
   struct Workspace
   {
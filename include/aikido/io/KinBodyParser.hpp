@@ -49,7 +49,8 @@ namespace io {
 /// string. If nullptr is passed, this function uses a local file resource
 /// retriever which only can parse absolute file paths or file URIs
 /// (e.g., file://path/to/local/file.kinbody.xml).
-/// \return The parsed DART skeleton; returns nullptr on failure.
+/// \return The parsed DART skeleton; returns nullptr on failure. Its meshes
+/// are shared with other Skeletons, see \c loadMeshShape.
 ///
 /// \sa readKinbody
 dart::dynamics::SkeletonPtr readKinbodyString(
@@ -75,7 +76,13 @@ dart::dynamics::SkeletonPtr readKinbodyString(
 /// (e.g., file://path/to/local/file.kinbody.xml).
 /// \return The parsed DART skeleton; returns nullptr on failure.
 ///
+/// The file is parsed once per process and each call returns a clone of the
+/// parsed Skeleton, which shares its meshes with the other clones. The file
+/// is parsed again if it is a local file that was modified.
+///
 /// \sa readKinbodyString
+/// \sa loadMeshShape
+/// \sa clearAssetCache
 dart::dynamics::SkeletonPtr readKinbody(
     const dart::common::Uri& kinBodyUri,
     const dart::common::ResourceRetrieverPtr& retriever = nullptr);
@@ -0,0 +1,197 @@
+#ifndef AIKIDO_IO_TRAJECTORYLIBRARY_HPP_
+#define AIKIDO_IO_TRAJECTORYLIBRARY_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "aikido/common/pointers.hpp"
+#include "aikido/distance/DistanceMetric.hpp"
+#include "aikido/statespace/dart/MetaSkeletonStateSpace.hpp"
+#include "aikido/trajectory/Spline.hpp"
+
+/// Format of a serialized trajectory library (version 1)
+///
+/// All values are little-endian and every section starts at a multiple of 8
+/// bytes. The DOF names, start states and coefficients are stored as in the
+/// binary trajectory format, see aikido/io/trajectory.hpp.
+///
+///   header           magic "AIKIDOTL", uint32 version, uint32 number of
+///                    DOFs, uint64 number of trajectories, uint64 total
+///                    number of segments, uint64 total number of
+///                    coefficients, uint64 size of the DOF name section
+///   DOF names        uint32 length followed by the characters of each name,
+///                    zero-padded to a multiple of 8 bytes
+///   first segments   uint64 index of the first segment of each trajectory,
+///                    followed by the total number of segments
+///   first coeffs     uint64 index of the first coefficient of each
+///                    trajectory, followed by the total number of
+///                    coefficients
+///   start times      double start time of each trajectory
+///   start configs    (num DOFs) doubles per trajectory, see
+///                    StateSpace::logMap
+///   goal configs     (num DOFs) doubles per trajectory
+///   num coeffs       uint64 number of coefficients of each segment
+///   durations        double duration of each segment
+///   start states     (num DOFs) doubles per segment
+///   coefficients     (num DOFs) x (num coeffs) column-major doubles per
+///                    segment
+
+namespace aikido {
+namespace io {
+
+namespace detail {
+class MappedFile;
+} // namespace detail
+
+AIKIDO_DECLARE_POINTERS(TrajectoryLibrary)
+
+/// Read-only collection of spline trajectories that are stored in a single
+/// memory-mapped file, written by \c saveTrajectoryLibrary, and indexed by
+/// their start and goal configurations.
+///
+/// The distance between a query and a stored trajectory is the distance
+/// between their start states plus the distance between their goal states.
+/// Lookups use a vantage-point tree, which only relies on the triangle
+/// inequality of the \c DistanceMetric and therefore respects the topology of
+/// SO2 joints and the weights of the metric.
+class TrajectoryLibrary
+{
+public:
+  /// Stored trajectory found by \c findNearest.
+  struct Neighbor
+  {
+    /// Index of the stored trajectory.
+    std::size_t mIndex;
+
+    /// Distance between the query and the stored trajectory.
+    double mDistance;
+  };
+
+  /// Loads a trajectory library and builds its index.
+  ///
+  /// \param[in] libraryPath path to the trajectory library file
+  /// \param[in] stateSpace MetaSkeletonStateSpace of the trajectories
+  /// \param[in] distanceMetric metric on \c stateSpace; defaults to
+  /// \c distance::createDistanceMetric
+  /// \throw std::runtime_error if the file is malformed or its DOFs do not
+  /// match \c stateSpace
+  TrajectoryLibrary(
+      const std::string& libraryPath,
+      statespace::dart::ConstMetaSkeletonStateSpacePtr stateSpace,
+      distance::ConstDistanceMetricPtr distanceMetric = nullptr);
+
+  TrajectoryLibrary(const TrajectoryLibrary&) = delete;
+  TrajectoryLibrary& operator=(const TrajectoryLibrary&) = delete;
+
+  ~TrajectoryLibrary();
+
+  /// Returns the number of stored trajectories.
+  std::size_t getNumTrajectories() const;
+
+  /// Returns the state at the start of a stored trajectory.
+  ///
+  /// \param[in] index index of the stored trajectory
+  const statespace::StateSpace::State* getStartState(std::size_t index) const;
+
+  /// Returns the state at the end of a stored trajectory.
+  ///
+  /// \param[in] index index of the stored trajectory
+  const statespace::StateSpace::State* getGoalState(std::size_t index) const;
+
+  /// Builds a stored trajectory from the mapped file.
+  ///
+  /// \param[in] index index of the stored trajectory
+  /// \throw std::out_of_range if \c index is out of range
+  trajectory::UniqueSplinePtr getTrajectory(std::size_t index) const;
+
+  /// Builds several stored trajectories from the mapped file.
+  ///
+  /// \param[in] indices indices of the stored trajectories
+  /// \throw std::out_of_range if an index is out of range
+  std::vector<trajectory::UniqueSplinePtr> getTrajectories(
+      const std::vector<std::size_t>& indices) const;
+
+  /// Finds the stored trajectories nearest to a start and goal state.
+  ///
+  /// \param[in] startState start state of the query
+  /// \param[in] goalState goal state of the query
+  /// \param[in] numNeighbors maximum number of trajectories to return
+  /// \return up to \c numNeighbors trajectories in order of increasing
+  /// distance
+  std::vector<Neighbor> findNearest(
+      const statespace::StateSpace::State* startState,
+      const statespace::StateSpace::State* goalState,
+      std::size_t numNeighbors = 1) const;
+
+private:
+  /// Node of the vantage-point tree. The stored trajectories in the subtree
+  /// \c mInside are no farther than \c mRadius from \c mTrajectory, and those
+  /// in \c mOutside are no closer.
+  struct Node
+  {
+    std::size_t mTrajectory;
+    double mRadius;
+    std::size_t mInside;
+    std::size_t mOutside;
+  };
+
+  /// Builds the subtree over the stored trajectories in [first, last) and
+  /// returns the index of its root. The first member of each element is
+  /// used as scratch space.
+  std::size_t buildTree(
+      std::vector<std::pair<double, std::size_t>>::iterator first,
+      std::vector<std::pair<double, std::size_t>>::iterator last);
+
+  /// Adds the trajectories in the subtree rooted at \c node that are nearer
+  /// to the query than the farthest of \c neighbors to \c neighbors, which is
+  /// a max-heap of at most \c numNeighbors elements.
+  void searchTree(
+      std::size_t node,
+      const statespace::StateSpace::State* startState,
+      const statespace::StateSpace::State* goalState,
+      std::size_t numNeighbors,
+      std::vector<Neighbor>& neighbors) const;
+
+  /// Returns the distance between a start and goal state and a stored
+  /// trajectory.
+  double getDistance(
+      const statespace::StateSpace::State* startState,
+      const statespace::StateSpace::State* goalState,
+      std::size_t index) const;
+
+  statespace::dart::ConstMetaSkeletonStateSpacePtr mStateSpace;
+  distance::ConstDistanceMetricPtr mDistanceMetric;
+  std::unique_ptr<detail::MappedFile> mFile;
+
+  std::size_t mNumTrajectories;
+  const std::uint64_t* mFirstSegments;
+  const std::uint64_t* mFirstCoefficients;
+  const double* mStartTimes;
+  const std::uint64_t* mNumCoefficients;
+  const double* mDurations;
+  const double* mSegmentStartStates;
+  const double* mCoefficients;
+
+  std::vector<statespace::StateSpace::State*> mStartStates;
+  std::vector<statespace::StateSpace::State*> mGoalStates;
+  std::vector<Node> mNodes;
+};
+
+/// Serializes spline trajectories to a trajectory library file.
+///
+/// \param[in] trajectories non-empty trajectories in the same
+/// MetaSkeletonStateSpace
+/// \param[in] savePath save path for the trajectory library file
+/// \throw std::runtime_error if \c trajectories or one of the trajectories is
+/// empty, the trajectories have different DOFs or the file cannot be written
+void saveTrajectoryLibrary(
+    const std::vector<trajectory::ConstSplinePtr>& trajectories,
+    const std::string& savePath);
+
+} // namespace io
+} // namespace aikido
+
+#endif // AIKIDO_IO_TRAJECTORYLIBRARY_HPP_
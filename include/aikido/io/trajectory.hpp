@@ -19,6 +19,23 @@
 ///   - coefficients: [5, 6, ...]
 ///     duration: 0.1875
 ///     start_state: [7, 8, ...]
+///
+/// Format of serialized trajectory in binary (version 1)
+///
+/// All values are little-endian and every section starts at a multiple of 8
+/// bytes, so that the arrays can be used in place from a memory-mapped file.
+///
+///   header           magic "AIKIDOTJ", uint32 version, uint32 number of
+///                    DOFs, uint64 number of segments, uint32 order,
+///                    uint32 reserved, double start time, uint64 size of the
+///                    DOF name section in bytes
+///   DOF names        uint32 length followed by the characters of each name,
+///                    zero-padded to a multiple of 8 bytes
+///   num coeffs       uint64 number of coefficients of each segment
+///   durations        double duration of each segment
+///   start states     (num DOFs) doubles per segment, see StateSpace::logMap
+///   coefficients     (num DOFs) x (num coeffs) column-major doubles per
+///                    segment
 
 namespace aikido {
 namespace io {
@@ -40,6 +57,38 @@ aikido::trajectory::UniqueSplinePtr loadSplineTrajectory(
     const aikido::statespace::dart::ConstMetaSkeletonStateSpacePtr&
         metaSkeletonStateSpace);
 
+/// Serializes a spline trajectory to the binary trajectory format.
+///
+/// \param[in] trajectory Spline trajectory
+/// \param[in] savePath save path for the binary trajectory file
+/// \throw std::runtime_error if the file cannot be written
+void saveTrajectoryBinary(
+    const aikido::trajectory::Spline& trajectory, const std::string& savePath);
+
+/// Deserializes a spline trajectory from the binary trajectory format. The
+/// file is memory-mapped and the coefficients are copied into the trajectory
+/// without parsing.
+///
+/// \param[in] trajPath path to the binary trajectory file
+/// \param[in] metaSkeletonStateSpace MetaskeletonStateSpace for the trajectory
+/// \return Loaded spline trajectory
+/// \throw std::runtime_error if the file is malformed or its DOFs do not match
+/// \c metaSkeletonStateSpace
+aikido::trajectory::UniqueSplinePtr loadSplineTrajectoryBinary(
+    const std::string& trajPath,
+    const aikido::statespace::dart::ConstMetaSkeletonStateSpacePtr&
+        metaSkeletonStateSpace);
+
+/// Converts a YAML trajectory file written by \c saveTrajectory to the binary
+/// trajectory format. This does not require the MetaSkeleton the trajectory
+/// was planned for.
+///
+/// \param[in] yamlPath path to the YAML trajectory file
+/// \param[in] binaryPath save path for the binary trajectory file
+/// \throw std::runtime_error if the YAML file is malformed
+void convertTrajectoryToBinary(
+    const std::string& yamlPath, const std::string& binaryPath);
+
 } // namespace io
 } // namespace aikido
 
@@ -8,6 +8,12 @@ namespace io {
 
 /// Load a DART Skeleton from a URDF and set its pose.
 ///
+/// If \c retriever resolves \c uri to a local file, the URDF is parsed once
+/// per process and each call returns a clone of the parsed Skeleton, which
+/// shares its meshes with the other clones. The URDF is parsed again if the
+/// file was modified. URDFs that are not local files are parsed on every
+/// call.
+///
 /// \param[in] retriever DART retriever to resolve the URI
 /// \param[in] uri URI to the object URDF
 /// \param[in] transform Initial transform for the Skeleton
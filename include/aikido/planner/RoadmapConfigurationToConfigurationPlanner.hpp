@@ -0,0 +1,166 @@
+#ifndef AIKIDO_PLANNER_ROADMAPCONFIGURATIONTOCONFIGURATIONPLANNER_HPP_
+#define AIKIDO_PLANNER_ROADMAPCONFIGURATIONTOCONFIGURATIONPLANNER_HPP_
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "aikido/constraint/Sampleable.hpp"
+#include "aikido/constraint/Testable.hpp"
+#include "aikido/distance/DistanceMetric.hpp"
+#include "aikido/planner/ConfigurationToConfiguration.hpp"
+#include "aikido/planner/ConfigurationToConfigurationPlanner.hpp"
+#include "aikido/statespace/Interpolator.hpp"
+
+namespace aikido {
+namespace planner {
+
+/// Multi-query planner that searches a persistent roadmap.
+///
+/// The roadmap is built once by \c buildRoadmap, without testing any
+/// constraint, and is kept across calls to \c plan. Each call connects the
+/// start and goal states to their nearest roadmap vertices and searches for a
+/// shortest path with A*. The vertices and edges of a candidate path are then
+/// tested against the constraint of the problem, i.e. against the current
+/// state of the world, and the search is repeated without the invalid ones
+/// until a valid path is found (LazyPRM). Test results are only reused within
+/// a single call, so the roadmap stays valid when the world changes.
+///
+/// The roadmap can be saved to and loaded from a compact binary file to avoid
+/// rebuilding it at startup.
+class RoadmapConfigurationToConfigurationPlanner
+  : public ConfigurationToConfigurationPlanner
+{
+public:
+  /// Constructor.
+  ///
+  /// \param[in] stateSpace State space that this planner associated with.
+  /// \param[in] dmetric Distance metric defined on \c stateSpace.
+  /// \param[in] sampler Sampleable used to sample the roadmap vertices.
+  /// \param[in] interpolator Interpolator used to test the edges and to
+  /// produce the output trajectory. If nullptr is passed in,
+  /// GeodesicInterpolator is used by default.
+  /// \param[in] numNeighbors Number of nearest vertices each new vertex, start
+  /// state and goal state is connected to.
+  /// \param[in] maxDistanceBtwValidityChecks The maximum distance (under
+  /// \c dmetric) between testing two successive states on an edge.
+  /// \throw If \c dmetric or \c sampler is nullptr or is not defined on
+  /// \c stateSpace.
+  RoadmapConfigurationToConfigurationPlanner(
+      statespace::ConstStateSpacePtr stateSpace,
+      distance::DistanceMetricPtr dmetric,
+      constraint::SampleablePtr sampler,
+      statespace::ConstInterpolatorPtr interpolator = nullptr,
+      std::size_t numNeighbors = 10,
+      double maxDistanceBtwValidityChecks = 0.1);
+
+  RoadmapConfigurationToConfigurationPlanner(
+      const RoadmapConfigurationToConfigurationPlanner&)
+      = delete;
+  RoadmapConfigurationToConfigurationPlanner& operator=(
+      const RoadmapConfigurationToConfigurationPlanner&)
+      = delete;
+
+  virtual ~RoadmapConfigurationToConfigurationPlanner();
+
+  /// Adds up to \c numVertices sampled vertices to the roadmap and connects
+  /// each of them to its \c numNeighbors nearest vertices. Construction takes
+  /// time quadratic in the size of the roadmap.
+  ///
+  /// \param[in] numVertices Number of vertices to add.
+  void buildRoadmap(std::size_t numVertices);
+
+  /// Removes every vertex and edge from the roadmap.
+  void clearRoadmap();
+
+  /// Returns the number of vertices in the roadmap.
+  std::size_t getNumVertices() const;
+
+  /// Returns the number of edges in the roadmap.
+  std::size_t getNumEdges() const;
+
+  /// Writes the roadmap in binary form to \c stream.
+  ///
+  /// \param[out] stream Stream opened in binary mode.
+  /// \throw If writing fails.
+  void saveRoadmap(std::ostream& stream) const;
+
+  /// Writes the roadmap in binary form to the file \c filename.
+  ///
+  /// \param[in] filename File to write.
+  /// \throw If the file cannot be written.
+  void saveRoadmap(const std::string& filename) const;
+
+  /// Replaces the roadmap with the one read from \c stream, which must have
+  /// been written by \c saveRoadmap for a state space of the same dimension.
+  ///
+  /// \param[in] stream Stream opened in binary mode.
+  /// \throw If the stream does not contain a valid roadmap.
+  void loadRoadmap(std::istream& stream);
+
+  /// Replaces the roadmap with the one read from the file \c filename.
+  ///
+  /// \param[in] filename File written by \c saveRoadmap.
+  /// \throw If the file cannot be read or does not contain a valid roadmap.
+  void loadRoadmap(const std::string& filename);
+
+  /// Plans a trajectory from start state to goal state on the roadmap.
+  ///
+  /// If successful, the planner returns a trajectory that satisfies the
+  /// constraint. If not, it returns a \c nullptr.
+  /// The corresponding message is stored in result.
+  ///
+  /// \param[in] problem Planning problem.
+  /// \param[out] result Information about success or failure.
+  /// \return Trajectory or \c nullptr if planning failed.
+  /// \throw If \c problem is not ConfigurationToConfiguration.
+  /// \throw If \c result is not ConfigurationToConfiguration::Result.
+  trajectory::TrajectoryPtr plan(
+      const SolvableProblem& problem, Result* result = nullptr) override;
+
+private:
+  /// Undirected edge stored in the adjacency list of both of its vertices.
+  struct Edge
+  {
+    std::uint32_t mTarget;
+    double mLength;
+  };
+
+  /// Appends a vertex holding a copy of \c state and connects it to its
+  /// nearest vertices.
+  void addVertex(const statespace::StateSpace::State* state);
+
+  /// Returns up to \c mNumNeighbors vertices nearest to \c state, excluding
+  /// vertices at or after \c endVertex.
+  std::vector<Edge> findNearestVertices(
+      const statespace::StateSpace::State* state,
+      std::size_t endVertex) const;
+
+  /// Tests the states on the path between \c from and \c to, excluding the
+  /// endpoints.
+  bool isEdgeValid(
+      const statespace::StateSpace::State* from,
+      const statespace::StateSpace::State* to,
+      double length,
+      const constraint::Testable& constraint) const;
+
+  distance::DistanceMetricPtr mDistanceMetric;
+  constraint::SampleablePtr mSampler;
+  statespace::ConstInterpolatorPtr mInterpolator;
+  std::size_t mNumNeighbors;
+  double mMaxDistanceBtwValidityChecks;
+
+  /// States of the roadmap vertices, owned by this planner.
+  std::vector<statespace::StateSpace::State*> mVertices;
+
+  /// Adjacency list of each vertex.
+  std::vector<std::vector<Edge>> mAdjacency;
+
+  std::size_t mNumEdges;
+};
+
+} // namespace planner
+} // namespace aikido
+
+#endif // AIKIDO_PLANNER_ROADMAPCONFIGURATIONTOCONFIGURATIONPLANNER_HPP_
@@ -1,8 +1,12 @@
 #ifndef AIKIDO_PLANNER_WORLD_HPP_
 #define AIKIDO_PLANNER_WORLD_HPP_
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <dart/dart.hpp>
 
@@ -83,6 +87,28 @@ public:
 
   // TODO: Add methods for registering callbacks?
 
+  /// Returns a counter that is incremented whenever a Skeleton is added or
+  /// removed, the state of this World is set by \c setState, or a Skeleton
+  /// has moved since the previous call to this method. Results that depend on
+  /// this World, e.g. collision checks, may be cached against it.
+  ///
+  /// Moves are detected through the transform update signals of the
+  /// BodyNodes that a Skeleton had when it was added to this World, so this
+  /// method does not scan any positions.
+  ///
+  /// Skeletons whose positions are set by the cached computation itself, e.g.
+  /// the robot being collision checked, should be listed in
+  /// \c ignoredSkeletons; otherwise every check would change the version.
+  ///
+  /// \param ignoredSkeletons names of Skeletons whose moves are ignored
+  std::size_t getVersion(
+      const std::vector<std::string>& ignoredSkeletons
+      = std::vector<std::string>()) const;
+
+  /// Increments the version of this World. Call this after modifying its
+  /// Skeletons other than through the methods of this World.
+  void incrementVersion();
+
   /// Get the mutex that protects the state of this World.
   std::mutex& getMutex() const;
 
@@ -117,6 +143,27 @@ protected:
   /// Mutex to protect this World
   mutable std::mutex mMutex;
 
+  /// Version of this World
+  mutable std::atomic<std::size_t> mVersion;
+
+  /// Records whether a Skeleton has moved since \c getVersion last looked.
+  struct SkeletonObserver
+  {
+    /// Set when any BodyNode of the Skeleton is moved.
+    std::atomic<bool> mIsMoved;
+
+    /// Connections to the transform update signals of the BodyNodes. Never
+    /// reallocated, since copying a connection and destroying the original
+    /// would disconnect it.
+    std::vector<dart::common::ScopedConnection> mConnections;
+  };
+
+  /// Observer of each Skeleton in \c mSkeletons.
+  std::vector<std::unique_ptr<SkeletonObserver>> mSkeletonObservers;
+
+  /// Mutex to protect \c mSkeletonObservers
+  mutable std::mutex mVersionMutex;
+
   /// NameManager for keeping track of Worlds
   static dart::common::NameManager<World*> mWorldNameManager;
 
@@ -30,6 +30,10 @@ namespace kunzretimer {
 /// \param[in] maxDeviation Maximum deviation from a waypoint in doing circular
 /// blending around the waypoint
 /// \param[in] timeStep Time step in following the path
+/// \param[in] maxFittingError Maximum error in position and velocity, at every
+/// time step, allowed when merging consecutive time steps into a single spline
+/// segment. Zero disables merging, i.e. the output has one segment per time
+/// step.
 /// \return Time optimal trajectory that satisfies velocity and acceleration
 /// constraints
 std::unique_ptr<aikido::trajectory::Spline> computeKunzTiming(
@@ -37,7 +41,8 @@ std::unique_ptr<aikido::trajectory::Spline> computeKunzTiming(
     const Eigen::VectorXd& maxVelocity,
     const Eigen::VectorXd& maxAcceleration,
     double maxDeviation = 1e-2,
-    double timeStep = 0.1);
+    double timeStep = 0.1,
+    double maxFittingError = 0.);
 
 /// Class for performing time-optimal trajectory retiming following subject to
 /// velocity and acceleration limits.
@@ -48,11 +53,14 @@ public:
   /// \param[in] accelerationLimits Maximum acceleration for each dimension.
   /// \param[in] maxDeviation Maximum deviation in circular blending
   /// \param[in] timeStep Time step in following the path
+  /// \param[in] maxFittingError Maximum error in merging time steps into
+  /// spline segments, or zero to output one segment per time step
   KunzRetimer(
       const Eigen::VectorXd& velocityLimits,
       const Eigen::VectorXd& accelerationLimits,
       double maxDeviation,
-      double timeStep);
+      double timeStep,
+      double maxFittingError = 0.);
 
   /// Performs parabolic retiming on an input trajectory.
   /// \copydoc TrajectoryPostProcessor::postprocess
@@ -92,6 +100,12 @@ public:
   /// Sets the max deviation of circular blending
   void setMaxDeviation(double maxDeviation);
 
+  /// Returns the max error in merging time steps into spline segments
+  double getMaxFittingError() const;
+
+  /// Sets the max error in merging time steps into spline segments
+  void setMaxFittingError(double maxFittingError);
+
 private:
   /// Set to the value of \c velocityLimits.
   Eigen::VectorXd mVelocityLimits;
@@ -104,6 +118,9 @@ private:
 
   /// Set to the value of \c timeStep
   double mTimeStep;
+
+  /// Set to the value of \c maxFittingError
+  double mMaxFittingError;
 };
 
 } // namespace kunzretimer
@@ -1,11 +1,19 @@
 #ifndef AIKIDO_PLANNER_OMPL_CRRT_HPP_
 #define AIKIDO_PLANNER_OMPL_CRRT_HPP_
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <ompl/base/Planner.h>
 #include <ompl/datastructures/NearestNeighbors.h>
 #include <ompl/geometric/planners/PlannerIncludes.h>
 
+#include "aikido/common/ThreadPool.hpp"
 #include "aikido/constraint/Projectable.hpp"
+#include "aikido/constraint/Sampleable.hpp"
+#include "aikido/constraint/Testable.hpp"
 #include "aikido/planner/ompl/BackwardCompatibility.hpp"
 
 namespace aikido {
@@ -16,6 +24,30 @@ namespace ompl {
 class CRRT : public ::ompl::base::Planner
 {
 public:
+  /// Constraints used by one worker thread of a parallel search. The
+  /// constraints of different workers are used concurrently, so each must
+  /// operate on its own state, e.g. on a cloned MetaSkeleton with its own
+  /// CollisionDetector. All of them must be defined on the planning
+  /// StateSpace.
+  struct WorkerConstraints
+  {
+    /// Equivalent to the validity constraint of the SpaceInformation, which
+    /// the worker combines with the bounds constraint of the StateSpace.
+    constraint::TestablePtr validityConstraint;
+
+    /// Equivalent to the constraint set by setPathConstraint().
+    constraint::ProjectablePtr pathConstraint;
+
+    /// Equivalent to the goal of the ProblemDefinition. The distance of the
+    /// states that do not satisfy it is computed by the goal of the
+    /// ProblemDefinition, so its distanceGoal() must be safe to call from
+    /// several workers at once.
+    constraint::TestablePtr goalTestable;
+
+    /// Samples the states that the worker extends the trees towards.
+    constraint::SampleablePtr sampler;
+  };
+
   /// Constructor
   /// \param _si Information about the planning space
   explicit CRRT(const ::ompl::base::SpaceInformationPtr& _si);
@@ -107,6 +139,18 @@ public:
   /// made and quit extending.
   double getMinStateDifference() const;
 
+  /// Set the constraints of the worker threads. If \c _workers is non-empty,
+  /// solve() samples, projects and extends into the shared trees with one
+  /// thread per element of \c _workers. The path constraint and the
+  /// validity checker of the SpaceInformation are then not used, and the goal
+  /// of the ProblemDefinition is only used to sample goal states, one thread
+  /// at a time.
+  /// \param _workers Constraints of each worker thread
+  void setWorkerConstraints(std::vector<WorkerConstraints> _workers);
+
+  /// Get the number of threads solve() extends the trees with.
+  std::size_t getNumWorkers() const;
+
   /// Set a nearest neighbors data structure
   template <template <typename T> class NN>
   void setNearestNeighbors();
@@ -148,6 +192,25 @@ protected:
     Motion* parent;
   };
 
+  /// Per-thread view of the planning problem used to extend the trees.
+  struct Worker
+  {
+    /// Checks the validity of states and motions.
+    ::ompl::base::SpaceInformationPtr si;
+
+    /// Samples the states the trees are extended towards.
+    ::ompl::base::StateSamplerPtr sampler;
+
+    /// The constraint that must be satisfied throughout the trajectory.
+    constraint::ProjectablePtr pathConstraint;
+
+    /// Tests whether a state reaches the goal.
+    ::ompl::base::GoalPtr goal;
+
+    /// Used to determine whether to sample a goal state.
+    ::ompl::RNG* rng;
+  };
+
   /// Free the memory allocated by this planner
   virtual void freeMemory();
 
@@ -161,14 +224,38 @@ protected:
   /// A nearest-neighbors datastructure containing the tree of motions
   TreeData mStartTree;
 
+  /// Returns the workers used by solve(): one per element of
+  /// \c mWorkerConstraints, or a single worker that uses the SpaceInformation
+  /// and the goal of the ProblemDefinition of this planner.
+  std::vector<Worker>& getWorkers();
+
+  /// Runs \c _extend once per worker, concurrently if there is more than one
+  /// worker. The first worker runs on the calling thread and the others on a
+  /// thread pool that is reused across calls.
+  void runWorkers(const std::function<void(Worker&)>& _extend);
+
+  /// Returns the mutex that protects \c _tree. Each tree is locked as a whole
+  /// for every \c add() and \c nearest(), because the nearest-neighbor
+  /// structures are not thread-safe.
+  virtual std::mutex& getTreeMutex(const TreeData& _tree);
+
+  /// Adds \c _motion to \c _tree.
+  void addMotion(TreeData& _tree, Motion* _motion);
+
+  /// Returns the number of motions in \c _tree.
+  std::size_t getTreeSize(TreeData& _tree);
+
+  /// Returns the motion in \c _tree nearest to \c _motion.
+  Motion* nearestMotion(TreeData& _tree, Motion* _motion);
+
   /// Perform an extension that projects to a constraint
   /// \param ptc Planner termination conditions. Used to stop extending if
   /// planning time expires.
+  /// \param worker The worker performing the extension
   /// \param tree The tree to extend
   /// \param nmotion The node in the tree to extend from
   /// \param gstate The state the extension aims to reach
   /// \param xstate A temporary state that can be used during extension
-  /// \param goal The goal of the planning instance
   /// \param returnlast If true, return the last node added to the tree,
   /// otherwise return the node added that was nearest the goal
   /// \param[out] dist The closest distance this extension got to the goal
@@ -177,11 +264,11 @@ protected:
   /// otherwise the closest node along the extension to the goal
   Motion* constrainedExtend(
       const ::ompl::base::PlannerTerminationCondition& ptc,
+      const Worker& worker,
       TreeData& tree,
       Motion* nmotion,
       ::ompl::base::State* gstate,
       ::ompl::base::State* xstate,
-      ::ompl::base::Goal* goal,
       bool returnlast,
       double& dist,
       bool& foundgoal);
@@ -212,6 +299,27 @@ protected:
   /// The minumum step size along the constraint. Used to determine
   /// when projection is no longer making progress during an extension.
   double mMinStepsize;
+
+  /// Constraints of the worker threads, if any.
+  std::vector<WorkerConstraints> mWorkerConstraints;
+
+  /// Workers used by the last call to solve().
+  std::vector<Worker> mWorkers;
+
+  /// Random number generators of \c mWorkers.
+  std::vector<std::unique_ptr<::ompl::RNG>> mWorkerRngs;
+
+  /// Runs every worker but the first; created by the first call to
+  /// runWorkers() with more than one worker.
+  std::unique_ptr<common::ThreadPool> mThreadPool;
+
+  /// Protects \c mStartTree while workers extend it concurrently.
+  std::mutex mStartTreeMutex;
+
+  /// Serializes access to the goal of the ProblemDefinition and to the
+  /// planner input states. Only held while the goal is used, never while the
+  /// resulting states are checked.
+  std::mutex mGoalMutex;
 };
 
 } // namespace ompl
@@ -1,6 +1,10 @@
 #ifndef AIKIDO_PLANNER_OMPL_CRRTCONNECT_HPP_
 #define AIKIDO_PLANNER_OMPL_CRRTCONNECT_HPP_
 
+#include <atomic>
+#include <condition_variable>
+
+#include <ompl/base/goals/GoalSampleableRegion.h>
 #include <ompl/datastructures/NearestNeighbors.h>
 #include <ompl/geometric/planners/PlannerIncludes.h>
 
@@ -70,9 +74,45 @@ protected:
   /// Free the memory allocated by this planner
   void freeMemory() override;
 
+  // Documentation inherited.
+  std::mutex& getTreeMutex(const TreeData& _tree) override;
+
+  /// Samples \c _goal into \c _state, holding \c mGoalMutex only while the
+  /// goal is sampled. The caller checks the validity of the sample.
+  ///
+  /// \param _goal goal of the ProblemDefinition
+  /// \param[out] _state sampled goal state
+  /// \return false if \c _goal has no sample available. Otherwise, the
+  /// caller must call \c finishGoalSample once it has checked the sample and
+  /// added it to the goal tree if it is valid.
+  bool sampleGoal(
+      const ::ompl::base::GoalSampleableRegion* _goal,
+      ::ompl::base::State* _state);
+
+  /// Marks a goal sample returned by \c sampleGoal as checked.
+  void finishGoalSample();
+
+  /// Waits until every goal sample returned by \c sampleGoal is checked.
+  ///
+  /// \return true if the goal tree is not empty
+  bool waitForGoalSamples();
+
   /// The goal tree
   TreeData mGoalTree;
 
+  /// Protects \c mGoalTree while workers extend it concurrently.
+  std::mutex mGoalTreeMutex;
+
+  /// Number of goal states sampled since the last call to clear().
+  std::atomic<std::size_t> mNumSampledGoals;
+
+  /// Number of goal samples being checked by workers; protected by
+  /// \c mGoalMutex.
+  std::size_t mNumPendingGoals;
+
+  /// Signaled when a worker finishes checking a goal sample.
+  std::condition_variable mGoalSampleFinished;
+
   /// Max distance between two trees to consider them connected
   double mConnectionRadius;
 
@@ -3,6 +3,7 @@
 
 #include <ompl/base/StateSpace.h>
 
+#include "aikido/common/FixedSizePool.hpp"
 #include "aikido/constraint/Projectable.hpp"
 #include "aikido/constraint/Sampleable.hpp"
 #include "aikido/constraint/Testable.hpp"
@@ -127,7 +128,9 @@ public:
   /// Allocate an instance of the state sampler for this space.
   ::ompl::base::StateSamplerPtr allocDefaultStateSampler() const override;
 
-  /// Allocate a state that can store a point in the described space
+  /// Allocate a state that can store a point in the described space. Both the
+  /// OMPL wrapper and the wrapped aikido state are drawn from memory pools, so
+  /// planners that allocate a state per tree node do not hit the global heap.
   ::ompl::base::State* allocState() const override;
 
   /// Allocate a state constaining a copy of the aikido state
@@ -136,7 +139,8 @@ public:
       const statespace::StateSpace::State* state) const;
 
   /// Free the memory of the allocated state. This also frees the memory of the
-  /// wrapped aikido state.
+  /// wrapped aikido state. \c state must have been allocated by this same
+  /// instance.
   /// \param[in] state The state to free.
   void freeState(::ompl::base::State* state) const override;
 
@@ -174,6 +178,10 @@ private:
 
   /// Collision checking resolution.
   double mMaxDistanceBetweenValidityChecks;
+
+  /// Pool backing the StateType wrappers returned by allocState. It shrinks
+  /// back to a single slab whenever every wrapper has been freed.
+  mutable common::FixedSizePool mStateTypePool;
 };
 
 } // namespace ompl
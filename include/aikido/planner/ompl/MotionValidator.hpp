@@ -1,14 +1,25 @@
 #ifndef AIKIDO_PLANNER_OMPL_MOTIONVALIDATOR_HPP_
 #define AIKIDO_PLANNER_OMPL_MOTIONVALIDATOR_HPP_
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <ompl/base/MotionValidator.h>
 
+#include "aikido/common/ThreadPool.hpp"
+#include "aikido/constraint/Testable.hpp"
+
 namespace aikido {
 namespace planner {
 namespace ompl {
 
 /// Implement an OMPL MotionValidator.  This class checks the validity
-///  of path segments between states.
+///  of path segments between states. Samples along a segment are interpolated
+///  and tested in small chunks of consecutive samples, in coarse-to-fine
+///  order, so that an aikido StateValidityChecker can test each chunk with
+///  one call to \c constraint::Testable::isSatisfiedBatch.
 class MotionValidator : public ::ompl::base::MotionValidator
 {
 public:
@@ -22,6 +33,49 @@ public:
       const ::ompl::base::SpaceInformationPtr& _si,
       double _maxDistBtwValidityChecks);
 
+  /// Constructs a validator that checks the samples on each segment in
+  /// parallel, with one worker per element of \c _workerConstraints.
+  ///
+  /// The thread that calls \c checkMotion acts as one worker, and tasks
+  /// submitted to \c _threadPool act as the others. The workers take chunks
+  /// of the coarse-to-fine sample sequence in order, and all of them stop as
+  /// soon as any sample is found to be invalid. Each worker tests its chunks
+  /// against its own constraint, which is used by one thread at a time but
+  /// possibly by different threads over its lifetime. Each must therefore
+  /// operate on its own state, e.g. a \c CollisionFree constraint built on a
+  /// cloned MetaSkeleton and its own CollisionDetector. They should be
+  /// equivalent to the StateValidityChecker of \c _si, which is not used to
+  /// check segments.
+  ///
+  /// Concurrent calls to \c checkMotion share the workers: each call waits
+  /// for one idle worker and is helped by any other worker that is idle.
+  /// A call never waits for a helper task that has not started; once the
+  /// calling thread runs out of samples, such tasks are cancelled. It is
+  /// therefore safe to call \c checkMotion from a thread of \c _threadPool,
+  /// or while all of its threads are busy.
+  ///
+  /// \param _si The SpaceInformation describing the planning space where this
+  /// MotionValidator will be used
+  /// \param _maxDistBtwValidityChecks The maximum distance (under the distance
+  /// metric defined on the planning StateSpace) between two points on the
+  /// segment checked for validity
+  /// \param _workerConstraints One constraint per worker
+  /// \param _threadPool Pool that runs the helper tasks, which may be shared
+  /// with other validators. If nullptr, the validator creates a pool with one
+  /// thread per worker other than the calling thread.
+  MotionValidator(
+      const ::ompl::base::SpaceInformationPtr& _si,
+      double _maxDistBtwValidityChecks,
+      std::vector<constraint::ConstTestablePtr> _workerConstraints,
+      std::shared_ptr<common::ThreadPool> _threadPool = nullptr);
+
+  ~MotionValidator() override;
+
+  /// Returns the number of workers that check each segment in parallel, or
+  /// zero if segments are checked with the StateValidityChecker of the
+  /// SpaceInformation.
+  std::size_t getNumWorkers() const;
+
   /// Check if the path between two states, _s1 and _s2, is valid.  This
   /// function assumes _s1 is valid.
   /// \param _s1 The state at the start of the segment
@@ -44,7 +98,43 @@ public:
       std::pair<::ompl::base::State*, double>& _lastValid) const override;
 
 private:
+  /// Constraint of a worker and the storage it uses to interpolate samples.
+  struct Worker;
+
+  /// Returns the number of leading samples of \c _sequence along the segment
+  /// from \c _s1 to \c _s2 that are valid, checking them with the workers.
+  /// If \c _stopAtAnyFailure is true, the result is only guaranteed to be
+  /// less than the number of samples when any of them is invalid.
+  template <class Sequence>
+  std::size_t countLeadingValidSamplesInParallel(
+      const ::ompl::base::State* _s1,
+      const ::ompl::base::State* _s2,
+      const Sequence& _sequence,
+      bool _stopAtAnyFailure) const;
+
+  /// Takes an idle worker, waiting for one if \c _wait is true. Returns
+  /// nullptr if \c _wait is false and no worker is idle.
+  Worker* acquireWorker(bool _wait) const;
+
+  /// Returns a worker taken by \c acquireWorker.
+  void releaseWorker(Worker* _worker) const;
+
   double mSequenceResolution;
+
+  /// Workers, if segments are checked in parallel.
+  std::vector<std::unique_ptr<Worker>> mWorkers;
+
+  /// Runs helper tasks; null unless \c mWorkers has more than one element.
+  std::shared_ptr<common::ThreadPool> mThreadPool;
+
+  /// Workers not used by any call to \c checkMotion.
+  mutable std::vector<Worker*> mIdleWorkers;
+
+  /// Protects \c mIdleWorkers.
+  mutable std::mutex mWorkerMutex;
+
+  /// Signaled when a worker becomes idle.
+  mutable std::condition_variable mWorkerReleased;
 };
 
 } // namespace ompl
@@ -0,0 +1,158 @@
+#ifndef AIKIDO_PLANNER_OMPL_OMPLPLANNINGCONTEXT_HPP_
+#define AIKIDO_PLANNER_OMPL_OMPLPLANNINGCONTEXT_HPP_
+
+#include <ompl/base/Planner.h>
+#include <ompl/base/PlannerTerminationCondition.h>
+#include <ompl/base/ProblemDefinition.h>
+#include <ompl/base/SpaceInformation.h>
+
+#include "aikido/constraint/Projectable.hpp"
+#include "aikido/constraint/Sampleable.hpp"
+#include "aikido/constraint/Testable.hpp"
+#include "aikido/distance/DistanceMetric.hpp"
+#include "aikido/planner/ompl/BackwardCompatibility.hpp"
+#include "aikido/statespace/Interpolator.hpp"
+#include "aikido/statespace/StateSpace.hpp"
+#include "aikido/trajectory/Interpolated.hpp"
+
+namespace aikido {
+namespace planner {
+namespace ompl {
+
+/// Persistent planning setup for issuing many queries against the same
+/// StateSpace and constraints.
+///
+/// planOMPL() creates the GeometricStateSpace, the SpaceInformation with its
+/// validity checker and motion validator, and the planner on every call. A
+/// context creates them once, together with a ProblemDefinition whose start
+/// and goal are replaced on every query, so the planner is set up only once.
+/// Multi-query planners, e.g. PRM or LazyPRM, can additionally keep their
+/// roadmap between queries.
+///
+/// The constraints are evaluated lazily, so a context remains valid when the
+/// world they check against changes. However, data kept between queries may
+/// then be stale and must be discarded with clear().
+///
+/// A context is not thread-safe; use one context per thread.
+///
+/// \tparam PlannerType The OMPL Planner to use.
+template <class PlannerType>
+class OMPLPlanningContext
+{
+public:
+  /// Constructor.
+  ///
+  /// \param _stateSpace The StateSpace that the planner must plan within
+  /// \param _interpolator An Interpolator defined on the StateSpace. This is
+  /// used to interpolate between two points within the space.
+  /// \param _dmetric A valid distance metric defined on the StateSpace
+  /// \param _sampler A Sampleable that can sample states from the
+  /// StateSpace. Warning: Many OMPL planners internally assume this sampler
+  /// samples uniformly. Care should be taken when using a non-uniform sampler.
+  /// \param _validityConstraint A constraint used to test validity during
+  /// planning. This should include collision checking and any other
+  /// constraints that must be satisfied for a state to be considered valid.
+  /// \param _boundsConstraint A constraint used to determine whether states
+  /// encountered during planning fall within any bounds specified on the
+  /// StateSpace. In addition to the _validityConstraint, this must also be
+  /// satsified for a state to be considered valid.
+  /// \param _boundsProjector A Projectable that projects a state back within
+  /// valid bounds defined on the StateSpace
+  /// \param _maxDistanceBtwValidityChecks The maximum distance (under dmetric)
+  /// between validity checking two successive points on a tree extension
+  /// \param _reusePlannerData Whether to keep the data of the planner, e.g.
+  /// the roadmap of PRM, between queries. Only meaningful for multi-query
+  /// planners that implement \c clearQuery(); the data of other planners is
+  /// always cleared.
+  OMPLPlanningContext(
+      statespace::ConstStateSpacePtr _stateSpace,
+      statespace::InterpolatorPtr _interpolator,
+      distance::DistanceMetricPtr _dmetric,
+      constraint::SampleablePtr _sampler,
+      constraint::TestablePtr _validityConstraint,
+      constraint::TestablePtr _boundsConstraint,
+      constraint::ProjectablePtr _boundsProjector,
+      double _maxDistanceBtwValidityChecks,
+      bool _reusePlannerData = false);
+
+  /// Plans a trajectory that moves from the start to the goal state. Returns
+  /// nullptr on planning failure.
+  /// \param _start The start state
+  /// \param _goal The goal state
+  /// \param _maxPlanTime The maximum time to allow the planner to search for
+  /// a solution
+  trajectory::InterpolatedPtr plan(
+      const statespace::StateSpace::State* _start,
+      const statespace::StateSpace::State* _goal,
+      double _maxPlanTime);
+
+  /// Same as above, but plans until \c _ptc evaluates to true.
+  /// \param _start The start state
+  /// \param _goal The goal state
+  /// \param _ptc Condition under which the planner stops searching for a
+  /// solution
+  trajectory::InterpolatedPtr plan(
+      const statespace::StateSpace::State* _start,
+      const statespace::StateSpace::State* _goal,
+      const ::ompl::base::PlannerTerminationCondition& _ptc);
+
+  /// Plans a trajectory that moves from the start to a goal region. Returns
+  /// nullptr on planning failure.
+  /// \param _start The start state
+  /// \param _goalTestable A Testable constraint that can determine if a given
+  /// state is a goal state
+  /// \param _goalSampler A Sampleable capable of sampling states that satisfy
+  /// _goalTestable
+  /// \param _maxPlanTime The maximum time to allow the planner to search for
+  /// a solution
+  trajectory::InterpolatedPtr plan(
+      const statespace::StateSpace::State* _start,
+      constraint::TestablePtr _goalTestable,
+      const constraint::SampleablePtr& _goalSampler,
+      double _maxPlanTime);
+
+  /// Same as above, but plans until \c _ptc evaluates to true.
+  /// \param _start The start state
+  /// \param _goalTestable A Testable constraint that can determine if a given
+  /// state is a goal state
+  /// \param _goalSampler A Sampleable capable of sampling states that satisfy
+  /// _goalTestable
+  /// \param _ptc Condition under which the planner stops searching for a
+  /// solution
+  trajectory::InterpolatedPtr plan(
+      const statespace::StateSpace::State* _start,
+      constraint::TestablePtr _goalTestable,
+      const constraint::SampleablePtr& _goalSampler,
+      const ::ompl::base::PlannerTerminationCondition& _ptc);
+
+  /// Discards the data the planner kept from previous queries, e.g. after the
+  /// environment the validity constraint checks against changed.
+  void clear();
+
+  /// Returns the planner, e.g. to set its parameters.
+  ompl_shared_ptr<PlannerType> getPlanner() const;
+
+  /// Returns the SpaceInformation shared by all queries.
+  ::ompl::base::SpaceInformationPtr getSpaceInformation() const;
+
+private:
+  /// Prepares the planner for a new query and runs it on the start and goal
+  /// of \c mProblemDefinition.
+  trajectory::InterpolatedPtr solve(
+      const ::ompl::base::PlannerTerminationCondition& _ptc);
+
+  statespace::ConstStateSpacePtr mStateSpace;
+  statespace::InterpolatorPtr mInterpolator;
+  ::ompl::base::SpaceInformationPtr mSpaceInformation;
+  ::ompl::base::ProblemDefinitionPtr mProblemDefinition;
+  ompl_shared_ptr<PlannerType> mPlanner;
+  bool mReusePlannerData;
+};
+
+} // namespace ompl
+} // namespace planner
+} // namespace aikido
+
+#include "aikido/planner/ompl/detail/OMPLPlanningContext-impl.hpp"
+
+#endif // AIKIDO_PLANNER_OMPL_OMPLPLANNINGCONTEXT_HPP_
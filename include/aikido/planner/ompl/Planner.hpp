@@ -3,6 +3,7 @@
 
 #include <chrono>
 #include <utility> // std::pair
+#include <vector>
 
 #include <ompl/base/Planner.h>
 #include <ompl/base/ProblemDefinition.h>
@@ -16,6 +17,7 @@
 #include "aikido/constraint/Testable.hpp"
 #include "aikido/distance/DistanceMetric.hpp"
 #include "aikido/planner/ompl/BackwardCompatibility.hpp"
+#include "aikido/planner/ompl/CRRT.hpp"
 #include "aikido/planner/ompl/GeometricStateSpace.hpp"
 #include "aikido/statespace/Interpolator.hpp"
 #include "aikido/statespace/StateSpace.hpp"
@@ -49,6 +51,11 @@ namespace ompl {
 /// solution
 /// \param _maxDistanceBtwValidityChecks The maximum distance (under dmetric)
 /// between validity checking two successive points on a tree extension
+/// \param _workerValidityConstraints Constraints, each equivalent to
+/// \c _validityConstraint, that let the MotionValidator check the samples of
+/// each segment in parallel, one thread per constraint. Each must operate on
+/// its own state, e.g. a CollisionFree constraint on a cloned MetaSkeleton
+/// with its own CollisionDetector. If empty, segments are checked serially.
 template <class PlannerType>
 trajectory::InterpolatedPtr planOMPL(
     const statespace::StateSpace::State* _start,
@@ -61,7 +68,9 @@ trajectory::InterpolatedPtr planOMPL(
     constraint::TestablePtr _boundsConstraint,
     constraint::ProjectablePtr _boundsProjector,
     double _maxPlanTime,
-    double _maxDistanceBtwValidityChecks);
+    double _maxDistanceBtwValidityChecks,
+    std::vector<constraint::TestablePtr> _workerValidityConstraints
+    = std::vector<constraint::TestablePtr>());
 
 /// Use the template OMPL Planner type to plan a trajectory that moves from the
 /// start to a goal region. Returns nullptr on planning failure.
@@ -90,6 +99,11 @@ trajectory::InterpolatedPtr planOMPL(
 /// solution
 /// \param _maxDistanceBtwValidityChecks The maximum distance (under dmetric)
 /// between validity checking two successive points on a tree extension
+/// \param _workerValidityConstraints Constraints, each equivalent to
+/// \c _validityConstraint, that let the MotionValidator check the samples of
+/// each segment in parallel, one thread per constraint. Each must operate on
+/// its own state, e.g. a CollisionFree constraint on a cloned MetaSkeleton
+/// with its own CollisionDetector. If empty, segments are checked serially.
 template <class PlannerType>
 trajectory::InterpolatedPtr planOMPL(
     const statespace::StateSpace::State* _start,
@@ -103,7 +117,9 @@ trajectory::InterpolatedPtr planOMPL(
     constraint::TestablePtr _boundsConstraint,
     constraint::ProjectablePtr _boundsProjector,
     double _maxPlanTime,
-    double _maxDistanceBtwValidityChecks);
+    double _maxDistanceBtwValidityChecks,
+    std::vector<constraint::TestablePtr> _workerValidityConstraints
+    = std::vector<constraint::TestablePtr>());
 
 /// Use the CRRT planner to plan a trajectory that moves from the
 /// start to a goal region while respecting a constraint
@@ -138,6 +154,9 @@ trajectory::InterpolatedPtr planOMPL(
 /// extension
 /// \param _minStepsize The minimum distance between two states for the them to
 /// be considered "different"
+/// \param _workerConstraints Constraints of each worker thread that extends
+/// the tree. If empty, the tree is extended on the calling thread. See
+/// CRRT::setWorkerConstraints().
 trajectory::InterpolatedPtr planCRRT(
     const statespace::StateSpace::State* _start,
     constraint::TestablePtr _goalTestable,
@@ -153,7 +172,9 @@ trajectory::InterpolatedPtr planCRRT(
     double _maxPlanTime,
     double _maxExtensionDistance,
     double _maxDistanceBtwProjections,
-    double _minStepsize);
+    double _minStepsize,
+    std::vector<CRRT::WorkerConstraints> _workerConstraints
+    = std::vector<CRRT::WorkerConstraints>());
 
 /// Use the CRRT planner to plan a trajectory that moves from the
 /// start to a goal region while respecting a constraint
@@ -190,6 +211,9 @@ trajectory::InterpolatedPtr planCRRT(
 /// goal tree to consider them connected
 /// \param _minStepsize The minimum distance between two states for the them to
 /// be considered "different"
+/// \param _workerConstraints Constraints of each worker thread that extends
+/// the trees. If empty, the trees are extended on the calling thread. See
+/// CRRT::setWorkerConstraints().
 trajectory::InterpolatedPtr planCRRTConnect(
     const statespace::StateSpace::State* _start,
     constraint::TestablePtr _goalTestable,
@@ -206,7 +230,9 @@ trajectory::InterpolatedPtr planCRRTConnect(
     double _maxExtensionDistance,
     double _maxDistanceBtwProjections,
     double _minStepsize,
-    double _minTreeConnectionDistance);
+    double _minTreeConnectionDistance,
+    std::vector<CRRT::WorkerConstraints> _workerConstraints
+    = std::vector<CRRT::WorkerConstraints>());
 
 /// Generate an OMPL SpaceInformation from aikido components
 /// \param _stateSpace The StateSpace that the SpaceInformation operates on
@@ -227,6 +253,11 @@ trajectory::InterpolatedPtr planCRRTConnect(
 /// valid bounds defined on the StateSpace
 /// \param _maxDistanceBtwValidityChecks The maximum distance (under dmetric)
 /// between validity checking two successive points on a tree extension
+/// \param _workerValidityConstraints Constraints, each equivalent to
+/// \c _validityConstraint, that let the MotionValidator check the samples of
+/// each segment in parallel, one thread per constraint. Each must operate on
+/// its own state, e.g. a CollisionFree constraint on a cloned MetaSkeleton
+/// with its own CollisionDetector. If empty, segments are checked serially.
 ::ompl::base::SpaceInformationPtr getSpaceInformation(
     statespace::ConstStateSpacePtr _stateSpace,
     statespace::InterpolatorPtr _interpolator,
@@ -235,7 +266,9 @@ trajectory::InterpolatedPtr planCRRTConnect(
     constraint::TestablePtr _validityConstraint,
     constraint::TestablePtr _boundsConstraint,
     constraint::ProjectablePtr _boundsProjector,
-    double _maxDistanceBtwValidityChecks);
+    double _maxDistanceBtwValidityChecks,
+    std::vector<constraint::TestablePtr> _workerValidityConstraints
+    = std::vector<constraint::TestablePtr>());
 
 /// Create an OMPL GoalRegion from a Testable and Sampler that describe the goal
 /// region
@@ -268,6 +301,25 @@ trajectory::InterpolatedPtr planOMPL(
     statespace::InterpolatorPtr _interpolator,
     double _maxPlanTime);
 
+/// Same as above, but plans until \c _ptc evaluates to true. This allows the
+/// caller to stop planning early, e.g. when another thread already found a
+/// solution.
+/// \param _planner Points to some OMPL planner.
+/// \param _pdef The ProblemDefintion. This contains start and goal conditions
+/// for the planner.
+/// \param _sspace The aikido StateSpace to plan against. Used for constructing
+/// the return trajectory.
+/// \param _interpolator An aikido interpolator that can be used with the
+/// _stateSpace.
+/// \param _ptc Condition under which the planner stops searching for a
+/// solution
+trajectory::InterpolatedPtr planOMPL(
+    const ::ompl::base::PlannerPtr& _planner,
+    const ::ompl::base::ProblemDefinitionPtr& _pdef,
+    statespace::ConstStateSpacePtr _sspace,
+    statespace::InterpolatorPtr _interpolator,
+    const ::ompl::base::PlannerTerminationCondition& _ptc);
+
 /// Take in an aikido trajectory and simplify it using OMPL methods
 /// \param _stateSpace The StateSpace that the planner must plan within
 /// \param _interpolator An Interpolator defined on the StateSpace. This is used
@@ -1,6 +1,8 @@
 #ifndef AIKIDO_OMPL_AIKIDOSTATEVALIDITYCHECKER_HPP_
 #define AIKIDO_OMPL_AIKIDOSTATEVALIDITYCHECKER_HPP_
 
+#include <vector>
+
 #include <ompl/base/SpaceInformation.h>
 #include <ompl/base/StateValidityChecker.h>
 
@@ -32,6 +34,21 @@ public:
   /// \param _state The state to check
   bool isValid(const ::ompl::base::State* _state) const override;
 
+  /// Checks a batch of states with a single call to
+  /// \c constraint::Testable::isSatisfiedBatch. A state is invalid if it is
+  /// null, holds no aikido state, or is marked invalid.
+  ///
+  /// \param _states states to check
+  /// \param[out] _valid per-state results; see
+  /// \c constraint::Testable::isSatisfiedBatch for their meaning in each mode
+  /// \param _mode whether to stop at the first invalid state
+  /// \return true if every state is valid
+  bool areValid(
+      const std::vector<const ::ompl::base::State*>& _states,
+      std::vector<bool>& _valid,
+      constraint::Testable::BatchMode _mode
+      = constraint::Testable::BatchMode::FirstFailure) const;
+
 private:
   constraint::TestablePtr mConstraint;
 };
@@ -0,0 +1,237 @@
+#ifndef AIKIDO_PLANNER_OMPL_DETAIL_OMPLPLANNINGCONTEXT_IMPL_HPP_
+#define AIKIDO_PLANNER_OMPL_DETAIL_OMPLPLANNINGCONTEXT_IMPL_HPP_
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <ompl/base/ProblemDefinition.h>
+#include <ompl/geometric/PathGeometric.h>
+
+#include "aikido/planner/ompl/GeometricStateSpace.hpp"
+#include "aikido/planner/ompl/GoalRegion.hpp"
+#include "aikido/planner/ompl/OMPLPlanningContext.hpp"
+#include "aikido/planner/ompl/Planner.hpp"
+
+namespace aikido {
+namespace planner {
+namespace ompl {
+namespace detail {
+
+//==============================================================================
+/// Whether \c PlannerType can discard its query-specific data only.
+template <class PlannerType, class = void>
+struct HasClearQuery : std::false_type
+{
+};
+
+//==============================================================================
+template <class PlannerType>
+struct HasClearQuery<
+    PlannerType,
+    decltype(std::declval<PlannerType&>().clearQuery(), void())>
+  : std::true_type
+{
+};
+
+//==============================================================================
+template <class PlannerType>
+void clearQuery(PlannerType& _planner, std::true_type)
+{
+  _planner.clearQuery();
+}
+
+//==============================================================================
+template <class PlannerType>
+void clearQuery(PlannerType& _planner, std::false_type)
+{
+  _planner.clear();
+}
+
+} // namespace detail
+
+//==============================================================================
+template <class PlannerType>
+OMPLPlanningContext<PlannerType>::OMPLPlanningContext(
+    statespace::ConstStateSpacePtr _stateSpace,
+    statespace::InterpolatorPtr _interpolator,
+    distance::DistanceMetricPtr _dmetric,
+    constraint::SampleablePtr _sampler,
+    constraint::TestablePtr _validityConstraint,
+    constraint::TestablePtr _boundsConstraint,
+    constraint::ProjectablePtr _boundsProjector,
+    double _maxDistanceBtwValidityChecks,
+    bool _reusePlannerData)
+  : mStateSpace(_stateSpace)
+  , mInterpolator(_interpolator)
+  , mSpaceInformation(ompl::getSpaceInformation(
+        std::move(_stateSpace),
+        std::move(_interpolator),
+        std::move(_dmetric),
+        std::move(_sampler),
+        std::move(_validityConstraint),
+        std::move(_boundsConstraint),
+        std::move(_boundsProjector),
+        _maxDistanceBtwValidityChecks))
+  , mProblemDefinition(
+        ompl_make_shared<::ompl::base::ProblemDefinition>(mSpaceInformation))
+  , mPlanner(ompl_make_shared<PlannerType>(mSpaceInformation))
+  , mReusePlannerData(_reusePlannerData)
+{
+  // Done once here instead of on every query.
+  mSpaceInformation->setup();
+  mPlanner->setProblemDefinition(mProblemDefinition);
+}
+
+//==============================================================================
+template <class PlannerType>
+trajectory::InterpolatedPtr OMPLPlanningContext<PlannerType>::plan(
+    const statespace::StateSpace::State* _start,
+    const statespace::StateSpace::State* _goal,
+    double _maxPlanTime)
+{
+  return plan(
+      _start,
+      _goal,
+      ::ompl::base::timedPlannerTerminationCondition(_maxPlanTime));
+}
+
+//==============================================================================
+template <class PlannerType>
+trajectory::InterpolatedPtr OMPLPlanningContext<PlannerType>::plan(
+    const statespace::StateSpace::State* _start,
+    const statespace::StateSpace::State* _goal,
+    const ::ompl::base::PlannerTerminationCondition& _ptc)
+{
+  auto sspace = ompl_static_pointer_cast<GeometricStateSpace>(
+      mSpaceInformation->getStateSpace());
+  auto start = sspace->allocState(_start);
+  auto goal = sspace->allocState(_goal);
+
+  // ProblemDefinition clones states and keeps them internally
+  mProblemDefinition->setStartAndGoalStates(start, goal);
+
+  sspace->freeState(start);
+  sspace->freeState(goal);
+
+  return solve(_ptc);
+}
+
+//==============================================================================
+template <class PlannerType>
+trajectory::InterpolatedPtr OMPLPlanningContext<PlannerType>::plan(
+    const statespace::StateSpace::State* _start,
+    constraint::TestablePtr _goalTestable,
+    const constraint::SampleablePtr& _goalSampler,
+    double _maxPlanTime)
+{
+  return plan(
+      _start,
+      std::move(_goalTestable),
+      _goalSampler,
+      ::ompl::base::timedPlannerTerminationCondition(_maxPlanTime));
+}
+
+//==============================================================================
+template <class PlannerType>
+trajectory::InterpolatedPtr OMPLPlanningContext<PlannerType>::plan(
+    const statespace::StateSpace::State* _start,
+    constraint::TestablePtr _goalTestable,
+    const constraint::SampleablePtr& _goalSampler,
+    const ::ompl::base::PlannerTerminationCondition& _ptc)
+{
+  if (_goalTestable == nullptr)
+  {
+    throw std::invalid_argument("Testable goal is nullptr.");
+  }
+
+  if (_goalSampler == nullptr)
+  {
+    throw std::invalid_argument("Sampleable goal is nullptr.");
+  }
+
+  if (_goalTestable->getStateSpace() != mStateSpace)
+  {
+    throw std::invalid_argument("Testable goal does not match StateSpace");
+  }
+
+  if (_goalSampler->getStateSpace() != mStateSpace)
+  {
+    throw std::invalid_argument("Sampleable goal does not match StateSpace");
+  }
+
+  auto sspace = ompl_static_pointer_cast<GeometricStateSpace>(
+      mSpaceInformation->getStateSpace());
+  auto start = sspace->allocState(_start);
+  mProblemDefinition->clearStartStates();
+  mProblemDefinition->addStartState(start); // copies
+  sspace->freeState(start);
+
+  auto goalRegion = ompl_make_shared<GoalRegion>(
+      mSpaceInformation,
+      std::move(_goalTestable),
+      _goalSampler->createSampleGenerator());
+  mProblemDefinition->setGoal(goalRegion);
+
+  return solve(_ptc);
+}
+
+//==============================================================================
+template <class PlannerType>
+void OMPLPlanningContext<PlannerType>::clear()
+{
+  mPlanner->clear();
+}
+
+//==============================================================================
+template <class PlannerType>
+ompl_shared_ptr<PlannerType> OMPLPlanningContext<PlannerType>::getPlanner()
+    const
+{
+  return mPlanner;
+}
+
+//==============================================================================
+template <class PlannerType>
+::ompl::base::SpaceInformationPtr
+OMPLPlanningContext<PlannerType>::getSpaceInformation() const
+{
+  return mSpaceInformation;
+}
+
+//==============================================================================
+template <class PlannerType>
+trajectory::InterpolatedPtr OMPLPlanningContext<PlannerType>::solve(
+    const ::ompl::base::PlannerTerminationCondition& _ptc)
+{
+  mProblemDefinition->clearSolutionPaths();
+
+  if (mReusePlannerData)
+    detail::clearQuery(*mPlanner, detail::HasClearQuery<PlannerType>());
+  else
+    mPlanner->clear();
+
+  // The planner keeps using mProblemDefinition, so it is set up only once.
+  if (!mPlanner->isSetup())
+    mPlanner->setup();
+
+  if (!mPlanner->solve(_ptc))
+    return nullptr;
+
+  auto path = ompl_dynamic_pointer_cast<::ompl::geometric::PathGeometric>(
+      mProblemDefinition->getSolutionPath());
+  if (!path)
+  {
+    throw std::invalid_argument(
+        "Path is not of type PathGeometric. Cannot convert to aikido "
+        "Trajectory");
+  }
+
+  return toInterpolatedTrajectory(*path, mInterpolator);
+}
+
+} // namespace ompl
+} // namespace planner
+} // namespace aikido
+
+#endif // AIKIDO_PLANNER_OMPL_DETAIL_OMPLPLANNINGCONTEXT_IMPL_HPP_
@@ -0,0 +1,164 @@
+#ifndef AIKIDO_PLANNER_TOPPRA_TOPPRARETIMER_HPP_
+#define AIKIDO_PLANNER_TOPPRA_TOPPRARETIMER_HPP_
+
+#include <Eigen/Dense>
+#include <dart/dynamics/MetaSkeleton.hpp>
+
+#include "aikido/planner/TrajectoryPostProcessor.hpp"
+#include "aikido/trajectory/Interpolated.hpp"
+#include "aikido/trajectory/Spline.hpp"
+
+namespace aikido {
+namespace planner {
+namespace toppra {
+
+/// Computes the time-optimal timing of a trajectory consisting of a sequence
+/// Geodesic interpolations between states under velocity and acceleration
+/// bounds, and optionally under the joint torque bounds of a \c MetaSkeleton,
+/// using Time-Optimal Path Parameterization based on Reachability Analysis
+/// (TOPP-RA). The output is a spline, encoded in cubic polynomials.
+///
+/// Like \c computeKunzTiming, it first preprocesses the non-differentiable
+/// path into a differentiable one by adding circular blends around the
+/// waypoints. The path is then discretized into a grid. A backward pass
+/// computes the range of squared path velocities at each grid point from
+/// which the end of the path can be reached, and a forward pass greedily picks
+/// the maximum path acceleration that stays within those ranges. Each grid
+/// point only requires solving a two-dimensional linear program, so retiming
+/// takes time linear in the number of grid points.
+///
+/// This function curently only supports \c RealVector, \c SO2, and compound
+/// state spaces of those types. Additionally, this function requires that
+/// \c inputTrajectory to be interpolated using a \c GeodesicInterpolator.
+///
+/// \param[in] inputTrajectory Input piecewise Geodesic trajectory
+/// \param[in] maxVelocity Maximum velocity for each dimension
+/// \param[in] maxAcceleration Maximum acceleration for each dimension
+/// \param[in] maxDeviation Maximum deviation from a waypoint in doing circular
+/// blending around the waypoint
+/// \param[in] numGridPoints Number of uniformly spaced grid points. The ends of
+/// the blends are always added to the grid.
+/// \param[in] metaSkeleton If not nullptr, the joint torques required to
+/// follow the trajectory, computed with the dynamics of \c metaSkeleton, are
+/// kept within its force limits. Its degrees of freedom must match the
+/// dimensions of the state space. Its state is restored before returning.
+/// \return Time optimal trajectory that satisfies the constraints
+/// \throw If the limits are not positive and finite, or if \c metaSkeleton
+/// does not match the state space.
+/// \throw std::runtime_error If the path cannot be followed within the limits.
+std::unique_ptr<aikido::trajectory::Spline> computeToppraTiming(
+    const aikido::trajectory::Interpolated& inputTrajectory,
+    const Eigen::VectorXd& maxVelocity,
+    const Eigen::VectorXd& maxAcceleration,
+    double maxDeviation = 1e-2,
+    std::size_t numGridPoints = 1000,
+    const ::dart::dynamics::MetaSkeletonPtr& metaSkeleton = nullptr);
+
+/// Computes the time-optimal timing of the path traced by a spline trajectory
+/// with TOPP-RA. The path is followed \b exactly, so the input spline must be
+/// twice differentiable for the acceleration and torque bounds to be met
+/// between grid points.
+///
+/// \param[in] inputTrajectory Input spline trajectory
+/// \param[in] maxVelocity Maximum velocity for each dimension
+/// \param[in] maxAcceleration Maximum acceleration for each dimension
+/// \param[in] numGridPoints Number of uniformly spaced grid points. The
+/// waypoints of the spline are always added to the grid.
+/// \param[in] metaSkeleton If not nullptr, the joint torques are kept within
+/// its force limits as in the overload above.
+/// \return Time optimal trajectory that satisfies the constraints
+/// \throw If the limits are not positive and finite, or if \c metaSkeleton
+/// does not match the state space.
+/// \throw std::runtime_error If the path cannot be followed within the limits.
+std::unique_ptr<aikido::trajectory::Spline> computeToppraTiming(
+    const aikido::trajectory::Spline& inputTrajectory,
+    const Eigen::VectorXd& maxVelocity,
+    const Eigen::VectorXd& maxAcceleration,
+    std::size_t numGridPoints = 1000,
+    const ::dart::dynamics::MetaSkeletonPtr& metaSkeleton = nullptr);
+
+/// Class for performing time-optimal trajectory retiming with TOPP-RA subject
+/// to velocity, acceleration and, optionally, torque limits.
+class ToppraRetimer : public aikido::planner::TrajectoryPostProcessor
+{
+public:
+  /// \param[in] velocityLimits Maximum velocity for each dimension.
+  /// \param[in] accelerationLimits Maximum acceleration for each dimension.
+  /// \param[in] maxDeviation Maximum deviation in circular blending
+  /// \param[in] numGridPoints Number of grid points along the path
+  /// \param[in] metaSkeleton If not nullptr, the force limits of this
+  /// metaskeleton are enforced as well.
+  ToppraRetimer(
+      const Eigen::VectorXd& velocityLimits,
+      const Eigen::VectorXd& accelerationLimits,
+      double maxDeviation = 1e-2,
+      std::size_t numGridPoints = 1000,
+      ::dart::dynamics::MetaSkeletonPtr metaSkeleton = nullptr);
+
+  /// Performs TOPP-RA retiming on an input trajectory.
+  /// \copydoc TrajectoryPostProcessor::postprocess
+  std::unique_ptr<aikido::trajectory::Spline> postprocess(
+      const aikido::trajectory::Interpolated& inputTraj,
+      const aikido::common::RNG& rng,
+      const aikido::constraint::TestablePtr& constraint = nullptr) override;
+
+  /// Performs TOPP-RA retiming on an input *spline* trajectory.
+  /// \copydoc TrajectoryPostProcessor::postprocess
+  std::unique_ptr<aikido::trajectory::Spline> postprocess(
+      const aikido::trajectory::Spline& inputTraj,
+      const aikido::common::RNG& rng,
+      const aikido::constraint::TestablePtr& constraint = nullptr) override;
+
+  /// Returns the velocity limits of the dimensions
+  const Eigen::VectorXd& getVelocityLimits() const;
+
+  /// Returns the acceleration limits of the dimensions
+  const Eigen::VectorXd& getAccelerationLimits() const;
+
+  /// Sets the velocity limits of the dimensions
+  void setVelocityLimits(const Eigen::VectorXd& velocityLimits);
+
+  /// Sets the acceleration limits of the dimensions
+  void setAccelerationLimits(const Eigen::VectorXd& accelerationLimits);
+
+  /// Returns the max deviation of circular blending
+  double getMaxDeviation() const;
+
+  /// Sets the max deviation of circular blending
+  void setMaxDeviation(double maxDeviation);
+
+  /// Returns the number of grid points along the path
+  std::size_t getNumGridPoints() const;
+
+  /// Sets the number of grid points along the path
+  void setNumGridPoints(std::size_t numGridPoints);
+
+  /// Returns the metaskeleton whose force limits are enforced, if any
+  ::dart::dynamics::MetaSkeletonPtr getMetaSkeleton() const;
+
+  /// Sets the metaskeleton whose force limits are enforced, or nullptr to
+  /// ignore torques
+  void setMetaSkeleton(::dart::dynamics::MetaSkeletonPtr metaSkeleton);
+
+private:
+  /// Set to the value of \c velocityLimits.
+  Eigen::VectorXd mVelocityLimits;
+
+  /// Set to the value of \c accelerationLimits.
+  Eigen::VectorXd mAccelerationLimits;
+
+  /// Set to the value of \c maxDeviation
+  double mMaxDeviation;
+
+  /// Set to the value of \c numGridPoints
+  std::size_t mNumGridPoints;
+
+  /// Set to the value of \c metaSkeleton
+  ::dart::dynamics::MetaSkeletonPtr mMetaSkeleton;
+};
+
+} // namespace toppra
+} // namespace planner
+} // namespace aikido
+
+#endif // ifndef AIKIDO_PLANNER_TOPPRA_TOPPRARETIMER_HPP_
@@ -1,8 +1,12 @@
 #ifndef AIKIDO_PLANNER_VECTORFIELD_BODYNODEPOSEVECTORFIELD_HPP_
 #define AIKIDO_PLANNER_VECTORFIELD_BODYNODEPOSEVECTORFIELD_HPP_
 
+#include <mutex>
+
 #include <dart/dynamics/BodyNode.hpp>
 
+#include "aikido/common/BoundedLeastSquares.hpp"
+#include "aikido/common/PseudoInverse.hpp"
 #include "aikido/planner/vectorfield/VectorField.hpp"
 #include "aikido/statespace/dart/MetaSkeletonStateSpace.hpp"
 
@@ -44,7 +48,11 @@ public:
       double jointLimitPadding,
       bool enforceJointVelocityLimits = false);
 
-  // Documentation inherited.
+  /// Documentation inherited.
+  ///
+  /// Calls that do not overlap in time share one joint velocity solver and
+  /// least-squares workspace. A call made while another is in progress uses
+  /// its own instead, so concurrent calls do not share solver storage.
   bool evaluateVelocity(
       const aikido::statespace::StateSpace::State* state,
       Eigen::VectorXd& qd) const override;
@@ -114,6 +122,13 @@ protected:
 
   /// Enfoce joint velocity limits
   bool mEnforceJointVelocityLimits;
+
+  /// Solvers for joint velocities with and without velocity limits, shared
+  /// by evaluateVelocity() calls that do not overlap in time.
+  mutable common::BoundedLeastSquares mJointVelocitySolver;
+  mutable common::LeastSquaresWorkspace<6, Eigen::Dynamic>
+      mJointVelocityWorkspace;
+  mutable std::mutex mJointVelocitySolverMutex;
 };
 
 } // namespace vectorfield
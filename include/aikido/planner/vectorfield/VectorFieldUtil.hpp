@@ -3,6 +3,8 @@
 
 #include <dart/dynamics/BodyNode.hpp>
 
+#include "aikido/common/BoundedLeastSquares.hpp"
+#include "aikido/common/PseudoInverse.hpp"
 #include "aikido/common/Spline.hpp"
 #include "aikido/statespace/dart/MetaSkeletonStateSpace.hpp"
 #include "aikido/trajectory/Interpolated.hpp"
@@ -14,7 +16,9 @@ namespace vectorfield {
 
 /// Compute joint velocity from a given twist.
 ///
-/// \param[out] jointVelocity Calculated joint velocities.
+/// \param[in,out] jointVelocity Calculated joint velocities. If joint velocity
+/// limits are enforced and it holds one finite velocity per DOF on input,
+/// e.g. the result of the previous call, it warm-starts the solver.
 /// \param[in] desiredTwist Desired twist, which consists of angular velocity
 /// and linear velocity.
 /// \param[in] metaSkeleton MetaSkeleton to plan with
@@ -28,6 +32,12 @@ namespace vectorfield {
 /// \param[in] stepSize Step size in second. It is used in evaluating
 /// position bounds violation. It assumes that whether moving the time of
 /// stepSize by maximum joint velocity will reach the limit.
+/// \param[in] solver Solver used when joint velocity limits are enforced.
+/// Passing the same solver to repeated calls reuses its storage. If nullptr, a
+/// temporary solver is used.
+/// \param[in] workspace Workspace used when joint velocity limits are not
+/// enforced. Passing the same workspace to repeated calls reuses its storage.
+/// If nullptr, a temporary workspace is used.
 /// \return Whether a joint velocity is found
 bool computeJointVelocityFromTwist(
     Eigen::VectorXd& jointVelocity,
@@ -38,7 +48,9 @@ bool computeJointVelocityFromTwist(
     const Eigen::VectorXd& jointVelocityLowerLimits,
     const Eigen::VectorXd& jointVelocityUpperLimits,
     bool enforceJointVelocityLimits,
-    double stepSize);
+    double stepSize,
+    common::BoundedLeastSquares* solver = nullptr,
+    common::LeastSquaresWorkspace<6, Eigen::Dynamic>* workspace = nullptr);
 
 /// Compute the twist in global coordinate that corresponds to the gradient of
 /// the geodesic distance between two transforms.
@@ -49,6 +49,14 @@ public:
       double maxDeviation,
       double timestep) override;
 
+  // Documentation inherited.
+  virtual std::unique_ptr<aikido::trajectory::Spline> retimePathWithToppra(
+      const dart::dynamics::MetaSkeletonPtr& metaSkeleton,
+      const aikido::trajectory::Trajectory* path,
+      double maxDeviation,
+      std::size_t numGridPoints,
+      bool enforceTorqueLimits) override;
+
   // Documentation inherited.
   virtual std::future<void> executeTrajectory(
       const trajectory::TrajectoryPtr& trajectory) const override;
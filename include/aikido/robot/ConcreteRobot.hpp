@@ -71,6 +71,14 @@ public:
       double maxDeviation,
       double timestep) override;
 
+  // Documentation inherited.
+  virtual std::unique_ptr<aikido::trajectory::Spline> retimePathWithToppra(
+      const dart::dynamics::MetaSkeletonPtr& metaSkeleton,
+      const aikido::trajectory::Trajectory* path,
+      double maxDeviation,
+      std::size_t numGridPoints,
+      bool enforceTorqueLimits) override;
+
   // Documentation inherited.
   virtual std::future<void> executeTrajectory(
       const trajectory::TrajectoryPtr& trajectory) const override;
@@ -203,6 +211,11 @@ public:
   /// \param[in] maxNumTrials Max numer of trials to plan.
   /// \param[in] ranker Ranker to rank the sampled configurations. If nullptr,
   /// NominalConfigurationRanker is used with the current metaSkeleton pose.
+  /// \param[in] numThreads Number of threads to plan with. See
+  /// \c util::planToTSR.
+  /// \param[in] createWorkerCollisionTestable Creates the full collision
+  /// constraint, including self-collision, of each thread's copy of the robot.
+  /// See \c util::planToTSR.
   /// \return Trajectory to a sample in TSR, or nullptr if planning fails.
   aikido::trajectory::TrajectoryPtr planToTSR(
       const aikido::statespace::dart::MetaSkeletonStateSpacePtr& stateSpace,
@@ -212,7 +225,10 @@ public:
       const aikido::constraint::dart::CollisionFreePtr& collisionFree,
       double timelimit,
       std::size_t maxNumTrials,
-      const distance::ConstConfigurationRankerPtr& ranker = nullptr);
+      const distance::ConstConfigurationRankerPtr& ranker = nullptr,
+      std::size_t numThreads = 1,
+      const util::CollisionTestableFactory& createWorkerCollisionTestable
+      = nullptr);
 
   /// TODO: Replace this with Problem interface.
   /// Returns a Trajectory that moves the configuration of the metakeleton such
@@ -225,6 +241,11 @@ public:
   /// \param[in] constraintTsr The constraint TSR for the trajectory
   /// \param[in] collisionFree Collision constraint
   /// \param[in] timelimit Max time (seconds) to spend per planning to each IK
+  /// \param[in] numThreads Number of threads to plan with. See
+  /// \c util::planToTSRwithTrajectoryConstraint.
+  /// \param[in] createWorkerCollisionTestable Creates the full collision
+  /// constraint, including self-collision, of each thread's copy of the robot.
+  /// See \c util::planToTSRwithTrajectoryConstraint.
   /// \return Trajectory to a sample in TSR, or nullptr if planning fails.
   aikido::trajectory::TrajectoryPtr planToTSRwithTrajectoryConstraint(
       const aikido::statespace::dart::MetaSkeletonStateSpacePtr& stateSpace,
@@ -233,7 +254,10 @@ public:
       const aikido::constraint::dart::TSRPtr& goalTsr,
       const aikido::constraint::dart::TSRPtr& constraintTsr,
       const aikido::constraint::dart::CollisionFreePtr& collisionFree,
-      double timelimit);
+      double timelimit,
+      std::size_t numThreads = 1,
+      const util::CollisionTestableFactory& createWorkerCollisionTestable
+      = nullptr);
 
   /// Plans to a named configuration.
   /// \param[in] name Name of the configuration to plan to
@@ -59,6 +59,22 @@ public:
       double timestep)
       = 0;
 
+  /// Returns a timed trajectory computed with ToppraRetimer
+  /// \param[in] metaSkeleton Metaskeleton of the path.
+  /// \param[in] path Geometric path to execute.
+  /// \param[in] maxDeviation Maximum deviation allowed from original path.
+  /// \param[in] numGridPoints Number of grid points along the path.
+  /// \param[in] enforceTorqueLimits Whether the force limits of
+  /// \c metaSkeleton are enforced in addition to its velocity and
+  /// acceleration limits.
+  virtual std::unique_ptr<aikido::trajectory::Spline> retimePathWithToppra(
+      const dart::dynamics::MetaSkeletonPtr& metaSkeleton,
+      const aikido::trajectory::Trajectory* path,
+      double maxDeviation,
+      std::size_t numGridPoints,
+      bool enforceTorqueLimits)
+      = 0;
+
   /// Executes a trajectory
   /// \param[in] trajectory Timed trajectory to execute
   virtual std::future<void> executeTrajectory(
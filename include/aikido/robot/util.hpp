@@ -1,6 +1,8 @@
 #ifndef AIKIDO_ROBOT_UTIL_HPP_
 #define AIKIDO_ROBOT_UTIL_HPP_
 
+#include <functional>
+
 #include <dart/dart.hpp>
 #include <dart/dynamics/dynamics.hpp>
 
@@ -125,6 +127,14 @@ trajectory::TrajectoryPtr planToConfigurations(
     common::RNG* rng,
     double timelimit);
 
+/// Creates the collision constraint used by one thread of \c planToTSR. The
+/// returned constraint must test \c metaSkeleton, which belongs to a copy of
+/// the robot owned by that thread, with its own CollisionDetector, so that it
+/// can be used concurrently with the constraints of the other threads.
+using CollisionTestableFactory = std::function<constraint::TestablePtr(
+    const statespace::dart::MetaSkeletonStateSpacePtr& space,
+    const dart::dynamics::MetaSkeletonPtr& metaSkeleton)>;
+
 /// Plan the configuration of the metakeleton such that
 /// the specified bodynode is set to a sample in TSR
 /// \param[in] space The StateSpace for the metaskeleton.
@@ -137,6 +147,16 @@ trajectory::TrajectoryPtr planToConfigurations(
 /// \param[in] maxNumTrials Number of retries before failure.
 /// \param[in] ranker Ranker to rank the sampled configurations. If nullptr,
 /// NominalConfigurationRanker is used with the current metaSkeleton pose.
+/// \param[in] numThreads Number of threads to plan with. If greater than one,
+/// the IK solutions are sampled concurrently, each thread using its own copy
+/// of the robot and its own RNG seeded from \c rng.
+/// \param[in] createWorkerCollisionTestable Creates the collision constraint
+/// of each thread. If set and \c numThreads is greater than one, the snap
+/// plans to the ranked IK solutions are also checked concurrently and
+/// RRTConnect plans to the \c numThreads best-ranked IK solutions race each
+/// other for up to \c timelimit seconds; the first solution found cancels the
+/// others. Otherwise the plans are checked one by one with
+/// \c collisionTestable.
 /// \return Trajectory to a sample in TSR, or nullptr if planning fails.
 trajectory::TrajectoryPtr planToTSR(
     const statespace::dart::MetaSkeletonStateSpacePtr& space,
@@ -147,7 +167,9 @@ trajectory::TrajectoryPtr planToTSR(
     common::RNG* rng,
     double timelimit,
     std::size_t maxNumTrials,
-    const distance::ConstConfigurationRankerPtr& ranker = nullptr);
+    const distance::ConstConfigurationRankerPtr& ranker = nullptr,
+    std::size_t numThreads = 1,
+    const CollisionTestableFactory& createWorkerCollisionTestable = nullptr);
 
 /// Returns a Trajectory that moves the configuration of the metakeleton such
 /// that the specified bodynode is set to a sample in a goal TSR and
@@ -161,6 +183,10 @@ trajectory::TrajectoryPtr planToTSR(
 /// \param[in] collisionTestable Testable constraint to check for collision.
 /// \param[in] timelimit Timelimit for planning
 /// \param[in] crrtParameters Parameters to use in planning.
+/// \param[in] numThreads Number of threads to grow the CRRTConnect trees with.
+/// \param[in] createWorkerCollisionTestable Creates the collision constraint
+/// of each thread, which acts on its own copy of the robot. Required for
+/// \c numThreads to have an effect.
 /// \return Trajectory to a sample in TSR, or nullptr if planning fails.
 trajectory::InterpolatedPtr planToTSRwithTrajectoryConstraint(
     const statespace::dart::MetaSkeletonStateSpacePtr& space,
@@ -170,7 +196,9 @@ trajectory::InterpolatedPtr planToTSRwithTrajectoryConstraint(
     const constraint::dart::TSRPtr& constraintTsr,
     const constraint::TestablePtr& collisionTestable,
     double timelimit,
-    const CRRTPlannerParameters& crrtParameters = CRRTPlannerParameters());
+    const CRRTPlannerParameters& crrtParameters = CRRTPlannerParameters(),
+    std::size_t numThreads = 1,
+    const CollisionTestableFactory& createWorkerCollisionTestable = nullptr);
 
 /// Plan to a desired end-effector offset with fixed orientation.
 /// \param[in] space StateSpace for the metaskeleton
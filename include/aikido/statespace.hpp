@@ -1,5 +1,6 @@
 #include "aikido/statespace/CartesianProduct.hpp"
 #include "aikido/statespace/GeodesicInterpolator.hpp"
+#include "aikido/statespace/InterpolationContext.hpp"
 #include "aikido/statespace/Interpolator.hpp"
 #include "aikido/statespace/Rn.hpp"
 #include "aikido/statespace/SE2.hpp"
@@ -98,6 +98,11 @@ public:
   typename Space::StateHandleConst getSubStateHandle(
       const State* _state, std::size_t _index) const;
 
+  /// Returns true if every subspace is an \c R<N> or \c SO2. States are then
+  /// packed arrays of \c getDimension() doubles, and the group operations of
+  /// this space are evaluated with vector arithmetic over the whole state.
+  bool isPacked() const;
+
   // Documentation inherited.
   std::size_t getStateSizeInBytes() const override;
 
@@ -152,10 +157,39 @@ public:
   /// Format: [0: ...] [1: ...] ... [n: ...]
   void print(const StateSpace::State* _state, std::ostream& _os) const override;
 
+protected:
+  /// Gets the offset, in bytes, of the \c _index-th substate from the start
+  /// of a state in this space.
+  ///
+  /// \param _index subspace index
+  /// \return offset of the substate
+  std::size_t getSubStateOffset(std::size_t _index) const;
+
 private:
+  /// Returns a view of the coordinates of \c _state. Only valid if
+  /// \c mIsPacked is true.
+  Eigen::Map<Eigen::VectorXd> getPackedValues(StateSpace::State* _state) const;
+
+  /// Returns a view of the coordinates of \c _state. Only valid if
+  /// \c mIsPacked is true.
+  Eigen::Map<const Eigen::VectorXd> getPackedValues(
+      const StateSpace::State* _state) const;
+
+  /// Wraps the SO(2) coordinates of a packed state into (-pi, pi].
+  void wrapPackedAngles(StateSpace::State* _state) const;
+
   std::vector<ConstStateSpacePtr> mSubspaces;
   std::vector<std::size_t> mOffsets;
   std::size_t mSizeInBytes;
+  std::size_t mDimension;
+
+  /// Set when every subspace is an \c R<N> or \c SO2. States are then packed
+  /// arrays of \c mDimension doubles, whose group operations are evaluated
+  /// with vector arithmetic instead of per-subspace virtual calls.
+  bool mIsPacked;
+
+  /// Indices of the SO(2) coordinates of a packed state.
+  std::vector<std::size_t> mPackedAngleIndices;
 };
 
 /// A tuple of states where the i-th state is from the i-th subspace.
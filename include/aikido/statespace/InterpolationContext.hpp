@@ -0,0 +1,97 @@
+#ifndef AIKIDO_STATESPACE_INTERPOLATIONCONTEXT_HPP_
+#define AIKIDO_STATESPACE_INTERPOLATIONCONTEXT_HPP_
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "aikido/statespace/CartesianProduct.hpp"
+#include "aikido/statespace/GeodesicInterpolator.hpp"
+#include "aikido/statespace/Interpolator.hpp"
+
+namespace aikido {
+namespace statespace {
+
+/// Reusable workspace for evaluating many points on the path between a fixed
+/// pair of states, e.g. when collision checking an edge at a fixed resolution.
+///
+/// For a \c GeodesicInterpolator the tangent vector that defines the geodesic
+/// is computed once in \c setEndpoints and the scratch states used by
+/// \c interpolate are owned by the context, so each sample performs no heap
+/// allocation. The tangent of a \c CartesianProduct that is not packed (see
+/// \c CartesianProduct::isPacked) is additionally split per subspace so that
+/// the subspaces' group operations are invoked directly; packed products use
+/// their whole-state fast path instead.
+/// Other interpolators fall back to \c Interpolator::interpolate.
+///
+/// A context is not thread-safe; use one context per thread.
+class InterpolationContext
+{
+public:
+  /// Constructs a context for \c interpolator.
+  ///
+  /// \param interpolator interpolator used to evaluate the path
+  explicit InterpolationContext(ConstInterpolatorPtr interpolator);
+
+  InterpolationContext(const InterpolationContext&) = delete;
+  InterpolationContext& operator=(const InterpolationContext&) = delete;
+
+  ~InterpolationContext();
+
+  /// Gets the interpolator this context evaluates.
+  ConstInterpolatorPtr getInterpolator() const;
+
+  /// Sets the endpoints of the path. \c from and \c to are referenced, not
+  /// copied, and must outlive every subsequent call to \c interpolate.
+  ///
+  /// \param from start state in the interpolator's state space
+  /// \param to end state in the interpolator's state space
+  void setEndpoints(
+      const StateSpace::State* from, const StateSpace::State* to);
+
+  /// Computes the state that lies at path parameter \c alpha along the path
+  /// between the endpoints set by \c setEndpoints. The memory location of
+  /// \c out must differ from the memory locations of the endpoints.
+  ///
+  /// \param alpha path parameter in the range [0, 1]
+  /// \param[out] out output interpolated state
+  void interpolate(double alpha, StateSpace::State* out);
+
+private:
+  ConstInterpolatorPtr mInterpolator;
+  ConstStateSpacePtr mStateSpace;
+
+  /// Set when the interpolator is a \c GeodesicInterpolator.
+  bool mIsGeodesic;
+
+  /// Set when the interpolator is geodesic and the space is a
+  /// \c CartesianProduct that is not packed.
+  std::shared_ptr<const CartesianProduct> mCartesianProduct;
+
+  /// Subspaces of \c mCartesianProduct, cached to avoid reference counting.
+  std::vector<ConstStateSpacePtr> mSubspaces;
+
+  const StateSpace::State* mFrom;
+  const StateSpace::State* mTo;
+
+  /// Tangent vector of the geodesic from \c mFrom to \c mTo.
+  Eigen::VectorXd mTangent;
+
+  /// Scratch storage for \c mTangent scaled by the path parameter.
+  Eigen::VectorXd mScaledTangent;
+
+  /// \c mTangent split by subspace of \c mCartesianProduct.
+  std::vector<Eigen::VectorXd> mSubspaceTangents;
+
+  /// Scratch storage for \c mSubspaceTangents scaled by the path parameter.
+  std::vector<Eigen::VectorXd> mScaledSubspaceTangents;
+
+  /// Scratch states allocated from \c mStateSpace.
+  StateSpace::State* mInverseState;
+  StateSpace::State* mRelativeState;
+};
+
+} // namespace statespace
+} // namespace aikido
+
+#endif // ifndef AIKIDO_STATESPACE_INTERPOLATIONCONTEXT_HPP_
@@ -163,6 +163,14 @@ using R3 = R<3>;
 using R6 = R<6>;
 using Rn = R<Eigen::Dynamic>;
 
+/// Returns true if \c _space is one of the \c R<N> instantiations above, whose
+/// states are packed arrays of doubles. Derived classes are assumed not to
+/// change the group operations.
+///
+/// \param _space state space to test
+/// \return whether \c _space is a real vector space
+bool isRealVectorSpace(const StateSpace* _space);
+
 } // namespace statespace
 } // namespace aikido
 
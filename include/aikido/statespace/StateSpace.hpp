@@ -2,9 +2,11 @@
 #define AIKIDO_STATESPACE_STATESPACE_HPP_
 
 #include <memory>
+#include <mutex>
 
 #include <Eigen/Dense>
 
+#include "aikido/common/FixedSizePool.hpp"
 #include "aikido/common/RNG.hpp"
 #include "aikido/common/pointers.hpp"
 #include "aikido/statespace/ScopedState.hpp"
@@ -42,6 +44,15 @@ public:
   using ScopedState = statespace::ScopedState<StateHandle>;
   using ScopedStateConst = statespace::ScopedState<StateHandleConst>;
 
+  StateSpace() = default;
+
+  /// Copy constructor. The copy starts with an empty state pool; states
+  /// allocated by \c other must still be freed by \c other.
+  StateSpace(const StateSpace& other);
+
+  /// Copy assignment. The state pool of this space is left untouched.
+  StateSpace& operator=(const StateSpace& other);
+
   virtual ~StateSpace() = default;
 
   /// Helper function to create a \c ScopedState.
@@ -54,13 +65,22 @@ public:
 
   /// Allocate a new state. This must be deleted with \c freeState. This is a
   /// helper function that allocates memory, uses \c allocateStateInBuffer to
-  /// create a \c State, and returns that pointer.
+  /// create a \c State, and returns that pointer. Memory is drawn from a
+  /// per-space pool of cache-line-aligned blocks, so repeated calls do not
+  /// touch the global heap once the pool has warmed up. The pool shrinks back
+  /// to its first slab once every state allocated from it has been freed.
+  ///
+  /// The returned state must be freed by this same \c StateSpace instance;
+  /// freeing it through a copy of this space, or any other space, is
+  /// undefined behavior.
   ///
   /// \return state in this space
   virtual State* allocateState() const;
 
-  /// Free a state previously created by \c allocateState. It is undefined
-  /// behavior to access \c _state after calling this function.
+  /// Free a state previously created by \c allocateState on this same
+  /// \c StateSpace instance. It is undefined behavior to access \c _state
+  /// after calling this function, or to pass a state allocated by another
+  /// instance, even a copy of this space.
   ///
   /// \param _state state to be deleted
   virtual void freeState(State* _state) const;
@@ -162,6 +182,16 @@ public:
   /// \param _state The element to print
   /// \param _os The stream to print to
   virtual void print(const State* _state, std::ostream& _os) const = 0;
+
+private:
+  /// Returns the pool backing \c allocateState, creating it on first use.
+  common::FixedSizePool& getStatePool() const;
+
+  /// Pool of \c getStateSizeInBytes() blocks backing \c allocateState.
+  mutable std::unique_ptr<common::FixedSizePool> mStatePool;
+
+  /// Guards lazy construction of \c mStatePool.
+  mutable std::once_flag mStatePoolFlag;
 };
 
 class StateSpace::State
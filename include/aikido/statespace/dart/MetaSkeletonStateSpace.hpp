@@ -1,11 +1,10 @@
 #ifndef AIKIDO_STATESPACE_DART_METASKELETONSTATESPACE_HPP_
 #define AIKIDO_STATESPACE_DART_METASKELETONSTATESPACE_HPP_
 
-#include <unordered_map>
+#include <vector>
 
 #include <dart/dynamics/dynamics.hpp>
 
-#include "aikido/common/pair.hpp"
 #include "aikido/common/pointers.hpp"
 #include "aikido/statespace/CartesianProduct.hpp"
 #include "aikido/statespace/dart/JointStateSpace.hpp"
@@ -54,6 +53,14 @@ public:
     /// Return the MetaSkeleton DOF index.
     std::size_t getDofIndex(const std::string& dofName) const;
 
+    /// Return the MetaSkeleton DOF index of every Joint DOF, ordered by Joint
+    /// index and then by Joint DOF index.
+    const std::vector<std::size_t>& getJointDofIndices() const;
+
+    /// Return the offset of the first DOF of a Joint in
+    /// \c getJointDofIndices().
+    std::size_t getJointDofOffset(std::size_t ijoint) const;
+
     /// Return the vector of position lower limits.
     const Eigen::VectorXd& getPositionLowerLimits() const;
 
@@ -84,12 +91,13 @@ public:
     /// Names of DOFs in the MetaSkeleton
     std::vector<std::string> mDofNames;
 
-    /// Mapping from Joint index and Joint DOF index to MetaSkeleton DOF index
-    std::unordered_map<
-        std::pair<std::size_t, std::size_t>,
-        std::size_t,
-        aikido::common::PairHash>
-        mIndexMap;
+    /// Offset of each Joint's first DOF in \c mJointDofIndices, followed by
+    /// the total number of DOFs
+    std::vector<std::size_t> mJointDofOffsets;
+
+    /// MetaSkeleton DOF index of each Joint DOF, ordered by Joint index and
+    /// then by Joint DOF index
+    std::vector<std::size_t> mJointDofIndices;
 
     /// The metaskeleton's position lower limits
     Eigen::VectorXd mPositionLowerLimits;
@@ -201,7 +209,44 @@ public:
       const ::dart::dynamics::SkeletonPtr& _skeleton) const;
 
 private:
+  /// How a subspace's states are converted to and from positions.
+  enum class JointLayout
+  {
+    /// States are packed arrays of doubles equal to the positions, as for
+    /// \c RJoint.
+    RealVector,
+
+    /// States hold a single angle, as for \c SO2Joint.
+    Angle,
+
+    /// Conversion is delegated to the \c JointStateSpace.
+    Generic
+  };
+
+  /// Precomputed information about a subspace used to convert between states
+  /// and positions without looking up the subspace or its DOF indices.
+  struct JointInfo
+  {
+    JointLayout mLayout;
+
+    /// Offset, in bytes, of the substate from the start of a state.
+    std::size_t mStateOffset;
+
+    /// Index of the subspace's first DOF in
+    /// \c Properties::getJointDofIndices().
+    std::size_t mFirstDof;
+
+    /// Number of DOFs of the subspace.
+    std::size_t mNumDofs;
+
+    /// Subspace; only used for \c JointLayout::Generic.
+    const JointStateSpace* mSpace;
+  };
+
   Properties mProperties;
+
+  /// Information about each subspace.
+  std::vector<JointInfo> mJointInfos;
 };
 
 } // namespace dart
@@ -1,6 +1,11 @@
 #ifndef AIKIDO_TRAJECTORY_PIECEWISELINEAR_TRAJECTORY_HPP_
 #define AIKIDO_TRAJECTORY_PIECEWISELINEAR_TRAJECTORY_HPP_
 
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
 #include "aikido/common/pointers.hpp"
 #include "aikido/statespace/GeodesicInterpolator.hpp"
 #include "aikido/trajectory/Trajectory.hpp"
@@ -11,6 +16,10 @@ namespace trajectory {
 AIKIDO_DECLARE_POINTERS(Interpolated)
 
 /// Trajectory that uses an \c Interpolator to interpolate between waypoints.
+///
+/// The waypoint times are stored in one array and the waypoint states in one
+/// contiguous buffer, so that appending a waypoint takes amortized constant
+/// time. Appending a waypoint may move the other waypoint states in memory.
 class Interpolated : public Trajectory
 {
 public:
@@ -22,14 +31,37 @@ public:
       statespace::ConstStateSpacePtr _stateSpace,
       statespace::ConstInterpolatorPtr _interpolator);
 
+  /// Constructs a trajectory with a waypoint at each time in \c _times, whose
+  /// state is the exponential map of the corresponding column of
+  /// \c _positions.
+  ///
+  /// \param _stateSpace state space this trajectory is defined in
+  /// \param _interpolator interpolator used to interpolate between waypoints
+  /// \param _times times of the waypoints, must be non-decreasing
+  /// \param _positions (dimension) x (num waypoints) matrix of positions
+  /// \throw std::invalid_argument if the sizes of \c _times and
+  /// \c _positions do not match or \c _times is not non-decreasing
+  Interpolated(
+      statespace::ConstStateSpacePtr _stateSpace,
+      statespace::ConstInterpolatorPtr _interpolator,
+      const Eigen::VectorXd& _times,
+      const Eigen::MatrixXd& _positions);
+
   virtual ~Interpolated();
 
-  /// Add a waypoint to the trajectory at the given time.
+  /// Add a waypoint to the trajectory at the given time. This takes amortized
+  /// constant time if \c _t is larger than the time of every waypoint.
   ///
   /// \param _t time of the waypoint
   /// \param _state state at the waypoint
   void addWaypoint(double _t, const statespace::StateSpace::State* _state);
 
+  /// Reserves storage for \c _numWaypoints waypoints, so that adding
+  /// waypoints up to that number does not reallocate.
+  ///
+  /// \param _numWaypoints number of waypoints to reserve storage for
+  void reserveWaypoints(std::size_t _numWaypoints);
+
   /// Gets a waypoint.
   ///
   /// \param _index waypoint index
@@ -72,34 +104,66 @@ public:
       int _derivative,
       Eigen::VectorXd& _tangentVector) const override;
 
-private:
-  /// Waypoint in the trajectory.
-  struct Waypoint
-  {
-    Waypoint(double _t, statespace::StateSpace::State* _state);
+  // Documentation inherited
+  void evaluateBatch(
+      const Eigen::VectorXd& _times,
+      Eigen::MatrixXd& _positions) const override;
 
-    /// Comparator to allow sorting waypoints based on time
-    bool operator<(const Waypoint& rhs) const;
+  // Documentation inherited
+  void evaluateBatch(
+      const Eigen::VectorXd& _times,
+      const std::vector<statespace::StateSpace::State*>& _states)
+      const override;
 
-    /// Comparator to allow sorting waypoints based on time
-    bool operator<(double rhs) const;
+  // Documentation inherited
+  void evaluateDerivativeBatch(
+      const Eigen::VectorXd& _times,
+      int _derivative,
+      Eigen::MatrixXd& _tangentVectors) const override;
 
-    /// Free state. Should be used for destruction.
-    /// \param[in] stateSpace StateSpace for the state this Waypoint contains.
-    void free(const statespace::ConstStateSpacePtr& stateSpace);
+private:
+  /// Returns the state of the \c _index-th waypoint, without bounds checking.
+  statespace::StateSpace::State* getWaypointState(std::size_t _index) const;
 
-    double t;
-    statespace::StateSpace::State* state;
-  };
+  /// Moves the waypoint states to a new buffer that holds \c _capacity
+  /// states.
+  void reallocateWaypointStates(std::size_t _capacity);
 
   /// Get the index of the first waypoint whose time value is larger than _t.
   /// Throws std::domain_error if _t is larger than last waypoint in the
   /// trajectory.
   int getWaypointIndexAfterTime(double _t) const;
 
+  /// Get the index of the first waypoint whose time value is not smaller than
+  /// _t, or the number of waypoints if there is none. The search moves forward
+  /// from _hint, so that calls with increasing _t and the previous result as
+  /// _hint visit each waypoint at most once.
+  std::size_t findWaypointIndexAfterTime(double _t, std::size_t _hint) const;
+
+  /// Evaluates the trajectory at \c _t, searching for the waypoint from
+  /// \c _idx as \c findWaypointIndexAfterTime does and updating \c _idx.
+  /// Returns the first or last waypoint if \c _t is outside the trajectory,
+  /// and otherwise \c _state set to the interpolated state.
+  const statespace::StateSpace::State* evaluateAfterIndex(
+      double _t,
+      std::size_t& _idx,
+      statespace::StateSpace::State* _state) const;
+
   statespace::ConstStateSpacePtr mStateSpace;
   statespace::ConstInterpolatorPtr mInterpolator;
-  std::vector<Waypoint> mWaypoints;
+
+  /// Times of the waypoints, in non-decreasing order.
+  std::vector<double> mWaypointTimes;
+
+  /// Distance, in bytes, between the states of consecutive waypoints.
+  std::size_t mStateStride;
+
+  /// Number of waypoint states that fit in \c mWaypointStates.
+  std::size_t mStateCapacity;
+
+  /// Buffer holding the state of the i-th waypoint at offset
+  /// i * \c mStateStride.
+  std::unique_ptr<char[]> mWaypointStates;
 };
 
 } // namespace trajectory
@@ -1,6 +1,10 @@
 #ifndef AIKIDO_TRAJECTORY_SPLINETRAJECTORY2_HPP_
 #define AIKIDO_TRAJECTORY_SPLINETRAJECTORY2_HPP_
 
+#include <atomic>
+#include <functional>
+#include <vector>
+
 #include "aikido/common/pointers.hpp"
 #include "aikido/trajectory/Trajectory.hpp"
 
@@ -106,6 +110,23 @@ public:
       int _derivative,
       Eigen::VectorXd& _tangentVector) const override;
 
+  // Documentation inherited.
+  void evaluateBatch(
+      const Eigen::VectorXd& _times,
+      Eigen::MatrixXd& _positions) const override;
+
+  // Documentation inherited.
+  void evaluateBatch(
+      const Eigen::VectorXd& _times,
+      const std::vector<statespace::StateSpace::State*>& _states)
+      const override;
+
+  // Documentation inherited.
+  void evaluateDerivativeBatch(
+      const Eigen::VectorXd& _times,
+      int _derivative,
+      Eigen::MatrixXd& _tangentVectors) const override;
+
   /// Gets the number of waypoints.
   /// \return The number of waypoints
   std::size_t getNumWaypoints() const;
@@ -156,14 +177,53 @@ private:
     double mDuration;
   };
 
-  static Eigen::VectorXd evaluatePolynomial(
-      const Eigen::MatrixXd& _coefficients, double _t, int _derivative);
+  static void evaluatePolynomial(
+      const Eigen::MatrixXd& _coefficients,
+      double _t,
+      int _derivative,
+      Eigen::VectorXd& _out);
 
+  /// Evaluates the \c _derivative-th derivative of a polynomial at each time
+  /// in \c _t, storing the result for the i-th time in the i-th column of
+  /// \c _out.
+  static void evaluatePolynomialBatch(
+      const Eigen::MatrixXd& _coefficients,
+      const Eigen::VectorXd& _t,
+      int _derivative,
+      Eigen::MatrixXd& _out);
+
+  /// Function called on a block of times that lie in the same segment with
+  /// the index and start time of the segment and the index of the first time
+  /// and number of times in the block.
+  using SegmentBlockFunction = std::function<void(
+      std::size_t, double, Eigen::Index, Eigen::Index)>;
+
+  /// Splits \c _times into blocks of consecutive times that lie in the same
+  /// segment and calls \c _function on each block.
+  void forEachSegmentBlock(
+      const Eigen::VectorXd& _times,
+      const SegmentBlockFunction& _function) const;
+
+  /// Returns the index and start time of the segment that contains \c _t.
+  /// Runs in constant time when called with non-decreasing times, e.g. when
+  /// sampling the trajectory, and in logarithmic time otherwise.
   std::pair<std::size_t, double> getSegmentForTime(double _t) const;
 
+  /// Returns the start time of the segment at index \c _index.
+  double getSegmentStartTime(std::size_t _index) const;
+
   statespace::ConstStateSpacePtr mStateSpace;
   double mStartTime;
   std::vector<PolynomialSegment> mSegments;
+
+  /// End time of each segment, i.e. prefix sums of the segment durations.
+  std::vector<double> mSegmentEndTimes;
+
+  /// Sum of the segment durations.
+  double mDuration;
+
+  /// Segment found by the last call to \c getSegmentForTime.
+  mutable std::atomic<std::size_t> mSegmentHint;
 };
 
 } // namespace trajectory
@@ -1,6 +1,8 @@
 #ifndef AIKIDO_TRAJECTORY_TRAJECTORY_HPP_
 #define AIKIDO_TRAJECTORY_TRAJECTORY_HPP_
 
+#include <vector>
+
 #include <Eigen/Core>
 
 #include "aikido/common/pointers.hpp"
@@ -72,6 +74,47 @@ public:
   virtual void evaluateDerivative(
       double _t, int _derivative, Eigen::VectorXd& _tangentVector) const = 0;
 
+  /// Evaluates the trajectory at each time in \c _times and stores the log
+  /// map of the resulting states, as computed by \c StateSpace::logMap, in the
+  /// columns of \c _positions. This is equivalent to calling \c evaluate for
+  /// each time, but concrete trajectories may share work between times.
+  /// Evaluation is fastest if \c _times is sorted.
+  ///
+  /// \param _times time parameters
+  /// \param[out] _positions (dimension) x (number of times) matrix whose i-th
+  /// column is the log map of the state at time \c _times[i]
+  virtual void evaluateBatch(
+      const Eigen::VectorXd& _times, Eigen::MatrixXd& _positions) const;
+
+  /// Evaluates the trajectory at each time in \c _times and stores the
+  /// resulting states in \c _states. This is equivalent to calling
+  /// \c evaluate for each time, and avoids the log map of the overload above
+  /// when the caller needs states.
+  ///
+  /// \param _times time parameters
+  /// \param[out] _states states allocated by the StateSpace of this
+  /// trajectory, one per time, whose i-th element is set to the state at time
+  /// \c _times[i]
+  /// \throw std::invalid_argument if the sizes of \c _times and \c _states
+  /// differ
+  virtual void evaluateBatch(
+      const Eigen::VectorXd& _times,
+      const std::vector<statespace::StateSpace::State*>& _states) const;
+
+  /// Evaluates the derivative of the trajectory at each time in \c _times.
+  /// This is equivalent to calling \c evaluateDerivative for each time, but
+  /// concrete trajectories may share work between times. Evaluation is
+  /// fastest if \c _times is sorted.
+  ///
+  /// \param _times time parameters
+  /// \param _derivative order of derivative
+  /// \param[out] _tangentVectors (dimension) x (number of times) matrix whose
+  /// i-th column is the tangent vector at time \c _times[i]
+  virtual void evaluateDerivativeBatch(
+      const Eigen::VectorXd& _times,
+      int _derivative,
+      Eigen::MatrixXd& _tangentVectors) const;
+
   /// Trajectory metadata
   // TODO: Is metadata required anymore? Delete if not.
   TrajectoryMetadata metadata;
@@ -0,0 +1,183 @@
+#include "aikido/common/BoundedLeastSquares.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace aikido {
+namespace common {
+
+//==============================================================================
+BoundedLeastSquares::BoundedLeastSquares(double regularization)
+  : mRegularization(regularization), mNumIterations(0)
+{
+  if (mRegularization <= 0)
+    throw std::invalid_argument("Regularization must be positive.");
+}
+
+//==============================================================================
+bool BoundedLeastSquares::solve(
+    const Eigen::Ref<const Eigen::MatrixXd>& mat,
+    const Eigen::Ref<const Eigen::VectorXd>& rhs,
+    const Eigen::VectorXd& lower,
+    const Eigen::VectorXd& upper,
+    const Eigen::VectorXd& reference,
+    Eigen::VectorXd& x)
+{
+  const auto n = mat.cols();
+
+  if (rhs.size() != mat.rows() || lower.size() != n || upper.size() != n
+      || reference.size() != n)
+  {
+    std::stringstream msg;
+    msg << "Inconsistent problem dimensions: matrix is " << mat.rows() << " x "
+        << n << ", rhs has " << rhs.size() << " entries, lower bound "
+        << lower.size() << ", upper bound " << upper.size() << ", reference "
+        << reference.size() << ".";
+    throw std::invalid_argument(msg.str());
+  }
+
+  if ((lower.array() > upper.array()).any())
+    throw std::invalid_argument("Lower bound exceeds upper bound.");
+
+  mNumIterations = 0;
+
+  if (x.size() != n || !x.allFinite())
+    x = reference;
+  x = x.cwiseMax(lower).cwiseMin(upper);
+
+  const double regularizationSquared = mRegularization * mRegularization;
+  mHessian.noalias() = mat.transpose() * mat;
+  mHessian.diagonal().array() += regularizationSquared;
+  mLinear.noalias() = mat.transpose() * rhs;
+  mLinear += regularizationSquared * reference;
+
+  // Tolerance on the Lagrange multipliers of the active bounds.
+  const double tolerance = 1e-10 * (1. + mLinear.cwiseAbs().maxCoeff());
+
+  mBoundStates.resize(n);
+  mStepRatios.resize(n);
+  for (Eigen::Index i = 0; i < n; ++i)
+  {
+    if (x[i] <= lower[i])
+      mBoundStates[i] = BoundState::AtLower;
+    else if (x[i] >= upper[i])
+      mBoundStates[i] = BoundState::AtUpper;
+    else
+      mBoundStates[i] = BoundState::Free;
+  }
+
+  // Each iteration either adds a bound to the active set or, once the
+  // objective is minimized over the current face of the box, releases the
+  // bound whose multiplier has the wrong sign. Strict convexity guarantees
+  // termination; the limit only guards against round-off.
+  const int maxIterations = 10 * (static_cast<int>(n) + 1);
+  while (mNumIterations < maxIterations)
+  {
+    ++mNumIterations;
+
+    // Newton step over the free variables. The objective is quadratic, so a
+    // full step reaches the minimizer over the current face.
+    mGradient.noalias() = mHessian * x;
+    mGradient -= mLinear;
+
+    mReducedHessian = mHessian;
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      if (mBoundStates[i] == BoundState::Free)
+        continue;
+
+      mReducedHessian.row(i).setZero();
+      mReducedHessian.col(i).setZero();
+      mReducedHessian(i, i) = 1.;
+      mGradient[i] = 0.;
+    }
+    mReducedSolver.compute(mReducedHessian);
+    mStep = mReducedSolver.solve(mGradient);
+    mStep *= -1.;
+
+    // Shorten the step to stay within the bounds, remembering how far each
+    // variable can move before it hits a bound.
+    double stepLength = 1.;
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      mStepRatios[i] = std::numeric_limits<double>::infinity();
+      if (mBoundStates[i] != BoundState::Free)
+        continue;
+
+      if (mStep[i] < 0. && x[i] + mStep[i] < lower[i])
+        mStepRatios[i] = (lower[i] - x[i]) / mStep[i];
+      else if (mStep[i] > 0. && x[i] + mStep[i] > upper[i])
+        mStepRatios[i] = (upper[i] - x[i]) / mStep[i];
+
+      stepLength = std::min(stepLength, mStepRatios[i]);
+    }
+
+    x += stepLength * mStep;
+
+    if (stepLength < 1.)
+    {
+      // Hold every variable that blocked the step. Round-off in the step may
+      // leave a blocking variable slightly off its bound, so snap it there
+      // rather than testing whether it was reached.
+      for (Eigen::Index i = 0; i < n; ++i)
+      {
+        if (mBoundStates[i] != BoundState::Free)
+          continue;
+
+        if (x[i] <= lower[i] || (mStepRatios[i] <= stepLength && mStep[i] < 0.))
+        {
+          x[i] = lower[i];
+          mBoundStates[i] = BoundState::AtLower;
+        }
+        else if (
+            x[i] >= upper[i] || (mStepRatios[i] <= stepLength && mStep[i] > 0.))
+        {
+          x[i] = upper[i];
+          mBoundStates[i] = BoundState::AtUpper;
+        }
+      }
+      continue;
+    }
+
+    // x minimizes the objective over the current face. Release the bound
+    // that most decreases the objective, if any.
+    mGradient.noalias() = mHessian * x;
+    mGradient -= mLinear;
+
+    Eigen::Index release = -1;
+    double largestViolation = tolerance;
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      // Variables with equal bounds are fixed.
+      if (mBoundStates[i] == BoundState::Free || lower[i] == upper[i])
+        continue;
+
+      const double violation = mBoundStates[i] == BoundState::AtLower
+                                   ? -mGradient[i]
+                                   : mGradient[i];
+      if (violation > largestViolation)
+      {
+        largestViolation = violation;
+        release = i;
+      }
+    }
+
+    if (release < 0)
+      return true;
+
+    mBoundStates[release] = BoundState::Free;
+  }
+
+  return false;
+}
+
+//==============================================================================
+int BoundedLeastSquares::getNumIterations() const
+{
+  return mNumIterations;
+}
+
+} // namespace common
+} // namespace aikido
@@ -0,0 +1,143 @@
+#include "aikido/common/FixedSizePool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace aikido {
+namespace common {
+
+//==============================================================================
+// Required for odr-use.
+constexpr std::size_t FixedSizePool::ALIGNMENT;
+constexpr std::size_t FixedSizePool::MAX_BLOCKS_PER_SLAB;
+
+namespace {
+
+//==============================================================================
+std::size_t roundUpToAlignment(std::size_t size, std::size_t alignment)
+{
+  return ((size + alignment - 1) / alignment) * alignment;
+}
+
+} // namespace
+
+//==============================================================================
+FixedSizePool::FixedSizePool(
+    std::size_t blockSize, std::size_t initialBlocksPerSlab)
+  : mBlockSize(
+        roundUpToAlignment(std::max(blockSize, sizeof(FreeBlock)), ALIGNMENT))
+  , mInitialBlocksPerSlab(
+        std::min(std::max<std::size_t>(initialBlocksPerSlab, 1),
+                 MAX_BLOCKS_PER_SLAB))
+  , mNextBlocksPerSlab(mInitialBlocksPerSlab)
+  , mFreeList(nullptr)
+  , mNumAllocatedBlocks(0)
+{
+}
+
+//==============================================================================
+void* FixedSizePool::allocate()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  if (!mFreeList)
+    grow();
+
+  FreeBlock* block = mFreeList;
+  mFreeList = block->mNext;
+  ++mNumAllocatedBlocks;
+
+  return block;
+}
+
+//==============================================================================
+void FixedSizePool::deallocate(void* block)
+{
+  if (!block)
+    return;
+
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  auto freeBlock = static_cast<FreeBlock*>(block);
+  freeBlock->mNext = mFreeList;
+  mFreeList = freeBlock;
+
+  // Once the pool is empty, shrink back to the first slab so that a burst of
+  // allocations does not pin its high-water mark for the life of the pool.
+  if (--mNumAllocatedBlocks == 0 && mSlabs.size() > 1)
+    releaseExtraSlabs();
+}
+
+//==============================================================================
+void FixedSizePool::clear()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  mSlabs.clear();
+  mFreeList = nullptr;
+  mNumAllocatedBlocks = 0;
+  mNextBlocksPerSlab = mInitialBlocksPerSlab;
+}
+
+//==============================================================================
+std::size_t FixedSizePool::getBlockSize() const
+{
+  return mBlockSize;
+}
+
+//==============================================================================
+std::size_t FixedSizePool::getNumAllocatedBlocks() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mNumAllocatedBlocks;
+}
+
+//==============================================================================
+std::size_t FixedSizePool::getNumSlabs() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mSlabs.size();
+}
+
+//==============================================================================
+void FixedSizePool::grow()
+{
+  const std::size_t numBlocks = mNextBlocksPerSlab;
+
+  // Over-allocate by one alignment unit so the first block can be aligned
+  // regardless of what the global allocator returns.
+  std::unique_ptr<char[]> slab(new char[numBlocks * mBlockSize + ALIGNMENT]);
+  pushSlab(slab.get(), numBlocks);
+
+  mSlabs.emplace_back(std::move(slab));
+  mNextBlocksPerSlab = std::min(2 * mNextBlocksPerSlab, MAX_BLOCKS_PER_SLAB);
+}
+
+//==============================================================================
+void FixedSizePool::releaseExtraSlabs()
+{
+  mSlabs.resize(1);
+  mFreeList = nullptr;
+  pushSlab(mSlabs.front().get(), mInitialBlocksPerSlab);
+  mNextBlocksPerSlab = std::min(2 * mInitialBlocksPerSlab, MAX_BLOCKS_PER_SLAB);
+}
+
+//==============================================================================
+void FixedSizePool::pushSlab(char* slab, std::size_t numBlocks)
+{
+  const auto address = reinterpret_cast<std::uintptr_t>(slab);
+  char* first = slab + (roundUpToAlignment(address, ALIGNMENT) - address);
+
+  // Thread the blocks in address order so consecutive allocations are
+  // contiguous in memory.
+  for (std::size_t i = numBlocks; i-- > 0;)
+  {
+    auto block = reinterpret_cast<FreeBlock*>(first + i * mBlockSize);
+    block->mNext = mFreeList;
+    mFreeList = block;
+  }
+}
+
+} // namespace common
+} // namespace aikido
@@ -0,0 +1,93 @@
+#include "aikido/common/Spline.hpp"
+
+#include <cassert>
+
+namespace aikido {
+namespace common {
+
+//==============================================================================
+Eigen::Matrix<double, Eigen::Dynamic, 2> fitLinearSegment(
+    const Eigen::VectorXd& _startValue,
+    const Eigen::VectorXd& _endValue,
+    double _duration)
+{
+  assert(_endValue.size() == _startValue.size());
+
+  Eigen::Matrix<double, Eigen::Dynamic, 2> coefficients(_startValue.size(), 2);
+  coefficients.col(0) = _startValue;
+  coefficients.col(1) = (_endValue - _startValue) / _duration;
+  return coefficients;
+}
+
+//==============================================================================
+Eigen::Matrix<double, Eigen::Dynamic, 4> fitCubicSegment(
+    const Eigen::VectorXd& _startValue,
+    const Eigen::VectorXd& _startVelocity,
+    const Eigen::VectorXd& _endValue,
+    const Eigen::VectorXd& _endVelocity,
+    double _duration)
+{
+  assert(_startVelocity.size() == _startValue.size());
+  assert(_endValue.size() == _startValue.size());
+  assert(_endVelocity.size() == _startValue.size());
+
+  const Eigen::VectorXd averageVelocity
+      = (_endValue - _startValue) / _duration;
+
+  Eigen::Matrix<double, Eigen::Dynamic, 4> coefficients(_startValue.size(), 4);
+  coefficients.col(0) = _startValue;
+  coefficients.col(1) = _startVelocity;
+  coefficients.col(2)
+      = (3. * averageVelocity - 2. * _startVelocity - _endVelocity) / _duration;
+  coefficients.col(3) = (-2. * averageVelocity + _startVelocity + _endVelocity)
+                        / (_duration * _duration);
+  return coefficients;
+}
+
+//==============================================================================
+Eigen::Matrix<double, Eigen::Dynamic, 6> fitQuinticSegment(
+    const Eigen::VectorXd& _startValue,
+    const Eigen::VectorXd& _startVelocity,
+    const Eigen::VectorXd& _startAcceleration,
+    const Eigen::VectorXd& _endValue,
+    const Eigen::VectorXd& _endVelocity,
+    const Eigen::VectorXd& _endAcceleration,
+    double _duration)
+{
+  assert(_startVelocity.size() == _startValue.size());
+  assert(_startAcceleration.size() == _startValue.size());
+  assert(_endValue.size() == _startValue.size());
+  assert(_endVelocity.size() == _startValue.size());
+  assert(_endAcceleration.size() == _startValue.size());
+
+  const double t = _duration;
+  const double t2 = t * t;
+
+  // Differences between the end conditions and those of the quadratic
+  // polynomial given by the start conditions.
+  const Eigen::VectorXd valueError = _endValue - _startValue
+                                     - _startVelocity * t
+                                     - 0.5 * _startAcceleration * t2;
+  const Eigen::VectorXd velocityError
+      = _endVelocity - _startVelocity - _startAcceleration * t;
+  const Eigen::VectorXd accelerationError
+      = _endAcceleration - _startAcceleration;
+
+  Eigen::Matrix<double, Eigen::Dynamic, 6> coefficients(_startValue.size(), 6);
+  coefficients.col(0) = _startValue;
+  coefficients.col(1) = _startVelocity;
+  coefficients.col(2) = 0.5 * _startAcceleration;
+  coefficients.col(3) = (10. * valueError - 4. * velocityError * t
+                         + 0.5 * accelerationError * t2)
+                        / (t2 * t);
+  coefficients.col(4) = (-15. * valueError + 7. * velocityError * t
+                         - accelerationError * t2)
+                        / (t2 * t2);
+  coefficients.col(5) = (6. * valueError - 3. * velocityError * t
+                         + 0.5 * accelerationError * t2)
+                        / (t2 * t2 * t);
+  return coefficients;
+}
+
+} // namespace common
+} // namespace aikido
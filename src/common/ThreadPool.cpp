@@ -0,0 +1,63 @@
+#include "aikido/common/ThreadPool.hpp"
+
+#include <stdexcept>
+
+namespace aikido {
+namespace common {
+
+//==============================================================================
+ThreadPool::ThreadPool(std::size_t numThreads) : mIsStopping(false)
+{
+  if (numThreads == 0)
+    throw std::invalid_argument("Number of threads must be positive.");
+
+  mThreads.reserve(numThreads);
+  for (std::size_t i = 0; i < numThreads; ++i)
+    mThreads.emplace_back(&ThreadPool::spin, this);
+}
+
+//==============================================================================
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mIsStopping = true;
+  }
+  mCondition.notify_all();
+
+  for (auto& thread : mThreads)
+    thread.join();
+}
+
+//==============================================================================
+std::size_t ThreadPool::getNumThreads() const
+{
+  return mThreads.size();
+}
+
+//==============================================================================
+void ThreadPool::spin()
+{
+  while (true)
+  {
+    std::function<void()> task;
+
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mCondition.wait(
+          lock, [this]() { return mIsStopping || !mTasks.empty(); });
+
+      if (mTasks.empty())
+        return;
+
+      task = std::move(mTasks.front());
+      mTasks.pop();
+    }
+
+    // Exceptions are captured by the packaged_task created in submit().
+    task();
+  }
+}
+
+} // namespace common
+} // namespace aikido
@@ -0,0 +1,274 @@
+#include "aikido/constraint/CachedTestable.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <Eigen/Core>
+
+namespace aikido {
+namespace constraint {
+
+//==============================================================================
+CachedTestable::CachedTestable(
+    ConstTestablePtr testable,
+    double resolution,
+    std::size_t capacity,
+    std::function<std::size_t()> versionSource)
+  : mTestable(std::move(testable))
+  , mResolution(resolution)
+  , mCapacity(capacity)
+  , mVersionSource(std::move(versionSource))
+  , mVersion(0)
+  , mNumHits(0)
+  , mNumMisses(0)
+{
+  if (!mTestable)
+    throw std::invalid_argument("Testable is nullptr.");
+
+  if (mResolution <= 0.0)
+    throw std::invalid_argument("Resolution must be positive.");
+
+  if (mCapacity == 0)
+    throw std::invalid_argument("Capacity must be positive.");
+
+  mStateSpace = mTestable->getStateSpace();
+
+  if (mVersionSource)
+    mVersion = mVersionSource();
+}
+
+//==============================================================================
+bool CachedTestable::isSatisfied(
+    const statespace::StateSpace::State* state,
+    TestableOutcome* outcome) const
+{
+  if (outcome)
+    return mTestable->isSatisfied(state, outcome);
+
+  // Reused across calls on this thread so that cache hits do not allocate.
+  static thread_local Key lookupKey;
+  computeKey(state, lookupKey);
+
+  // Query the version without holding the lock, so that callers are not
+  // serialized on the version source.
+  const std::size_t version = queryVersion();
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    updateVersion(version);
+
+    bool satisfied;
+    if (lookup(lookupKey, satisfied))
+      return satisfied;
+  }
+
+  // The wrapped Testable may itself use a CachedTestable on this thread.
+  const Key key = lookupKey;
+
+  // Evaluate without holding the lock so that other threads may use the cache
+  // in the meantime.
+  const bool satisfied = mTestable->isSatisfied(state);
+  const std::size_t newVersion = queryVersion();
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  updateVersion(newVersion);
+  if (mVersion == version)
+    insert(key, satisfied);
+  return satisfied;
+}
+
+//==============================================================================
+bool CachedTestable::isSatisfiedBatch(
+    const std::vector<const statespace::StateSpace::State*>& states,
+    std::vector<bool>& out,
+    BatchMode mode) const
+{
+  out.assign(states.size(), false);
+
+  std::vector<Key> keys(states.size());
+  for (std::size_t i = 0; i < states.size(); ++i)
+    computeKey(states[i], keys[i]);
+
+  // Index of the first state known not to satisfy the constraint.
+  std::size_t firstFailure = states.size();
+
+  std::vector<std::size_t> missIndices;
+  std::vector<const statespace::StateSpace::State*> missStates;
+
+  const std::size_t version = queryVersion();
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    updateVersion(version);
+
+    for (std::size_t i = 0; i < states.size(); ++i)
+    {
+      bool satisfied;
+      if (!lookup(keys[i], satisfied))
+      {
+        missIndices.emplace_back(i);
+        missStates.emplace_back(states[i]);
+        continue;
+      }
+
+      out[i] = satisfied;
+      if (!satisfied && firstFailure == states.size())
+      {
+        firstFailure = i;
+        if (mode == BatchMode::FirstFailure)
+          break;
+      }
+    }
+  }
+
+  std::vector<bool> missOut;
+  mTestable->isSatisfiedBatch(missStates, missOut, mode);
+  const std::size_t newVersion = queryVersion();
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  updateVersion(newVersion);
+  const bool isCacheable = mVersion == version;
+
+  for (std::size_t j = 0; j < missIndices.size(); ++j)
+  {
+    const auto index = missIndices[j];
+    out[index] = missOut[j];
+    if (isCacheable)
+      insert(keys[index], missOut[j]);
+
+    if (!missOut[j])
+    {
+      firstFailure = std::min(firstFailure, index);
+
+      // The remaining misses were not tested.
+      if (mode == BatchMode::FirstFailure)
+        break;
+    }
+  }
+
+  if (mode == BatchMode::FirstFailure)
+    std::fill(out.begin() + firstFailure, out.end(), false);
+
+  return firstFailure == states.size();
+}
+
+//==============================================================================
+statespace::ConstStateSpacePtr CachedTestable::getStateSpace() const
+{
+  return mStateSpace;
+}
+
+//==============================================================================
+std::unique_ptr<TestableOutcome> CachedTestable::createOutcome() const
+{
+  return mTestable->createOutcome();
+}
+
+//==============================================================================
+ConstTestablePtr CachedTestable::getTestable() const
+{
+  return mTestable;
+}
+
+//==============================================================================
+std::size_t CachedTestable::getSize() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mEntries.size();
+}
+
+//==============================================================================
+std::size_t CachedTestable::getNumHits() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mNumHits;
+}
+
+//==============================================================================
+std::size_t CachedTestable::getNumMisses() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mNumMisses;
+}
+
+//==============================================================================
+void CachedTestable::clear()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mEntries.clear();
+  mIndex.clear();
+  mNumHits = 0;
+  mNumMisses = 0;
+}
+
+//==============================================================================
+void CachedTestable::computeKey(
+    const statespace::StateSpace::State* state, Key& key) const
+{
+  // Reused across calls on this thread so that lookups do not allocate.
+  static thread_local Eigen::VectorXd tangent;
+  tangent.resize(mStateSpace->getDimension());
+  mStateSpace->logMap(state, tangent);
+
+  key.resize(tangent.size());
+  for (Eigen::Index i = 0; i < tangent.size(); ++i)
+    key[i] = static_cast<std::int64_t>(std::llround(tangent[i] / mResolution));
+}
+
+//==============================================================================
+std::size_t CachedTestable::queryVersion() const
+{
+  return mVersionSource ? mVersionSource() : 0;
+}
+
+//==============================================================================
+void CachedTestable::updateVersion(std::size_t version) const
+{
+  // Versions queried concurrently may arrive out of order; never go back.
+  if (version <= mVersion)
+    return;
+
+  mEntries.clear();
+  mIndex.clear();
+  mVersion = version;
+}
+
+//==============================================================================
+bool CachedTestable::lookup(const Key& key, bool& satisfied) const
+{
+  const auto it = mIndex.find(key);
+  if (it == mIndex.end())
+  {
+    ++mNumMisses;
+    return false;
+  }
+
+  mEntries.splice(mEntries.begin(), mEntries, it->second);
+  satisfied = it->second->mSatisfied;
+  ++mNumHits;
+  return true;
+}
+
+//==============================================================================
+void CachedTestable::insert(const Key& key, bool satisfied) const
+{
+  // Another thread may have inserted the same key in the meantime.
+  const auto it = mIndex.find(key);
+  if (it != mIndex.end())
+  {
+    it->second->mSatisfied = satisfied;
+    mEntries.splice(mEntries.begin(), mEntries, it->second);
+    return;
+  }
+
+  if (mEntries.size() == mCapacity)
+  {
+    mIndex.erase(mEntries.back().mKey);
+    mEntries.pop_back();
+  }
+
+  mEntries.push_front(Entry{key, satisfied});
+  mIndex.emplace(key, mEntries.begin());
+}
+
+} // namespace constraint
+} // namespace aikido
@@ -1,26 +1,85 @@
 #include "aikido/constraint/NewtonsMethodProjectable.hpp"
 
+#include <algorithm>
 #include <cmath>
-#include <iostream>
-#include <limits>
-
-#include <dart/math/Geometry.hpp>
+#include <sstream>
 
 #include "aikido/common/PseudoInverse.hpp"
 
 namespace aikido {
 namespace constraint {
 
+//==============================================================================
+struct NewtonsMethodProjectable::Workspace
+{
+  Workspace(statespace::ConstStateSpacePtr _stateSpace, std::size_t _numValues);
+
+  Workspace(const Workspace&) = delete;
+  Workspace& operator=(const Workspace&) = delete;
+
+  ~Workspace();
+
+  statespace::ConstStateSpacePtr mStateSpace;
+
+  Eigen::VectorXd mValues;
+  Eigen::VectorXd mCandidateValues;
+  Eigen::MatrixXd mJacobian;
+  Eigen::VectorXd mStep;
+
+  /// Storage for the least-squares solvers.
+  common::LeastSquaresWorkspace<> mSolverWorkspace;
+
+  statespace::StateSpace::State* mSeed;
+  statespace::StateSpace::State* mStepState;
+  statespace::StateSpace::State* mComposedState;
+  statespace::StateSpace::State* mInverseState;
+
+  /// Tangent vector that took the seed of the last successful projection to
+  /// its result.
+  Eigen::VectorXd mCorrection;
+  bool mHasCorrection;
+};
+
+//==============================================================================
+NewtonsMethodProjectable::Workspace::Workspace(
+    statespace::ConstStateSpacePtr _stateSpace, std::size_t _numValues)
+  : mStateSpace(std::move(_stateSpace))
+  , mValues(_numValues)
+  , mCandidateValues(_numValues)
+  , mJacobian(_numValues, mStateSpace->getDimension())
+  , mStep(mStateSpace->getDimension())
+  , mSeed(mStateSpace->allocateState())
+  , mStepState(mStateSpace->allocateState())
+  , mComposedState(mStateSpace->allocateState())
+  , mInverseState(mStateSpace->allocateState())
+  , mCorrection(mStateSpace->getDimension())
+  , mHasCorrection(false)
+{
+}
+
+//==============================================================================
+NewtonsMethodProjectable::Workspace::~Workspace()
+{
+  mStateSpace->freeState(mSeed);
+  mStateSpace->freeState(mStepState);
+  mStateSpace->freeState(mComposedState);
+  mStateSpace->freeState(mInverseState);
+}
+
 //==============================================================================
 NewtonsMethodProjectable::NewtonsMethodProjectable(
     DifferentiablePtr _differentiable,
     std::vector<double> _tolerance,
     int _maxIteration,
-    double _minStepSize)
+    double _minStepSize,
+    double _damping,
+    bool _warmStart)
   : mDifferentiable(std::move(_differentiable))
   , mTolerance(std::move(_tolerance))
   , mMaxIteration(_maxIteration)
   , mMinStepSize(_minStepSize)
+  , mDamping(_damping)
+  , mWarmStart(_warmStart)
 {
   if (!mDifferentiable)
     throw std::invalid_argument("_differentiable is nullptr.");
@@ -46,28 +105,41 @@ NewtonsMethodProjectable::NewtonsMethodProjectable(
   if (mMinStepSize <= 0)
     throw std::invalid_argument("_minStepsize should be positive.");
 
+  if (mDamping < 0)
+    throw std::invalid_argument("_damping should be non-negative.");
+
   mStateSpace = mDifferentiable->getStateSpace();
+  mConstraintTypes = mDifferentiable->getConstraintTypes();
+
+  if (mConstraintTypes.size() != mTolerance.size())
+  {
+    std::stringstream msg;
+    msg << "Number of constraint types does not match the number of "
+        << "constraints: expected " << mTolerance.size() << ", got "
+        << mConstraintTypes.size();
+    throw std::invalid_argument(msg.str());
+  }
+
+  mWorkspace.reset(new Workspace(mStateSpace, mTolerance.size()));
 }
 
 //==============================================================================
-bool NewtonsMethodProjectable::contains(
-    const statespace::StateSpace::State* _s) const
-{
-  Eigen::VectorXd values;
-  mDifferentiable->getValue(_s, values);
-  std::vector<ConstraintType> types = mDifferentiable->getConstraintTypes();
+NewtonsMethodProjectable::~NewtonsMethodProjectable() = default;
 
-  for (int i = 0; i < values.size(); i++)
+//==============================================================================
+bool NewtonsMethodProjectable::contains(const Eigen::VectorXd& _values) const
+{
+  for (int i = 0; i < _values.size(); i++)
   {
-    if (types.at(i) == ConstraintType::EQUALITY)
+    if (mConstraintTypes[i] == ConstraintType::EQUALITY)
     {
-      if (std::abs(values(i)) > mTolerance.at(i))
+      if (std::abs(_values(i)) > mTolerance[i])
         return false;
     }
     else
     {
       // Inequality constraints are satisfied when value <= 0.
-      if (values(i) > mTolerance.at(i))
+      if (_values(i) > mTolerance[i])
         return false;
     }
   }
@@ -76,48 +148,148 @@ bool NewtonsMethodProjectable::contains(
 }
 
 //==============================================================================
-bool NewtonsMethodProjectable::project(
-    const statespace::StateSpace::State* _s,
-    statespace::StateSpace::State* _out) const
+double NewtonsMethodProjectable::computeViolation(
+    const Eigen::VectorXd& _values) const
 {
-  using StateSpace = statespace::StateSpace;
+  double squaredViolation = 0;
 
-  int iteration = 0;
+  for (int i = 0; i < _values.size(); i++)
+  {
+    double violation = _values(i);
+    if (mConstraintTypes[i] == ConstraintType::EQUALITY)
+      violation = std::abs(violation);
+    else
+      violation = std::max(violation, 0.0);
+
+    squaredViolation += violation * violation;
+  }
+
+  return std::sqrt(squaredViolation);
+}
+
+//==============================================================================
+void NewtonsMethodProjectable::computeStep(Workspace& _workspace) const
+{
+  if (mDamping == 0)
+  {
+    common::solveLeastSquares(
+        _workspace.mJacobian,
+        _workspace.mValues,
+        _workspace.mStep,
+        _workspace.mSolverWorkspace);
+  }
+  else
+  {
+    common::solveDampedLeastSquares(
+        _workspace.mJacobian,
+        _workspace.mValues,
+        mDamping,
+        _workspace.mStep,
+        _workspace.mSolverWorkspace);
+  }
+
+  _workspace.mStep *= -1;
+}
 
+//==============================================================================
+bool NewtonsMethodProjectable::runNewtonsMethod(
+    const statespace::StateSpace::State* _s,
+    statespace::StateSpace::State* _out,
+    Workspace& _workspace) const
+{
   // Initialize _out.
   mStateSpace->copyState(_s, _out);
+  mDifferentiable->getValue(_out, _workspace.mValues);
 
-  StateSpace::ScopedState step(mStateSpace.get());
+  // Start from the correction of the previous projection if it gets closer
+  // to the constraint than _s does.
+  if (mWarmStart && _workspace.mHasCorrection && !contains(_workspace.mValues))
+  {
+    mStateSpace->expMap(_workspace.mCorrection, _workspace.mStepState);
+    mStateSpace->compose(
+        _s, _workspace.mStepState, _workspace.mComposedState);
+    mDifferentiable->getValue(
+        _workspace.mComposedState, _workspace.mCandidateValues);
+
+    if (computeViolation(_workspace.mCandidateValues)
+        < computeViolation(_workspace.mValues))
+    {
+      mStateSpace->copyState(_workspace.mComposedState, _out);
+      _workspace.mValues.swap(_workspace.mCandidateValues);
+    }
+  }
 
   /// Newton's method on mDifferentiable
-  while (!contains(_out) && iteration < mMaxIteration)
+  int iteration = 0;
+  while (!contains(_workspace.mValues))
   {
+    if (iteration >= mMaxIteration)
+      return false;
     iteration++;
 
-    Eigen::VectorXd value;
-    mDifferentiable->getValue(_out, value);
-    Eigen::MatrixXd jac;
-    mDifferentiable->getJacobian(_out, jac);
+    mDifferentiable->getJacobian(_out, _workspace.mJacobian);
 
     // Minimization step in tangent space.
-    Eigen::VectorXd tangentStep = -1 * common::pseudoinverse(jac) * value;
+    computeStep(_workspace);
 
-    // Break if tangent step is too small.
-    if (tangentStep.maxCoeff() < mMinStepSize
-        && (-1 * tangentStep).maxCoeff() < mMinStepSize)
-      break;
+    // Stop if tangent step is too small.
+    if (_workspace.mStep.cwiseAbs().maxCoeff() < mMinStepSize)
+      return false;
 
     // Minimization step in state space.
-    mStateSpace->expMap(tangentStep, step);
-    mStateSpace->compose(_out, step);
+    mStateSpace->expMap(_workspace.mStep, _workspace.mStepState);
+    mStateSpace->compose(
+        _out, _workspace.mStepState, _workspace.mComposedState);
+    mStateSpace->copyState(_workspace.mComposedState, _out);
+
+    mDifferentiable->getValue(_out, _workspace.mValues);
   }
 
-  if (!contains(_out))
-    return false;
+  if (mWarmStart)
+  {
+    mStateSpace->getInverse(_s, _workspace.mInverseState);
+    mStateSpace->compose(
+        _workspace.mInverseState, _out, _workspace.mComposedState);
+    mStateSpace->logMap(_workspace.mComposedState, _workspace.mCorrection);
+    _workspace.mHasCorrection = true;
+  }
 
   return true;
 }
 
+//==============================================================================
+bool NewtonsMethodProjectable::project(
+    const statespace::StateSpace::State* _s,
+    statespace::StateSpace::State* _out) const
+{
+  if (_s == _out)
+    return project(_out);
+
+  std::unique_lock<std::mutex> lock(mWorkspaceMutex, std::try_to_lock);
+  if (lock.owns_lock())
+    return runNewtonsMethod(_s, _out, *mWorkspace);
+
+  // Another projection is using the shared workspace.
+  Workspace workspace(mStateSpace, mTolerance.size());
+  return runNewtonsMethod(_s, _out, workspace);
+}
+
+//==============================================================================
+bool NewtonsMethodProjectable::project(statespace::StateSpace::State* _s) const
+{
+  std::unique_lock<std::mutex> lock(mWorkspaceMutex, std::try_to_lock);
+  if (lock.owns_lock())
+  {
+    mStateSpace->copyState(_s, mWorkspace->mSeed);
+    return runNewtonsMethod(mWorkspace->mSeed, _s, *mWorkspace);
+  }
+
+  // Another projection is using the shared workspace.
+  Workspace workspace(mStateSpace, mTolerance.size());
+  mStateSpace->copyState(_s, workspace.mSeed);
+  return runNewtonsMethod(workspace.mSeed, _s, workspace);
+}
+
 //==============================================================================
 statespace::ConstStateSpacePtr NewtonsMethodProjectable::getStateSpace() const
 {
@@ -0,0 +1,30 @@
+#include "aikido/constraint/Testable.hpp"
+
+namespace aikido {
+namespace constraint {
+
+//==============================================================================
+bool Testable::isSatisfiedBatch(
+    const std::vector<const statespace::StateSpace::State*>& states,
+    std::vector<bool>& out,
+    BatchMode mode) const
+{
+  out.assign(states.size(), false);
+
+  bool allSatisfied = true;
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    out[i] = isSatisfied(states[i]);
+    if (out[i])
+      continue;
+
+    allSatisfied = false;
+    if (mode == BatchMode::FirstFailure)
+      break;
+  }
+
+  return allSatisfied;
+}
+
+} // namespace constraint
+} // namespace aikido
@@ -1,5 +1,6 @@
 #include "aikido/constraint/TestableIntersection.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace aikido {
@@ -41,6 +42,61 @@ bool TestableIntersection::isSatisfied(
   return true;
 }
 
+//==============================================================================
+bool TestableIntersection::isSatisfiedBatch(
+    const std::vector<const statespace::StateSpace::State*>& states,
+    std::vector<bool>& out,
+    BatchMode mode) const
+{
+  out.assign(states.size(), true);
+
+  // Indices into states that have satisfied every constraint tested so far.
+  std::vector<std::size_t> remaining(states.size());
+  for (std::size_t i = 0; i < remaining.size(); ++i)
+    remaining[i] = i;
+
+  std::vector<const statespace::StateSpace::State*> batch;
+  std::vector<bool> batchOut;
+
+  for (const auto& constraint : mConstraints)
+  {
+    if (remaining.empty())
+      break;
+
+    batch.clear();
+    for (const auto index : remaining)
+      batch.emplace_back(states[index]);
+
+    if (constraint->isSatisfiedBatch(batch, batchOut, mode))
+      continue;
+
+    if (mode == BatchMode::FirstFailure)
+    {
+      // Results are a prefix of true values, so the remaining states also form
+      // a prefix of the batch.
+      std::size_t numSatisfied = 0;
+      while (batchOut[numSatisfied])
+        ++numSatisfied;
+
+      std::fill(out.begin() + remaining[numSatisfied], out.end(), false);
+      remaining.resize(numSatisfied);
+      continue;
+    }
+
+    std::size_t numSatisfied = 0;
+    for (std::size_t i = 0; i < remaining.size(); ++i)
+    {
+      if (batchOut[i])
+        remaining[numSatisfied++] = remaining[i];
+      else
+        out[remaining[i]] = false;
+    }
+    remaining.resize(numSatisfied);
+  }
+
+  return remaining.size() == states.size();
+}
+
 //==============================================================================
 std::unique_ptr<TestableOutcome> TestableIntersection::createOutcome() const
 {
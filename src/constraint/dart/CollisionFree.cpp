@@ -1,5 +1,7 @@
 #include "aikido/constraint/dart/CollisionFree.hpp"
 
+#include <algorithm>
+
 namespace aikido {
 namespace constraint {
 namespace dart {
@@ -14,6 +16,7 @@ CollisionFree::CollisionFree(
   , mMetaSkeleton(std::move(_metaskeleton))
   , mCollisionDetector(std::move(_collisionDetector))
   , mCollisionOptions(std::move(_collisionOptions))
+  , mLastCollidingCheck(0)
 {
   if (!mMetaSkeletonStateSpace)
     throw std::invalid_argument("_metaSkeletonStateSpace is nullptr.");
@@ -49,39 +52,114 @@ bool CollisionFree::isSatisfied(
       const aikido::statespace::dart::MetaSkeletonStateSpace::State*>(_state);
   mMetaSkeletonStateSpace->setState(mMetaSkeleton.get(), skelStatePtr);
 
-  bool collision = false;
-  ::dart::collision::CollisionResult collisionResult;
-  for (const auto& groups : mGroupsToPairwiseCheck)
+  return isCollisionFree(collisionFreeOutcome);
+}
+
+//==============================================================================
+bool CollisionFree::isSatisfiedBatch(
+    const std::vector<const statespace::StateSpace::State*>& states,
+    std::vector<bool>& out,
+    BatchMode mode) const
+{
+  out.assign(states.size(), false);
+
+  // Check the size of the MetaSkeleton once for the whole batch, and convert
+  // every state into the same buffer.
+  if (mMetaSkeleton->getNumDofs()
+      != mMetaSkeletonStateSpace->getProperties().getNumDofs())
   {
-    collision = mCollisionDetector->collide(
-        groups.first.get(),
-        groups.second.get(),
-        mCollisionOptions,
-        &collisionResult);
+    throw std::invalid_argument(
+        "MetaSkeleton has an incorrect number of DOFs.");
+  }
 
-    if (collision)
-    {
-      if (collisionFreeOutcome)
-      {
-        collisionFreeOutcome->mPairwiseContacts = collisionResult.getContacts();
-      }
+  bool allSatisfied = true;
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    mMetaSkeletonStateSpace->convertStateToPositions(
+        static_cast<
+            const aikido::statespace::dart::MetaSkeletonStateSpace::State*>(
+            states[i]),
+        mPositions);
+    mMetaSkeleton->setPositions(mPositions);
+
+    out[i] = isCollisionFreeFromLastCollision();
+    if (out[i])
+      continue;
+
+    allSatisfied = false;
+    if (mode == BatchMode::FirstFailure)
+      break;
+  }
+
+  return allSatisfied;
+}
+
+//==============================================================================
+std::size_t CollisionFree::getNumChecks() const
+{
+  return mGroupsToPairwiseCheck.size() + mGroupsToSelfCheck.size();
+}
+
+//==============================================================================
+bool CollisionFree::isCheckCollisionFree(
+    std::size_t check, CollisionFreeOutcome* outcome) const
+{
+  mCollisionResult.clear();
+
+  if (check < mGroupsToPairwiseCheck.size())
+  {
+    const auto& groups = mGroupsToPairwiseCheck[check];
+    if (!mCollisionDetector->collide(
+            groups.first.get(),
+            groups.second.get(),
+            mCollisionOptions,
+            &mCollisionResult))
+      return true;
+
+    if (outcome)
+      outcome->mPairwiseContacts = mCollisionResult.getContacts();
+    return false;
+  }
+
+  const auto& group = mGroupsToSelfCheck[check - mGroupsToPairwiseCheck.size()];
+  if (!mCollisionDetector->collide(
+          group.get(), mCollisionOptions, &mCollisionResult))
+    return true;
+
+  if (outcome)
+    outcome->mSelfContacts = mCollisionResult.getContacts();
+  return false;
+}
+
+//==============================================================================
+bool CollisionFree::isCollisionFree(CollisionFreeOutcome* outcome) const
+{
+  const std::size_t numChecks = getNumChecks();
+  for (std::size_t check = 0; check < numChecks; ++check)
+  {
+    if (!isCheckCollisionFree(check, outcome))
       return false;
-    }
   }
 
-  for (const auto& group : mGroupsToSelfCheck)
+  return true;
+}
+
+//==============================================================================
+bool CollisionFree::isCollisionFreeFromLastCollision() const
+{
+  // Nearby configurations tend to collide in the same way, so start with the
+  // check that found the last collision.
+  const std::size_t numChecks = getNumChecks();
+  for (std::size_t i = 0; i < numChecks; ++i)
   {
-    collision = mCollisionDetector->collide(
-        group.get(), mCollisionOptions, &collisionResult);
-    if (collision)
+    const std::size_t check = (mLastCollidingCheck + i) % numChecks;
+    if (!isCheckCollisionFree(check, nullptr))
     {
-      if (collisionFreeOutcome)
-      {
-        collisionFreeOutcome->mSelfContacts = collisionResult.getContacts();
-      }
+      mLastCollidingCheck = check;
       return false;
     }
   }
+
   return true;
 }
 
@@ -1,5 +1,6 @@
 #include "aikido/constraint/dart/TSR.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <random>
 #include <stdexcept>
@@ -19,6 +20,147 @@ namespace aikido {
 namespace constraint {
 namespace dart {
 
+namespace {
+
+//==============================================================================
+/// Distance from \c value to the interval [\c lower, \c upper]. If
+/// \c derivative is not nullptr, it is set to the derivative of the distance
+/// with respect to \c value.
+double computeTranslationDistance(
+    double value, double lower, double upper, double* derivative)
+{
+  double distance = 0;
+  double slope = 0;
+
+  if (value < lower)
+  {
+    distance = lower - value;
+    slope = -1;
+  }
+  else if (value > upper)
+  {
+    distance = value - upper;
+    slope = 1;
+  }
+
+  if (derivative)
+    *derivative = slope;
+  return distance;
+}
+
+//==============================================================================
+/// Distance on the circle from the Euler angle \c angle, in [-pi, pi], to the
+/// interval [\c lower, \c upper]. If \c derivative is not nullptr, it is set
+/// to the derivative of the distance with respect to \c angle.
+double computeRotationDistance(
+    double angle, double lower, double upper, double* derivative)
+{
+  double distance = 0;
+  double slope = 0;
+
+  // Find n such that: 2*n*pi <= lower < 2*(n+1)*pi
+  int n = lower / (2 * M_PI);
+
+  // Map angle to [2*n*pi, 2*(n+1)*pi)
+  angle += M_PI * 2 * n;
+
+  // check if angle is within bound
+  if ((angle >= lower && angle <= upper)
+      || (angle + M_PI * 2 >= lower && angle + M_PI * 2 <= upper)
+      || (angle - M_PI * 2 >= lower && angle - M_PI * 2 <= upper))
+  {
+    // Inside the bound.
+  }
+  // Take min-distance between angle and either side of bound
+  else if (angle < lower)
+  {
+    const double toLower = lower - angle;
+    const double toUpper = angle - (upper - 2 * M_PI);
+    distance = std::min(toLower, toUpper);
+    slope = toLower <= toUpper ? -1 : 1;
+  }
+  else if (upper < angle)
+  {
+    const double toUpper = angle - upper;
+    const double toLower = lower + 2 * M_PI - angle;
+    distance = std::min(toUpper, toLower);
+    slope = toUpper <= toLower ? 1 : -1;
+  }
+
+  if (derivative)
+    *derivative = slope;
+  return distance;
+}
+
+//==============================================================================
+/// Maps a spatial angular velocity to the rates of the (roll, pitch, yaw)
+/// angles of R = Rz(yaw) * Ry(pitch) * Rx(roll). Singular at pitch = +/-pi/2.
+Eigen::Matrix3d computeEulerXYZRateMap(const Eigen::Vector3d& rollPitchYaw)
+{
+  const double sp = std::sin(rollPitchYaw[1]);
+  const double cp = std::cos(rollPitchYaw[1]);
+  const double sy = std::sin(rollPitchYaw[2]);
+  const double cy = std::cos(rollPitchYaw[2]);
+
+  Eigen::Matrix3d rateMap;
+  rateMap << cy / cp, sy / cp, 0, -sy, cy, 0, cy * sp / cp, sy * sp / cp, 1;
+  return rateMap;
+}
+
+//==============================================================================
+/// Left Jacobian of the SE(3) exponential map at \c twist, in DART's (angular,
+/// linear) ordering, such that exp(twist + d) = exp(J d) * exp(twist) to first
+/// order.
+Eigen::Matrix6d computeSE3LeftJacobian(const Eigen::Vector6d& twist)
+{
+  const Eigen::Matrix3d W = ::dart::math::makeSkewSymmetric(twist.head<3>());
+  const Eigen::Matrix3d V = ::dart::math::makeSkewSymmetric(twist.tail<3>());
+  const Eigen::Matrix3d WW = W * W;
+  const double theta = twist.head<3>().norm();
+
+  // Coefficients of the closed-form series; use their Taylor expansions near
+  // the identity to avoid cancellation.
+  double a, b, c, d;
+  if (theta < 1e-4)
+  {
+    const double theta2 = theta * theta;
+    a = 0.5 - theta2 / 24.;
+    b = 1. / 6. - theta2 / 120.;
+    c = 1. / 24. - theta2 / 720.;
+    d = 1. / 120. - theta2 / 2520.;
+  }
+  else
+  {
+    const double theta2 = theta * theta;
+    const double sinTheta = std::sin(theta);
+    const double cosTheta = std::cos(theta);
+    a = (1. - cosTheta) / theta2;
+    b = (theta - sinTheta) / (theta2 * theta);
+    c = (theta2 + 2. * cosTheta - 2.) / (2. * theta2 * theta2);
+    d = (2. * theta - 3. * sinTheta + theta * cosTheta)
+        / (2. * theta2 * theta2 * theta);
+  }
+
+  const Eigen::Matrix3d rotationJacobian
+      = Eigen::Matrix3d::Identity() + a * W + b * WW;
+
+  const Eigen::Matrix3d WV = W * V;
+  const Eigen::Matrix3d VW = V * W;
+  const Eigen::Matrix3d WVW = WV * W;
+  const Eigen::Matrix3d coupling = 0.5 * V + b * (WV + VW + WVW)
+                                   + c * (WW * V + VW * W - 3. * WVW)
+                                   + d * (WVW * W + W * WVW);
+
+  Eigen::Matrix6d jacobian;
+  jacobian.topLeftCorner<3, 3>() = rotationJacobian;
+  jacobian.topRightCorner<3, 3>().setZero();
+  jacobian.bottomLeftCorner<3, 3>() = coupling;
+  jacobian.bottomRightCorner<3, 3>() = rotationJacobian;
+  return jacobian;
+}
+
+} // namespace
+
 class TSRSampleGenerator : public SampleGenerator
 {
 public:
@@ -283,39 +425,14 @@ void TSR::getValue(
 
   for (int i = 0; i < 3; ++i)
   {
-    if (translation(i) < mBw(i, 0))
-      _out(i) = std::abs(translation(i) - mBw(i, 0));
-
-    else if (translation(i) > mBw(i, 1))
-      _out(i) = std::abs(translation(i) - mBw(i, 1));
-
-    else
-      _out(i) = 0;
+    _out(i) = computeTranslationDistance(
+        translation(i), mBw(i, 0), mBw(i, 1), nullptr);
   }
 
   for (int i = 3; i < 6; ++i)
   {
-    // Find n such that: 2*n*pi <= mBw(i, 0) < 2*(n+1)*pi
-    int n = mBw(i, 0) / (2 * M_PI);
-
-    // Map eulerZYX(i-3) to [2*n*pi, 2*(n+1)*pi)
-    double angle = M_PI * 2 * n + eulerZYX(i - 3);
-
-    // check if angle is within bound
-    if ((angle >= mBw(i, 0) && angle <= mBw(i, 1))
-        || (angle + M_PI * 2 >= mBw(i, 0) && angle + M_PI * 2 <= mBw(i, 1))
-        || (angle - M_PI * 2 >= mBw(i, 0) && angle - M_PI * 2 <= mBw(i, 1)))
-    {
-      _out(i) = 0;
-      continue;
-    }
-
-    // Take min-distance between angle and either side of bound
-    if (angle < mBw(i, 0))
-      _out(i) = std::min(mBw(i, 0) - angle, angle - (mBw(i, 1) - 2 * M_PI));
-
-    else if (mBw(i, 1) < angle)
-      _out(i) = std::min(angle - mBw(i, 1), mBw(i, 0) + 2 * M_PI - angle);
+    _out(i) = computeRotationDistance(
+        eulerZYX(i - 3), mBw(i, 0), mBw(i, 1), nullptr);
   }
 }
 
@@ -325,40 +442,55 @@ void TSR::getJacobian(
 {
   using SE3 = statespace::SE3;
   using SE3State = SE3::State;
-
-  _out.resize(6, 6);
+  using TransformTraits = Eigen::TransformTraits;
 
   auto se3state = static_cast<const SE3State*>(_s);
   Eigen::Isometry3d se3 = se3state->getIsometry();
 
-  Eigen::Vector6d twist = ::dart::math::logMap(se3);
-
-  Eigen::Vector6d posit(twist), negat(twist);
-
-  static constexpr double eps = 1e-5;
+  Eigen::Isometry3d T0_w_inv = mT0_w.inverse(TransformTraits::Isometry);
+  Eigen::Isometry3d Tw_e_inv = mTw_e.inverse(TransformTraits::Isometry);
+  Eigen::Isometry3d T0_s = se3 * Tw_e_inv;
+  Eigen::Isometry3d Tw_s = T0_w_inv * T0_s;
 
-  auto se3posit = mStateSpace->createState();
-  auto se3negat = mStateSpace->createState();
+  Eigen::Vector3d translation = Tw_s.translation();
+  Eigen::Vector3d eulerOrig = ::dart::math::matrixToEulerZYX(Tw_s.linear());
+  Eigen::Vector3d eulerZYX = eulerOrig.reverse();
 
-  // Finite Differencing.
-  for (int i = 0; i < 6; ++i)
+  // Derivative of each component of the distance with respect to the
+  // corresponding translation or Euler angle of Tw_s.
+  Eigen::Vector6d slopes;
+  for (int i = 0; i < 3; ++i)
   {
-    posit(i) = twist(i) + eps;
-    negat(i) = twist(i) - eps;
-
-    se3posit.setIsometry(::dart::math::expMap(posit));
-    se3negat.setIsometry(::dart::math::expMap(negat));
-
-    Eigen::VectorXd positValue, negatValue;
-    getValue(se3posit, positValue);
-    getValue(se3negat, negatValue);
-
-    Eigen::Vector6d diff = positValue - negatValue;
-    _out.col(i) = diff / (2 * eps);
-
-    posit(i) = twist(i);
-    negat(i) = twist(i);
+    computeTranslationDistance(
+        translation(i), mBw(i, 0), mBw(i, 1), &slopes(i));
   }
+  for (int i = 3; i < 6; ++i)
+  {
+    computeRotationDistance(
+        eulerZYX(i - 3), mBw(i, 0), mBw(i, 1), &slopes(i));
+  }
+
+  _out.setZero(6, 6);
+  if (slopes.isZero())
+    return;
+
+  // Perturbing _s by a spatial twist (w, v), i.e. premultiplying it by
+  // exp((w, v)), rotates Tw_s by R0_w^T w and moves its origin by
+  // R0_w^T (v + w x p0_s).
+  const Eigen::Matrix3d R0_w_inv = T0_w_inv.linear();
+  Eigen::Matrix6d poseJacobian;
+  poseJacobian.topLeftCorner<3, 3>()
+      = -R0_w_inv * ::dart::math::makeSkewSymmetric(T0_s.translation());
+  poseJacobian.topRightCorner<3, 3>() = R0_w_inv;
+  poseJacobian.bottomLeftCorner<3, 3>()
+      = computeEulerXYZRateMap(eulerZYX) * R0_w_inv;
+  poseJacobian.bottomRightCorner<3, 3>().setZero();
+
+  // Map the spatial twist to the se(3) tangent vector of _s.
+  const Eigen::Matrix6d leftJacobian
+      = computeSE3LeftJacobian(::dart::math::logMap(se3));
+
+  _out = slopes.asDiagonal() * (poseJacobian * leftJacobian);
 }
 
 //==============================================================================
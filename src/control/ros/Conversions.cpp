@@ -45,6 +45,7 @@ void checkVector(
     Eigen::VectorXd& output);
 
 /// Fits a polynomial between two states [t, position, velocity, acceleration].
+/// The polynomial is a function of the time elapsed since \c currTime.
 /// \param[in] currTime Start time.
 /// \param[in] currPosition Start position.
 /// \param[in] currVelocity Start Velocity.
@@ -95,17 +96,6 @@ void extractJointTrajectoryPoint(
     const std::vector<std::size_t>& unspecifiedJoints,
     const Eigen::VectorXd& startPositions);
 
-/// Extract a state on the trajectory given a timepoint.
-/// \param[in] space MetaSkeletonStateSpace of the trajectory.
-/// \param[in] trajectory Trajectory to extract point from.
-/// \param[in] timeFromStart Timepoint to extract trajectory point at.
-/// \param[out] waypoint The extracted trajectory point.
-void extractTrajectoryPoint(
-    const std::shared_ptr<const MetaSkeletonStateSpace>& space,
-    const aikido::trajectory::ConstTrajectoryPtr& trajectory,
-    double timeFromStart,
-    trajectory_msgs::JointTrajectoryPoint& waypoint);
-
 //==============================================================================
 void reorder(
     const std::vector<std::pair<std::size_t, std::size_t>>& indexMap,
@@ -158,38 +148,30 @@ Eigen::MatrixXd fitPolynomial(
     const Eigen::VectorXd& _nextAcceleration,
     std::size_t _numCoefficients)
 {
-  using aikido::common::SplineProblem;
-
   assert(
       _numCoefficients == 2 || _numCoefficients == 4 || _numCoefficients == 6);
 
-  const auto numDofs = _currPosition.size();
-  SplineProblem<> splineProblem(
-      Eigen::Vector2d(_currTime, _nextTime), _numCoefficients, numDofs);
-
-  assert(_currPosition.size() == numDofs);
-  assert(_nextPosition.size() == numDofs);
-  splineProblem.addConstantConstraint(0, 0, _currPosition);
-  splineProblem.addConstantConstraint(1, 0, _nextPosition);
-
-  if (_numCoefficients >= 4)
+  const double duration = _nextTime - _currTime;
+  if (_numCoefficients == 2)
   {
-    assert(_currVelocity.size() == numDofs);
-    assert(_nextVelocity.size() == numDofs);
-    splineProblem.addConstantConstraint(0, 1, _currVelocity);
-    splineProblem.addConstantConstraint(1, 1, _nextVelocity);
+    return aikido::common::fitLinearSegment(
+        _currPosition, _nextPosition, duration);
   }
 
-  if (_numCoefficients >= 6)
+  if (_numCoefficients == 4)
   {
-    assert(_currAcceleration.size() == numDofs);
-    assert(_nextAcceleration.size() == numDofs);
-    splineProblem.addConstantConstraint(0, 2, _currAcceleration);
-    splineProblem.addConstantConstraint(1, 2, _nextAcceleration);
+    return aikido::common::fitCubicSegment(
+        _currPosition, _currVelocity, _nextPosition, _nextVelocity, duration);
   }
 
-  const auto splineSegment = splineProblem.fit();
-  return splineSegment.getCoefficients()[0];
+  return aikido::common::fitQuinticSegment(
+      _currPosition,
+      _currVelocity,
+      _currAcceleration,
+      _nextPosition,
+      _nextVelocity,
+      _nextAcceleration,
+      duration);
 }
 
 //==============================================================================
@@ -253,42 +235,6 @@ void extractJointTrajectoryPoint(
   }
 }
 
-//==============================================================================
-void extractTrajectoryPoint(
-    const std::shared_ptr<const MetaSkeletonStateSpace>& space,
-    const aikido::trajectory::ConstTrajectoryPtr& trajectory,
-    double timeFromStart,
-    trajectory_msgs::JointTrajectoryPoint& waypoint)
-{
-  const auto numDerivatives = std::min<int>(trajectory->getNumDerivatives(), 1);
-  const auto timeAbsolute = trajectory->getStartTime() + timeFromStart;
-  const int numDof = space->getDimension();
-  DART_UNUSED(numDof);
-
-  Eigen::VectorXd tangentVector;
-  auto state = space->createState();
-  trajectory->evaluate(timeAbsolute, state);
-  space->logMap(state, tangentVector);
-
-  assert(tangentVector.size() == numDof);
-
-  waypoint.time_from_start = ::ros::Duration(timeFromStart);
-  waypoint.positions.assign(
-      tangentVector.data(), tangentVector.data() + tangentVector.size());
-
-  assert(0 <= numDerivatives && numDerivatives <= 2);
-  const std::array<std::vector<double>*, 2> derivatives{
-      &waypoint.velocities, &waypoint.accelerations};
-  for (int iDerivative = 1; iDerivative <= numDerivatives; ++iDerivative)
-  {
-    trajectory->evaluateDerivative(timeAbsolute, iDerivative, tangentVector);
-    assert(tangentVector.size() == numDof);
-
-    derivatives[iDerivative - 1]->assign(
-        tangentVector.data(), tangentVector.data() + tangentVector.size());
-  }
-}
-
 } // namespace
 
 //==============================================================================
@@ -585,13 +531,34 @@ trajectory_msgs::JointTrajectory toRosJointTrajectory(
     jointTrajectory.joint_names.emplace_back(jointDofName);
   }
 
-  // Evaluate trajectory at each timestep and insert it into jointTrajectory
+  // Evaluate trajectory at all timesteps at once
+  Eigen::VectorXd times(numWaypoints);
+  for (std::size_t i = 0; i < numWaypoints; ++i)
+    times[i] = trajectory->getStartTime() + timeSequence[i];
+
+  const auto numDerivatives = std::min<int>(trajectory->getNumDerivatives(), 1);
+  Eigen::MatrixXd positions;
+  Eigen::MatrixXd velocities;
+  trajectory->evaluateBatch(times, positions);
+  if (numDerivatives >= 1)
+    trajectory->evaluateDerivativeBatch(times, 1, velocities);
+
+  assert(positions.rows() == static_cast<int>(space->getDimension()));
+
+  // Insert the evaluated points into jointTrajectory
   jointTrajectory.points.reserve(numWaypoints);
-  for (const auto& timeFromStart : timeSequence)
+  for (std::size_t i = 0; i < numWaypoints; ++i)
   {
     trajectory_msgs::JointTrajectoryPoint waypoint;
-
-    extractTrajectoryPoint(space, trajectory, timeFromStart, waypoint);
+    waypoint.time_from_start = ::ros::Duration(timeSequence[i]);
+    waypoint.positions.assign(
+        positions.col(i).data(), positions.col(i).data() + positions.rows());
+    if (numDerivatives >= 1)
+    {
+      waypoint.velocities.assign(
+          velocities.col(i).data(),
+          velocities.col(i).data() + velocities.rows());
+    }
 
     jointTrajectory.points.emplace_back(waypoint);
   }
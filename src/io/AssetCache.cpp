@@ -0,0 +1,267 @@
+#include "aikido/io/AssetCache.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include <sys/stat.h>
+
+#include "SkeletonCache.hpp"
+
+namespace aikido {
+namespace io {
+
+namespace {
+
+/// Modification time and size of a local file, used to detect changes.
+struct FileStamp
+{
+  std::int64_t mModificationTime;
+  std::int64_t mSize;
+
+  bool operator==(const FileStamp& other) const
+  {
+    return mModificationTime == other.mModificationTime
+           && mSize == other.mSize;
+  }
+};
+
+//==============================================================================
+/// Returns the local file that \c retriever resolves \c uri to, or an empty
+/// string if it is not a local file.
+std::string getLocalFilePath(
+    const dart::common::Uri& uri,
+    const dart::common::ResourceRetrieverPtr& retriever)
+{
+#if DART_VERSION_AT_LEAST(6, 10, 0)
+  if (retriever)
+  {
+    const auto path = retriever->getFilePath(uri);
+    if (!path.empty())
+      return path;
+  }
+#else
+  // Without ResourceRetriever::getFilePath(), only file URIs are known to be
+  // local files.
+  DART_UNUSED(retriever);
+#endif
+
+  // Retrievers that do not implement getFilePath() are assumed to read file
+  // URIs from the local filesystem.
+  if (uri.mScheme.get_value_or("file") == "file" && uri.mPath)
+    return uri.getFilesystemPath();
+
+  return std::string();
+}
+
+//==============================================================================
+template <class T>
+std::shared_ptr<T> lockValue(const std::shared_ptr<T>& value)
+{
+  return value;
+}
+
+//==============================================================================
+template <class T>
+std::shared_ptr<T> lockValue(const std::weak_ptr<T>& value)
+{
+  return value.lock();
+}
+
+//==============================================================================
+/// Returns the stamp of the file at \c path, or a zero stamp if the file
+/// cannot be accessed.
+FileStamp getFileStamp(const std::string& path)
+{
+  FileStamp stamp{0, 0};
+
+  struct stat fileStat;
+  if (::stat(path.c_str(), &fileStat) == 0)
+  {
+    stamp.mModificationTime
+        = static_cast<std::int64_t>(fileStat.st_mtim.tv_sec) * 1000000000
+          + static_cast<std::int64_t>(fileStat.st_mtim.tv_nsec);
+    stamp.mSize = static_cast<std::int64_t>(fileStat.st_size);
+  }
+  return stamp;
+}
+
+/// Thread-safe map from a local file to a value loaded from it. The value is
+/// loaded outside of the lock, so that loading different files does not
+/// serialize. If two threads load the same file at once, the first result
+/// to be inserted is kept.
+///
+/// \tparam T type of the values
+/// \tparam Pointer std::shared_ptr<T> to keep values until clear() is called,
+/// or std::weak_ptr<T> to keep them only while they are used elsewhere
+template <class T, class Pointer = std::shared_ptr<T>>
+class FileCache
+{
+public:
+  /// Returns the value cached under \c key for the file at \c path, calling
+  /// \c load to load it if there is none or the file changed. If \c path is
+  /// empty, the resource is not a local file and \c load is always called.
+  std::shared_ptr<T> get(
+      const std::string& key,
+      const std::string& path,
+      const std::function<std::shared_ptr<T>()>& load)
+  {
+    if (path.empty())
+      return load();
+
+    const auto fullKey = key + ' ' + path;
+    const auto stamp = getFileStamp(path);
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      const auto it = mEntries.find(fullKey);
+      if (it != mEntries.end() && it->second.mStamp == stamp)
+      {
+        if (auto value = lockValue(it->second.mValue))
+          return value;
+      }
+    }
+
+    auto value = load();
+    if (!value)
+      return nullptr;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    removeUnusedEntries();
+
+    auto& entry = mEntries[fullKey];
+    auto cachedValue = lockValue(entry.mValue);
+    if (cachedValue && entry.mStamp == stamp)
+      return cachedValue;
+
+    entry.mStamp = stamp;
+    entry.mValue = value;
+    return value;
+  }
+
+  /// Removes all values.
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.clear();
+  }
+
+private:
+  struct Entry
+  {
+    FileStamp mStamp;
+    Pointer mValue;
+  };
+
+  /// Removes the entries whose value is no longer used. Must be called with
+  /// mMutex locked.
+  void removeUnusedEntries()
+  {
+    for (auto it = mEntries.begin(); it != mEntries.end();)
+    {
+      if (lockValue(it->second.mValue))
+        ++it;
+      else
+        it = mEntries.erase(it);
+    }
+  }
+
+  std::mutex mMutex;
+  std::unordered_map<std::string, Entry> mEntries;
+};
+
+/// Parsed Skeleton that is cloned for each caller.
+struct SkeletonPrototype
+{
+  /// Serializes cloning, which reads the lazily updated state of mSkeleton.
+  std::mutex mMutex;
+  dart::dynamics::SkeletonPtr mSkeleton;
+};
+
+//==============================================================================
+/// Meshes are only cached while a Skeleton or caller uses them.
+using MeshShapeCache = FileCache<
+    dart::dynamics::MeshShape,
+    std::weak_ptr<dart::dynamics::MeshShape>>;
+
+//==============================================================================
+MeshShapeCache& getMeshShapeCache()
+{
+  static MeshShapeCache cache;
+  return cache;
+}
+
+//==============================================================================
+FileCache<SkeletonPrototype>& getSkeletonCache()
+{
+  static FileCache<SkeletonPrototype> cache;
+  return cache;
+}
+
+} // namespace
+
+//==============================================================================
+std::shared_ptr<dart::dynamics::MeshShape> loadMeshShape(
+    const dart::common::Uri& meshUri,
+    const Eigen::Vector3d& scale,
+    const dart::common::ResourceRetrieverPtr& retriever)
+{
+  std::ostringstream key;
+  key.precision(17);
+  key << scale[0] << ' ' << scale[1] << ' ' << scale[2];
+
+  return getMeshShapeCache().get(
+      key.str(),
+      getLocalFilePath(meshUri, retriever),
+      [&]() -> std::shared_ptr<dart::dynamics::MeshShape> {
+        auto model = dart::dynamics::MeshShape::loadMesh(meshUri, retriever);
+        if (!model)
+          return nullptr;
+
+        return std::make_shared<dart::dynamics::MeshShape>(
+            scale, model, meshUri, retriever);
+      });
+}
+
+//==============================================================================
+void clearAssetCache()
+{
+  getMeshShapeCache().clear();
+  getSkeletonCache().clear();
+}
+
+namespace detail {
+
+//==============================================================================
+dart::dynamics::SkeletonPtr loadCachedSkeleton(
+    const std::string& key,
+    const dart::common::Uri& uri,
+    const dart::common::ResourceRetrieverPtr& retriever,
+    const std::function<dart::dynamics::SkeletonPtr()>& load)
+{
+  const auto prototype = getSkeletonCache().get(
+      key,
+      getLocalFilePath(uri, retriever),
+      [&]() -> std::shared_ptr<SkeletonPrototype> {
+        auto skeleton = load();
+        if (!skeleton)
+          return nullptr;
+
+        auto newPrototype = std::make_shared<SkeletonPrototype>();
+        newPrototype->mSkeleton = std::move(skeleton);
+        return newPrototype;
+      });
+
+  if (!prototype)
+    return nullptr;
+
+  std::lock_guard<std::mutex> lock(prototype->mMutex);
+  return prototype->mSkeleton->cloneSkeleton();
+}
+
+} // namespace detail
+} // namespace io
+} // namespace aikido
@@ -0,0 +1,169 @@
+#include "BinaryFile.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aikido {
+namespace io {
+namespace detail {
+
+//==============================================================================
+MappedFile::MappedFile(const std::string& path) : mData(nullptr), mSize(0)
+{
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error(
+        "Unable to open '" + path + "': " + std::strerror(errno));
+
+  struct stat fileStat;
+  if (::fstat(fd, &fileStat) != 0)
+  {
+    const int error = errno;
+    ::close(fd);
+    throw std::runtime_error(
+        "Unable to stat '" + path + "': " + std::strerror(error));
+  }
+  mSize = static_cast<std::size_t>(fileStat.st_size);
+
+  if (mSize > 0)
+  {
+    void* data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      const int error = errno;
+      ::close(fd);
+      throw std::runtime_error(
+          "Unable to map '" + path + "': " + std::strerror(error));
+    }
+    mData = static_cast<const char*>(data);
+  }
+
+  // The mapping stays valid after the file is closed.
+  ::close(fd);
+}
+
+//==============================================================================
+MappedFile::~MappedFile()
+{
+  if (mData)
+    ::munmap(const_cast<char*>(mData), mSize);
+}
+
+//==============================================================================
+const char* MappedFile::getData() const
+{
+  return mData;
+}
+
+//==============================================================================
+std::size_t MappedFile::getSize() const
+{
+  return mSize;
+}
+
+//==============================================================================
+void checkLittleEndian()
+{
+  const std::uint16_t value = 1;
+  char firstByte;
+  std::memcpy(&firstByte, &value, 1);
+  if (firstByte != 1)
+    throw std::runtime_error(
+        "Binary files are only supported on little-endian hosts");
+}
+
+//==============================================================================
+std::uint64_t getDofNamesSize(const std::vector<std::string>& dofNames)
+{
+  std::uint64_t size = 0;
+  for (const auto& name : dofNames)
+    size += sizeof(std::uint32_t) + name.size();
+  return (size + 7u) & ~static_cast<std::uint64_t>(7u);
+}
+
+//==============================================================================
+void writeDofNames(
+    std::ostream& stream, const std::vector<std::string>& dofNames)
+{
+  std::uint64_t written = 0;
+  for (const auto& name : dofNames)
+  {
+    write(stream, static_cast<std::uint32_t>(name.size()));
+    stream.write(name.data(), name.size());
+    written += sizeof(std::uint32_t) + name.size();
+  }
+
+  const char padding[8] = {};
+  stream.write(padding, getDofNamesSize(dofNames) - written);
+}
+
+//==============================================================================
+void checkDofNames(
+    const char* data,
+    std::uint64_t size,
+    const std::vector<std::string>& dofNames)
+{
+  std::uint64_t offset = 0;
+  for (const auto& name : dofNames)
+  {
+    std::uint32_t length;
+    if (size - offset < sizeof(length))
+      throw std::runtime_error("Binary file is truncated");
+    std::memcpy(&length, data + offset, sizeof(length));
+    offset += sizeof(length);
+
+    if (size - offset < length)
+      throw std::runtime_error("Binary file is truncated");
+    if (name.compare(0, std::string::npos, data + offset, length) != 0)
+      throw std::runtime_error("Dof names should be same");
+    offset += length;
+  }
+}
+
+//==============================================================================
+std::uint64_t multiplyCount(std::uint64_t count, std::uint64_t size)
+{
+  if (size != 0 && count > std::numeric_limits<std::uint64_t>::max() / size)
+    throw std::runtime_error("Binary file is truncated");
+  return count * size;
+}
+
+//==============================================================================
+void addSegments(
+    trajectory::Spline& trajectory,
+    const statespace::StateSpace& stateSpace,
+    std::size_t numSegments,
+    const std::uint64_t* numCoefficients,
+    const double* durations,
+    const double* startStates,
+    const double* coefficients)
+{
+  const auto numDofs = static_cast<Eigen::Index>(stateSpace.getDimension());
+  auto startState = stateSpace.createState();
+
+  Eigen::VectorXd position(numDofs);
+  for (std::size_t i = 0; i < numSegments; ++i)
+  {
+    const auto numSegmentCoefficients
+        = static_cast<Eigen::Index>(numCoefficients[i]);
+    const Eigen::Map<const Eigen::MatrixXd> segmentCoefficients(
+        coefficients, numDofs, numSegmentCoefficients);
+    coefficients += numDofs * numSegmentCoefficients;
+
+    position = Eigen::Map<const Eigen::VectorXd>(
+        startStates + i * numDofs, numDofs);
+    stateSpace.expMap(position, startState);
+
+    trajectory.addSegment(segmentCoefficients, durations[i], startState);
+  }
+}
+
+} // namespace detail
+} // namespace io
+} // namespace aikido
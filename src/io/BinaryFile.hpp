@@ -0,0 +1,115 @@
+#ifndef AIKIDO_IO_BINARYFILE_HPP_
+#define AIKIDO_IO_BINARYFILE_HPP_
+
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "aikido/statespace/StateSpace.hpp"
+#include "aikido/trajectory/Spline.hpp"
+
+namespace aikido {
+namespace io {
+namespace detail {
+
+/// Read-only memory mapping of a file that is unmapped on destruction.
+class MappedFile
+{
+public:
+  /// Maps the file at \c path.
+  ///
+  /// \param path path of the file
+  /// \throw std::runtime_error if the file cannot be opened or mapped
+  explicit MappedFile(const std::string& path);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile();
+
+  /// Returns the contents of the file, or nullptr if it is empty.
+  const char* getData() const;
+
+  /// Returns the size of the file in bytes.
+  std::size_t getSize() const;
+
+private:
+  const char* mData;
+  std::size_t mSize;
+};
+
+/// Throws std::runtime_error unless the host is little-endian. The binary
+/// formats use the mapped arrays in place, which requires the host byte
+/// order to match the file.
+void checkLittleEndian();
+
+/// Writes the raw bytes of \c value to \c stream.
+template <class T>
+void write(std::ostream& stream, const T& value)
+{
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// Returns a pointer to the \c count values of type \c T at \c offset in
+/// \c file, and advances \c offset past them.
+///
+/// \throw std::runtime_error if the file is too short
+template <class T>
+const T* readArray(
+    const MappedFile& file, std::size_t& offset, std::uint64_t count)
+{
+  if (offset > file.getSize()
+      || count > (file.getSize() - offset) / sizeof(T))
+  {
+    throw std::runtime_error("Binary file is truncated");
+  }
+
+  const T* array = reinterpret_cast<const T*>(file.getData() + offset);
+  offset += count * sizeof(T);
+  return array;
+}
+
+/// Returns the size, in bytes, of the section written by \c writeDofNames.
+std::uint64_t getDofNamesSize(const std::vector<std::string>& dofNames);
+
+/// Writes each DOF name as a uint32 length followed by its characters, and
+/// zero-pads the section to a multiple of 8 bytes.
+void writeDofNames(
+    std::ostream& stream, const std::vector<std::string>& dofNames);
+
+/// Checks that the section of \c size bytes at \c data, written by
+/// \c writeDofNames, holds \c dofNames.
+///
+/// \throw std::runtime_error if the DOF names differ
+void checkDofNames(
+    const char* data,
+    std::uint64_t size,
+    const std::vector<std::string>& dofNames);
+
+/// Returns the product of \c count and \c size.
+///
+/// \throw std::runtime_error if the product overflows, which can only happen
+/// for a malformed file
+std::uint64_t multiplyCount(std::uint64_t count, std::uint64_t size);
+
+/// Appends segments stored as contiguous arrays to \c trajectory. The i-th
+/// segment has \c numCoefficients[i] coefficients per DOF and its start state
+/// is the exponential map of the i-th \c numDofs values of \c startStates.
+/// The coefficient matrices are stored back to back in column-major order in
+/// \c coefficients.
+void addSegments(
+    trajectory::Spline& trajectory,
+    const statespace::StateSpace& stateSpace,
+    std::size_t numSegments,
+    const std::uint64_t* numCoefficients,
+    const double* durations,
+    const double* startStates,
+    const double* coefficients);
+
+} // namespace detail
+} // namespace io
+} // namespace aikido
+
+#endif // AIKIDO_IO_BINARYFILE_HPP_
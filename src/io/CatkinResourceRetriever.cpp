@@ -162,6 +162,18 @@ dart::common::ResourcePtr CatkinResourceRetriever::retrieve(const Uri& _uri)
     return nullptr;
 }
 
+//==============================================================================
+#if DART_VERSION_AT_LEAST(6, 10, 0)
+std::string CatkinResourceRetriever::getFilePath(const Uri& _uri)
+{
+  const Uri resolvedUri = resolvePackageUri(_uri);
+  if (resolvedUri.mPath)
+    return mDelegate->getFilePath(resolvedUri);
+  else
+    return std::string();
+}
+#endif
+
 //==============================================================================
 auto CatkinResourceRetriever::getWorkspaces() const -> std::vector<Workspace>
 {
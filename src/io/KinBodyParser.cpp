@@ -11,6 +11,9 @@
 #include <dart/utils/utils.hpp>
 
 #include "aikido/common/string.hpp"
+#include "aikido/io/AssetCache.hpp"
+
+#include "SkeletonCache.hpp"
 
 namespace aikido {
 namespace io {
@@ -89,20 +92,27 @@ dart::dynamics::SkeletonPtr readKinbody(
 {
   const auto retriever = getRetriever(nullOrRetriever);
 
-  // Parse XML file
-  tinyxml2::XMLDocument kinBodyDoc;
-  try
-  {
-    dart::utils::openXMLFile(kinBodyDoc, kinBodyUri, retriever);
-  }
-  catch (const std::exception& e)
-  {
-    dtwarn << "[KinBodyParser] Failed to load '" << kinBodyUri.toString()
-           << "'. Reason: " << e.what() << ". Returning nullptr.\n";
-    return nullptr;
-  }
-
-  return readKinBody(kinBodyDoc, kinBodyUri, retriever);
+  return detail::loadCachedSkeleton(
+      "kinbody",
+      kinBodyUri,
+      retriever,
+      [&]() -> dart::dynamics::SkeletonPtr {
+        // Parse XML file
+        tinyxml2::XMLDocument kinBodyDoc;
+        try
+        {
+          dart::utils::openXMLFile(kinBodyDoc, kinBodyUri, retriever);
+        }
+        catch (const std::exception& e)
+        {
+          dtwarn << "[KinBodyParser] Failed to load '"
+                 << kinBodyUri.toString() << "'. Reason: " << e.what()
+                 << ". Returning nullptr.\n";
+          return nullptr;
+        }
+
+        return readKinBody(kinBodyDoc, kinBodyUri, retriever);
+      });
 }
 
 namespace {
@@ -263,12 +273,11 @@ dart::dynamics::ShapePtr readMeshShape(
     const dart::common::ResourceRetrieverPtr& retriever)
 {
   auto meshUri = dart::common::Uri::getRelativeUri(baseUri, fileName);
-  auto model = dart::dynamics::MeshShape::loadMesh(meshUri, retriever);
+  auto shape = loadMeshShape(meshUri, scale, retriever);
 
-  if (model)
+  if (shape)
   {
-    return std::make_shared<dart::dynamics::MeshShape>(
-        scale, model, meshUri, retriever);
+    return shape;
   }
   else
   {
@@ -0,0 +1,35 @@
+#ifndef AIKIDO_IO_SKELETONCACHE_HPP_
+#define AIKIDO_IO_SKELETONCACHE_HPP_
+
+#include <functional>
+#include <string>
+
+#include <dart/dart.hpp>
+
+namespace aikido {
+namespace io {
+namespace detail {
+
+/// Returns a clone of the Skeleton cached under \c key for the file that
+/// \c retriever resolves \c uri to. If there is none, or the file was
+/// modified since it was cached, \c load parses the Skeleton and the result
+/// is cached. Skeletons that are not parsed from a local file are not cached.
+/// The clones share the shapes of the cached Skeleton.
+///
+/// \param[in] key key of the Skeleton in the cache, e.g. its format
+/// \param[in] uri URI of the file the Skeleton is parsed from
+/// \param[in] retriever retriever used to resolve \c uri
+/// \param[in] load function that parses the Skeleton, returning nullptr on
+/// failure
+/// \return clone of the cached Skeleton; nullptr if \c load fails
+dart::dynamics::SkeletonPtr loadCachedSkeleton(
+    const std::string& key,
+    const dart::common::Uri& uri,
+    const dart::common::ResourceRetrieverPtr& retriever,
+    const std::function<dart::dynamics::SkeletonPtr()>& load);
+
+} // namespace detail
+} // namespace io
+} // namespace aikido
+
+#endif // AIKIDO_IO_SKELETONCACHE_HPP_
@@ -0,0 +1,506 @@
+#include "aikido/io/TrajectoryLibrary.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include "aikido/common/memory.hpp"
+#include "aikido/distance/defaults.hpp"
+
+#include "BinaryFile.hpp"
+
+using aikido::statespace::StateSpace;
+using aikido::statespace::dart::ConstMetaSkeletonStateSpacePtr;
+using aikido::statespace::dart::MetaSkeletonStateSpace;
+using aikido::trajectory::ConstSplinePtr;
+using aikido::trajectory::Spline;
+using aikido::trajectory::UniqueSplinePtr;
+
+namespace aikido {
+namespace io {
+
+namespace {
+
+constexpr char libraryMagic[8] = {'A', 'I', 'K', 'I', 'D', 'O', 'T', 'L'};
+constexpr std::uint32_t libraryVersion = 1;
+
+/// Index of a missing child in the vantage-point tree.
+constexpr std::size_t noNode = std::numeric_limits<std::size_t>::max();
+
+/// Fixed-size header at the start of a trajectory library file.
+struct TrajectoryLibraryHeader
+{
+  char mMagic[8];
+  std::uint32_t mVersion;
+  std::uint32_t mNumDofs;
+  std::uint64_t mNumTrajectories;
+  std::uint64_t mNumSegments;
+  std::uint64_t mNumCoefficients;
+  std::uint64_t mDofNamesSize;
+};
+
+static_assert(
+    sizeof(TrajectoryLibraryHeader) == 48,
+    "TrajectoryLibraryHeader must not contain padding");
+
+//==============================================================================
+bool isFartherNeighbor(
+    const TrajectoryLibrary::Neighbor& lhs,
+    const TrajectoryLibrary::Neighbor& rhs)
+{
+  return lhs.mDistance < rhs.mDistance;
+}
+
+} // namespace
+
+//==============================================================================
+TrajectoryLibrary::TrajectoryLibrary(
+    const std::string& libraryPath,
+    ConstMetaSkeletonStateSpacePtr stateSpace,
+    distance::ConstDistanceMetricPtr distanceMetric)
+  : mStateSpace(std::move(stateSpace))
+  , mDistanceMetric(std::move(distanceMetric))
+{
+  if (!mStateSpace)
+    throw std::invalid_argument("StateSpace is nullptr.");
+
+  if (!mDistanceMetric)
+    mDistanceMetric = distance::createDistanceMetric(mStateSpace);
+
+  if (mDistanceMetric->getStateSpace() != mStateSpace)
+    throw std::invalid_argument(
+        "DistanceMetric does not match the StateSpace.");
+
+  detail::checkLittleEndian();
+  mFile = ::aikido::common::make_unique<detail::MappedFile>(libraryPath);
+  const auto& file = *mFile;
+  std::size_t offset = 0;
+
+  TrajectoryLibraryHeader header;
+  std::memcpy(
+      &header,
+      detail::readArray<TrajectoryLibraryHeader>(file, offset, 1),
+      sizeof(header));
+  if (std::memcmp(header.mMagic, libraryMagic, sizeof(header.mMagic)) != 0)
+    throw std::runtime_error("File is not a trajectory library");
+  if (header.mVersion != libraryVersion)
+    throw std::runtime_error("Unsupported trajectory library version");
+
+  const std::size_t numDofs = header.mNumDofs;
+  const auto& dofNames = mStateSpace->getProperties().getDofNames();
+  if (numDofs != dofNames.size() || numDofs != mStateSpace->getDimension())
+    throw std::runtime_error("Dof names should be same");
+
+  const auto dofNamesData
+      = detail::readArray<char>(file, offset, header.mDofNamesSize);
+  detail::checkDofNames(dofNamesData, header.mDofNamesSize, dofNames);
+
+  if (header.mNumTrajectories >= std::numeric_limits<std::uint64_t>::max())
+    throw std::runtime_error("Binary file is truncated");
+  mNumTrajectories = header.mNumTrajectories;
+
+  mFirstSegments = detail::readArray<std::uint64_t>(
+      file, offset, mNumTrajectories + 1);
+  mFirstCoefficients = detail::readArray<std::uint64_t>(
+      file, offset, mNumTrajectories + 1);
+  mStartTimes = detail::readArray<double>(file, offset, mNumTrajectories);
+
+  const auto numConfigurationValues
+      = detail::multiplyCount(mNumTrajectories, numDofs);
+  const auto startConfigurations
+      = detail::readArray<double>(file, offset, numConfigurationValues);
+  const auto goalConfigurations
+      = detail::readArray<double>(file, offset, numConfigurationValues);
+
+  mNumCoefficients
+      = detail::readArray<std::uint64_t>(file, offset, header.mNumSegments);
+  mDurations = detail::readArray<double>(file, offset, header.mNumSegments);
+  mSegmentStartStates = detail::readArray<double>(
+      file, offset, detail::multiplyCount(header.mNumSegments, numDofs));
+  mCoefficients
+      = detail::readArray<double>(file, offset, header.mNumCoefficients);
+
+  // Check the segment and coefficient ranges once, so that getTrajectory can
+  // use them without bounds checks.
+  if (mFirstSegments[0] != 0 || mFirstCoefficients[0] != 0
+      || mFirstSegments[mNumTrajectories] != header.mNumSegments
+      || mFirstCoefficients[mNumTrajectories] != header.mNumCoefficients)
+  {
+    throw std::runtime_error("Trajectory library is inconsistent");
+  }
+
+  for (std::size_t i = 0; i < mNumTrajectories; ++i)
+  {
+    if (mFirstSegments[i + 1] < mFirstSegments[i]
+        || mFirstSegments[i + 1] > header.mNumSegments
+        || mFirstCoefficients[i + 1] < mFirstCoefficients[i])
+    {
+      throw std::runtime_error("Trajectory library is inconsistent");
+    }
+
+    const auto numTrajectoryCoefficients
+        = mFirstCoefficients[i + 1] - mFirstCoefficients[i];
+    std::uint64_t numSegmentCoefficients = 0;
+    for (auto j = mFirstSegments[i]; j < mFirstSegments[i + 1]; ++j)
+    {
+      const auto segmentSize
+          = detail::multiplyCount(mNumCoefficients[j], numDofs);
+      if (segmentSize > numTrajectoryCoefficients - numSegmentCoefficients)
+        throw std::runtime_error("Trajectory library is inconsistent");
+      numSegmentCoefficients += segmentSize;
+    }
+
+    if (numSegmentCoefficients != numTrajectoryCoefficients)
+      throw std::runtime_error("Trajectory library is inconsistent");
+  }
+
+  mStartStates.reserve(mNumTrajectories);
+  mGoalStates.reserve(mNumTrajectories);
+  Eigen::VectorXd position(numDofs);
+  for (std::size_t i = 0; i < mNumTrajectories; ++i)
+  {
+    position = Eigen::Map<const Eigen::VectorXd>(
+        startConfigurations + i * numDofs, numDofs);
+    mStartStates.emplace_back(mStateSpace->allocateState());
+    mStateSpace->expMap(position, mStartStates.back());
+
+    position = Eigen::Map<const Eigen::VectorXd>(
+        goalConfigurations + i * numDofs, numDofs);
+    mGoalStates.emplace_back(mStateSpace->allocateState());
+    mStateSpace->expMap(position, mGoalStates.back());
+  }
+
+  std::vector<std::pair<double, std::size_t>> trajectories(mNumTrajectories);
+  for (std::size_t i = 0; i < mNumTrajectories; ++i)
+    trajectories[i].second = i;
+
+  mNodes.reserve(mNumTrajectories);
+  buildTree(trajectories.begin(), trajectories.end());
+}
+
+//==============================================================================
+TrajectoryLibrary::~TrajectoryLibrary()
+{
+  for (auto state : mStartStates)
+    mStateSpace->freeState(state);
+  for (auto state : mGoalStates)
+    mStateSpace->freeState(state);
+}
+
+//==============================================================================
+std::size_t TrajectoryLibrary::getNumTrajectories() const
+{
+  return mNumTrajectories;
+}
+
+//==============================================================================
+const StateSpace::State* TrajectoryLibrary::getStartState(
+    std::size_t index) const
+{
+  return mStartStates.at(index);
+}
+
+//==============================================================================
+const StateSpace::State* TrajectoryLibrary::getGoalState(
+    std::size_t index) const
+{
+  return mGoalStates.at(index);
+}
+
+//==============================================================================
+UniqueSplinePtr TrajectoryLibrary::getTrajectory(std::size_t index) const
+{
+  if (index >= mNumTrajectories)
+    throw std::out_of_range("Trajectory index is out of range");
+
+  const auto firstSegment = mFirstSegments[index];
+  auto trajectory = ::aikido::common::make_unique<Spline>(
+      mStateSpace, mStartTimes[index]);
+  detail::addSegments(
+      *trajectory,
+      *mStateSpace,
+      mFirstSegments[index + 1] - firstSegment,
+      mNumCoefficients + firstSegment,
+      mDurations + firstSegment,
+      mSegmentStartStates + firstSegment * mStateSpace->getDimension(),
+      mCoefficients + mFirstCoefficients[index]);
+
+  return trajectory;
+}
+
+//==============================================================================
+std::vector<UniqueSplinePtr> TrajectoryLibrary::getTrajectories(
+    const std::vector<std::size_t>& indices) const
+{
+  std::vector<UniqueSplinePtr> trajectories;
+  trajectories.reserve(indices.size());
+  for (const auto index : indices)
+    trajectories.emplace_back(getTrajectory(index));
+
+  return trajectories;
+}
+
+//==============================================================================
+std::vector<TrajectoryLibrary::Neighbor> TrajectoryLibrary::findNearest(
+    const StateSpace::State* startState,
+    const StateSpace::State* goalState,
+    std::size_t numNeighbors) const
+{
+  std::vector<Neighbor> neighbors;
+  if (numNeighbors == 0 || mNodes.empty())
+    return neighbors;
+
+  neighbors.reserve(std::min(numNeighbors, mNumTrajectories));
+  searchTree(0, startState, goalState, numNeighbors, neighbors);
+
+  std::sort_heap(neighbors.begin(), neighbors.end(), isFartherNeighbor);
+  return neighbors;
+}
+
+//==============================================================================
+std::size_t TrajectoryLibrary::buildTree(
+    std::vector<std::pair<double, std::size_t>>::iterator first,
+    std::vector<std::pair<double, std::size_t>>::iterator last)
+{
+  if (first == last)
+    return noNode;
+
+  const auto vantage = first->second;
+  const auto node = mNodes.size();
+  mNodes.push_back(Node{vantage, 0., noNode, noNode});
+  ++first;
+
+  if (first == last)
+    return node;
+
+  for (auto it = first; it != last; ++it)
+  {
+    it->first = getDistance(
+        mStartStates[vantage], mGoalStates[vantage], it->second);
+  }
+
+  // Split the remaining trajectories at the median distance to the vantage
+  // point, so that the tree is balanced.
+  const auto middle = first + (last - first) / 2;
+  std::nth_element(first, middle, last);
+  mNodes[node].mRadius = middle->first;
+
+  const auto inside = buildTree(first, middle);
+  const auto outside = buildTree(middle, last);
+  mNodes[node].mInside = inside;
+  mNodes[node].mOutside = outside;
+
+  return node;
+}
+
+//==============================================================================
+void TrajectoryLibrary::searchTree(
+    std::size_t node,
+    const StateSpace::State* startState,
+    const StateSpace::State* goalState,
+    std::size_t numNeighbors,
+    std::vector<Neighbor>& neighbors) const
+{
+  if (node == noNode)
+    return;
+
+  const auto& treeNode = mNodes[node];
+  const double distance
+      = getDistance(startState, goalState, treeNode.mTrajectory);
+
+  if (neighbors.size() < numNeighbors)
+  {
+    neighbors.push_back(Neighbor{treeNode.mTrajectory, distance});
+    std::push_heap(neighbors.begin(), neighbors.end(), isFartherNeighbor);
+  }
+  else if (distance < neighbors.front().mDistance)
+  {
+    std::pop_heap(neighbors.begin(), neighbors.end(), isFartherNeighbor);
+    neighbors.back() = Neighbor{treeNode.mTrajectory, distance};
+    std::push_heap(neighbors.begin(), neighbors.end(), isFartherNeighbor);
+  }
+
+  // By the triangle inequality, a subtree can only contain a nearer
+  // trajectory if the ball around the query that contains the current
+  // neighbors intersects the shell of the subtree.
+  const auto getSearchRadius = [&]() {
+    return neighbors.size() < numNeighbors
+               ? std::numeric_limits<double>::infinity()
+               : neighbors.front().mDistance;
+  };
+
+  if (distance < treeNode.mRadius)
+  {
+    if (distance - getSearchRadius() <= treeNode.mRadius)
+      searchTree(
+          treeNode.mInside, startState, goalState, numNeighbors, neighbors);
+    if (distance + getSearchRadius() >= treeNode.mRadius)
+      searchTree(
+          treeNode.mOutside, startState, goalState, numNeighbors, neighbors);
+  }
+  else
+  {
+    if (distance + getSearchRadius() >= treeNode.mRadius)
+      searchTree(
+          treeNode.mOutside, startState, goalState, numNeighbors, neighbors);
+    if (distance - getSearchRadius() <= treeNode.mRadius)
+      searchTree(
+          treeNode.mInside, startState, goalState, numNeighbors, neighbors);
+  }
+}
+
+//==============================================================================
+double TrajectoryLibrary::getDistance(
+    const StateSpace::State* startState,
+    const StateSpace::State* goalState,
+    std::size_t index) const
+{
+  return mDistanceMetric->distance(startState, mStartStates[index])
+         + mDistanceMetric->distance(goalState, mGoalStates[index]);
+}
+
+//==============================================================================
+void saveTrajectoryLibrary(
+    const std::vector<ConstSplinePtr>& trajectories,
+    const std::string& savePath)
+{
+  if (trajectories.empty())
+    throw std::runtime_error("Trajectory library is empty");
+
+  detail::checkLittleEndian();
+
+  auto stateSpace = std::dynamic_pointer_cast<const MetaSkeletonStateSpace>(
+      trajectories.front()->getStateSpace());
+  if (!stateSpace)
+    throw std::runtime_error(
+        "Trajectory state space is not MetaSkeletonStateSpace");
+
+  const auto& dofNames = stateSpace->getProperties().getDofNames();
+  const auto numDofs = stateSpace->getDimension();
+  if (dofNames.size() != numDofs)
+    throw std::runtime_error(
+        "Number of DOFs does not match the state space dimension");
+
+  std::uint64_t numSegments = 0;
+  std::uint64_t numCoefficients = 0;
+  for (const auto& trajectory : trajectories)
+  {
+    auto trajectorySpace
+        = std::dynamic_pointer_cast<const MetaSkeletonStateSpace>(
+            trajectory->getStateSpace());
+    if (!trajectorySpace
+        || trajectorySpace->getProperties().getDofNames() != dofNames)
+    {
+      throw std::runtime_error("Dof names should be same");
+    }
+
+    if (trajectory->getNumSegments() == 0)
+      throw std::runtime_error("Trajectory is empty");
+
+    numSegments += trajectory->getNumSegments();
+    for (std::size_t i = 0; i < trajectory->getNumSegments(); ++i)
+      numCoefficients += trajectory->getSegmentCoefficients(i).size();
+  }
+
+  std::ofstream stream(savePath, std::ios::binary);
+  if (!stream)
+    throw std::runtime_error("Unable to open '" + savePath + "'");
+
+  TrajectoryLibraryHeader header;
+  std::memcpy(header.mMagic, libraryMagic, sizeof(header.mMagic));
+  header.mVersion = libraryVersion;
+  header.mNumDofs = static_cast<std::uint32_t>(numDofs);
+  header.mNumTrajectories = trajectories.size();
+  header.mNumSegments = numSegments;
+  header.mNumCoefficients = numCoefficients;
+  header.mDofNamesSize = detail::getDofNamesSize(dofNames);
+  detail::write(stream, header);
+  detail::writeDofNames(stream, dofNames);
+
+  std::uint64_t firstSegment = 0;
+  for (const auto& trajectory : trajectories)
+  {
+    detail::write(stream, firstSegment);
+    firstSegment += trajectory->getNumSegments();
+  }
+  detail::write(stream, firstSegment);
+
+  std::uint64_t firstCoefficient = 0;
+  for (const auto& trajectory : trajectories)
+  {
+    detail::write(stream, firstCoefficient);
+    for (std::size_t i = 0; i < trajectory->getNumSegments(); ++i)
+      firstCoefficient += trajectory->getSegmentCoefficients(i).size();
+  }
+  detail::write(stream, firstCoefficient);
+
+  for (const auto& trajectory : trajectories)
+    detail::write(stream, trajectory->getStartTime());
+
+  auto state = stateSpace->createState();
+  Eigen::VectorXd position(numDofs);
+  for (const auto& trajectory : trajectories)
+  {
+    trajectory->evaluate(trajectory->getStartTime(), state);
+    stateSpace->logMap(state, position);
+    stream.write(
+        reinterpret_cast<const char*>(position.data()),
+        numDofs * sizeof(double));
+  }
+
+  for (const auto& trajectory : trajectories)
+  {
+    trajectory->evaluate(trajectory->getEndTime(), state);
+    stateSpace->logMap(state, position);
+    stream.write(
+        reinterpret_cast<const char*>(position.data()),
+        numDofs * sizeof(double));
+  }
+
+  for (const auto& trajectory : trajectories)
+  {
+    for (std::size_t i = 0; i < trajectory->getNumSegments(); ++i)
+    {
+      detail::write(
+          stream,
+          static_cast<std::uint64_t>(
+              trajectory->getSegmentCoefficients(i).cols()));
+    }
+  }
+
+  for (const auto& trajectory : trajectories)
+  {
+    for (std::size_t i = 0; i < trajectory->getNumSegments(); ++i)
+      detail::write(stream, trajectory->getSegmentDuration(i));
+  }
+
+  for (const auto& trajectory : trajectories)
+  {
+    for (std::size_t i = 0; i < trajectory->getNumSegments(); ++i)
+    {
+      stateSpace->logMap(trajectory->getSegmentStartState(i), position);
+      stream.write(
+          reinterpret_cast<const char*>(position.data()),
+          numDofs * sizeof(double));
+    }
+  }
+
+  for (const auto& trajectory : trajectories)
+  {
+    for (std::size_t i = 0; i < trajectory->getNumSegments(); ++i)
+    {
+      const auto& coefficients = trajectory->getSegmentCoefficients(i);
+      stream.write(
+          reinterpret_cast<const char*>(coefficients.data()),
+          coefficients.size() * sizeof(double));
+    }
+  }
+
+  if (!stream)
+    throw std::runtime_error("Failed to write '" + savePath + "'");
+}
+
+} // namespace io
+} // namespace aikido
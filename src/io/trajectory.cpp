@@ -1,6 +1,8 @@
 #include "aikido/io/trajectory.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 
@@ -12,6 +14,8 @@
 #include "aikido/statespace/dart/MetaSkeletonStateSpace.hpp"
 #include "aikido/trajectory/Interpolated.hpp"
 
+#include "BinaryFile.hpp"
+
 using aikido::statespace::ConstStateSpacePtr;
 using aikido::statespace::StateSpacePtr;
 using aikido::statespace::dart::ConstMetaSkeletonStateSpacePtr;
@@ -22,6 +26,105 @@ using aikido::trajectory::UniqueSplinePtr;
 namespace aikido {
 namespace io {
 
+namespace {
+
+constexpr char trajectoryMagic[8] = {'A', 'I', 'K', 'I', 'D', 'O', 'T', 'J'};
+constexpr std::uint32_t trajectoryVersion = 1;
+
+/// Fixed-size header at the start of a binary trajectory file.
+struct BinaryTrajectoryHeader
+{
+  char mMagic[8];
+  std::uint32_t mVersion;
+  std::uint32_t mNumDofs;
+  std::uint64_t mNumSegments;
+  std::uint32_t mOrder;
+  std::uint32_t mReserved;
+  double mStartTime;
+  std::uint64_t mDofNamesSize;
+};
+
+static_assert(
+    sizeof(BinaryTrajectoryHeader) == 48,
+    "BinaryTrajectoryHeader must not contain padding");
+
+/// Segment of a trajectory that is about to be written.
+struct BinaryTrajectorySegment
+{
+  Eigen::MatrixXd mCoefficients;
+  double mDuration;
+  Eigen::VectorXd mStartState;
+};
+
+//==============================================================================
+void writeBinaryTrajectory(
+    const std::string& savePath,
+    double startTime,
+    const std::vector<std::string>& dofNames,
+    const std::vector<BinaryTrajectorySegment>& segments)
+{
+  detail::checkLittleEndian();
+
+  const auto numDofs = dofNames.size();
+
+  std::size_t order = 0;
+  for (const auto& segment : segments)
+  {
+    if (static_cast<std::size_t>(segment.mCoefficients.rows()) != numDofs
+        || static_cast<std::size_t>(segment.mStartState.size()) != numDofs
+        || segment.mCoefficients.cols() == 0)
+    {
+      throw std::runtime_error("Segment does not match number of DOFs");
+    }
+    order = std::max<std::size_t>(order, segment.mCoefficients.cols() - 1);
+  }
+
+  std::ofstream stream(savePath, std::ios::binary);
+  if (!stream)
+    throw std::runtime_error("Unable to open '" + savePath + "'");
+
+  BinaryTrajectoryHeader header;
+  std::memcpy(header.mMagic, trajectoryMagic, sizeof(header.mMagic));
+  header.mVersion = trajectoryVersion;
+  header.mNumDofs = static_cast<std::uint32_t>(numDofs);
+  header.mNumSegments = segments.size();
+  header.mOrder = static_cast<std::uint32_t>(order);
+  header.mReserved = 0;
+  header.mStartTime = startTime;
+  header.mDofNamesSize = detail::getDofNamesSize(dofNames);
+  detail::write(stream, header);
+  detail::writeDofNames(stream, dofNames);
+
+  for (const auto& segment : segments)
+  {
+    detail::write(
+        stream, static_cast<std::uint64_t>(segment.mCoefficients.cols()));
+  }
+
+  for (const auto& segment : segments)
+    detail::write(stream, segment.mDuration);
+
+  for (const auto& segment : segments)
+  {
+    stream.write(
+        reinterpret_cast<const char*>(segment.mStartState.data()),
+        numDofs * sizeof(double));
+  }
+
+  for (const auto& segment : segments)
+  {
+    stream.write(
+        reinterpret_cast<const char*>(segment.mCoefficients.data()),
+        segment.mCoefficients.size() * sizeof(double));
+  }
+
+  if (!stream)
+    throw std::runtime_error("Failed to write '" + savePath + "'");
+}
+
+} // namespace
+
+//==============================================================================
 void saveTrajectory(
     const aikido::trajectory::Spline& trajectory, const std::string& savePath)
 {
@@ -123,5 +226,138 @@ UniqueSplinePtr loadSplineTrajectory(
   return trajectory;
 }
 
+//==============================================================================
+void saveTrajectoryBinary(
+    const aikido::trajectory::Spline& trajectory, const std::string& savePath)
+{
+  auto skelSpace = std::dynamic_pointer_cast<const MetaSkeletonStateSpace>(
+      trajectory.getStateSpace());
+  if (!skelSpace)
+    throw std::runtime_error(
+        "Trajectory state space is not MetaSkeletonStateSpace");
+
+  const auto& dofNames = skelSpace->getProperties().getDofNames();
+  if (dofNames.size() != skelSpace->getDimension())
+    throw std::runtime_error(
+        "Number of DOFs does not match the state space dimension");
+
+  std::vector<BinaryTrajectorySegment> segments(trajectory.getNumSegments());
+  for (std::size_t i = 0; i < segments.size(); ++i)
+  {
+    segments[i].mCoefficients = trajectory.getSegmentCoefficients(i);
+    segments[i].mDuration = trajectory.getSegmentDuration(i);
+    skelSpace->logMap(
+        trajectory.getSegmentStartState(i), segments[i].mStartState);
+  }
+
+  writeBinaryTrajectory(
+      savePath, trajectory.getStartTime(), dofNames, segments);
+}
+
+//==============================================================================
+UniqueSplinePtr loadSplineTrajectoryBinary(
+    const std::string& trajPath,
+    const ConstMetaSkeletonStateSpacePtr& metaSkeletonStateSpace)
+{
+  detail::checkLittleEndian();
+
+  const detail::MappedFile file(trajPath);
+  std::size_t offset = 0;
+
+  BinaryTrajectoryHeader header;
+  std::memcpy(
+      &header,
+      detail::readArray<BinaryTrajectoryHeader>(file, offset, 1),
+      sizeof(header));
+  if (std::memcmp(header.mMagic, trajectoryMagic, sizeof(header.mMagic)) != 0)
+    throw std::runtime_error("File is not a binary trajectory");
+  if (header.mVersion != trajectoryVersion)
+    throw std::runtime_error("Unsupported binary trajectory version");
+
+  const std::size_t numDofs = header.mNumDofs;
+  const auto& paramDofs = metaSkeletonStateSpace->getProperties().getDofNames();
+  if (numDofs != paramDofs.size()
+      || numDofs != metaSkeletonStateSpace->getDimension())
+  {
+    throw std::runtime_error("Dof names should be same");
+  }
+
+  const auto dofNames
+      = detail::readArray<char>(file, offset, header.mDofNamesSize);
+  detail::checkDofNames(dofNames, header.mDofNamesSize, paramDofs);
+
+  const auto numSegments = header.mNumSegments;
+  const auto numCoefficients
+      = detail::readArray<std::uint64_t>(file, offset, numSegments);
+  const auto durations = detail::readArray<double>(file, offset, numSegments);
+  const auto startStates = detail::readArray<double>(
+      file, offset, detail::multiplyCount(numSegments, numDofs));
+
+  std::uint64_t order = 0;
+  std::uint64_t totalNumCoefficients = 0;
+  for (std::uint64_t i = 0; i < numSegments; ++i)
+  {
+    if (numCoefficients[i] == 0)
+      throw std::runtime_error("Segment has no coefficients");
+    order = std::max<std::uint64_t>(order, numCoefficients[i] - 1);
+
+    // Bound the sum by the file size so that it cannot overflow.
+    const auto segmentSize = detail::multiplyCount(numCoefficients[i], numDofs);
+    if (segmentSize > file.getSize() - totalNumCoefficients)
+      throw std::runtime_error("Binary file is truncated");
+    totalNumCoefficients += segmentSize;
+  }
+  if (order != header.mOrder)
+    throw std::runtime_error("Segment coefficients do not match the order");
+  const auto coefficients
+      = detail::readArray<double>(file, offset, totalNumCoefficients);
+
+  auto trajectory = ::aikido::common::make_unique<Spline>(
+      metaSkeletonStateSpace, header.mStartTime);
+  detail::addSegments(
+      *trajectory,
+      *metaSkeletonStateSpace,
+      numSegments,
+      numCoefficients,
+      durations,
+      startStates,
+      coefficients);
+
+  return trajectory;
+}
+
+//==============================================================================
+void convertTrajectoryToBinary(
+    const std::string& yamlPath, const std::string& binaryPath)
+{
+  YAML::Node trajFile = YAML::LoadFile(yamlPath);
+  const YAML::Node& config = trajFile["configuration"];
+
+  double startTime = config["start_time"].as<double>();
+  std::vector<std::string> dofs = config["dofs"].as<std::vector<std::string>>();
+
+  std::string trajType = config["type"].as<std::string>();
+  if (trajType.compare("spline"))
+  {
+    throw std::runtime_error("Trajectory type should be spline");
+  }
+
+  const YAML::Node& data = trajFile["data"];
+  std::vector<BinaryTrajectorySegment> segments;
+  segments.reserve(data.size());
+  for (YAML::const_iterator it = data.begin(); it != data.end(); ++it)
+  {
+    const YAML::Node& segment = *it;
+    BinaryTrajectorySegment binarySegment;
+    binarySegment.mCoefficients
+        = segment["coefficients"].as<Eigen::MatrixXd>();
+    binarySegment.mDuration = segment["duration"].as<double>();
+    binarySegment.mStartState = segment["start_state"].as<Eigen::VectorXd>();
+    segments.emplace_back(std::move(binarySegment));
+  }
+
+  writeBinaryTrajectory(binaryPath, startTime, dofs, segments);
+}
+
 } // namespace io
 } // namespace aikido
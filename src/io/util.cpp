@@ -4,6 +4,8 @@
 
 #include "aikido/io/CatkinResourceRetriever.hpp"
 
+#include "SkeletonCache.hpp"
+
 namespace aikido {
 namespace io {
 
@@ -13,9 +15,11 @@ dart::dynamics::SkeletonPtr loadSkeletonFromURDF(
     const dart::common::Uri& uri,
     const Eigen::Isometry3d& transform)
 {
-  dart::utils::DartLoader urdfLoader;
-  const dart::dynamics::SkeletonPtr skeleton
-      = urdfLoader.parseSkeleton(uri, retriever);
+  const dart::dynamics::SkeletonPtr skeleton = detail::loadCachedSkeleton(
+      "urdf", uri, retriever, [&]() {
+        dart::utils::DartLoader urdfLoader;
+        return urdfLoader.parseSkeleton(uri, retriever);
+      });
 
   if (!skeleton)
     throw std::runtime_error("Unable to load '" + uri.toString() + "'");
@@ -1,11 +1,11 @@
 #include "aikido/perception/PoseEstimatorModule.hpp"
 
 #include <Eigen/Geometry>
-#include <dart/utils/urdf/DartLoader.hpp>
 #include <ros/topic.h>
 #include <visualization_msgs/Marker.h>
 #include <visualization_msgs/MarkerArray.h>
 
+#include "aikido/io/util.hpp"
 #include "aikido/perception/shape_conversions.hpp"
 
 namespace aikido {
@@ -59,8 +59,6 @@ bool PoseEstimatorModule::detectObjects(
     return false;
   }
 
-  dart::utils::DartLoader urdfLoader;
-
   for (const auto& markerTransform : markerMessage->markers)
   {
     // TODO: Add DELETE_ALL Functionality
@@ -173,13 +171,19 @@ bool PoseEstimatorModule::detectObjects(
     if (!envSkeleton)
     {
       isNewObj = true;
-      objSkeleton = urdfLoader.parseSkeleton(objResource, mResourceRetriever);
-
-      if (!objSkeleton)
+      // The parsed URDF is cached, so that objects that reappear are not
+      // parsed again.
+      try
+      {
+        objSkeleton = aikido::io::loadSkeletonFromURDF(
+            mResourceRetriever, objResource);
+      }
+      catch (const std::runtime_error& e)
       {
         dtwarn
             << "[PoseEstimatorModule::detectObjects] Failed to load skeleton "
-            << "for URI " << objResource.toString() << std::endl;
+            << "for URI " << objResource.toString() << ": " << e.what()
+            << std::endl;
         continue;
       }
       objSkeleton->setName(objUid);
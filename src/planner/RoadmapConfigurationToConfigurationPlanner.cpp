@@ -0,0 +1,639 @@
+#include "aikido/planner/RoadmapConfigurationToConfigurationPlanner.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "aikido/common/VanDerCorput.hpp"
+#include "aikido/statespace/GeodesicInterpolator.hpp"
+#include "aikido/statespace/InterpolationContext.hpp"
+#include "aikido/trajectory/Interpolated.hpp"
+
+namespace aikido {
+namespace planner {
+
+namespace {
+
+constexpr char roadmapMagic[8] = {'A', 'I', 'K', 'I', 'D', 'O', 'R', 'M'};
+constexpr std::uint32_t roadmapVersion = 1;
+
+/// Validity of a roadmap vertex in the current query.
+enum class VertexStatus : char
+{
+  Unknown,
+  Valid,
+  Invalid
+};
+
+//==============================================================================
+std::uint64_t getEdgeKey(std::uint32_t u, std::uint32_t v)
+{
+  if (u > v)
+    std::swap(u, v);
+  return (static_cast<std::uint64_t>(u) << 32) | v;
+}
+
+//==============================================================================
+/// Unsigned integer with the same size as \c T.
+template <class T>
+using Bits = typename std::
+    conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+
+//==============================================================================
+/// Stores \c value at \c data in little-endian byte order.
+template <class T>
+void encode(const T& value, char* data)
+{
+  static_assert(
+      sizeof(T) == 4 || sizeof(T) == 8, "Only 4 and 8 byte values are stored");
+
+  Bits<T> bits;
+  std::memcpy(&bits, &value, sizeof(T));
+  for (std::size_t i = 0; i < sizeof(T); ++i)
+    data[i] = static_cast<char>((bits >> (8 * i)) & 0xff);
+}
+
+//==============================================================================
+/// Returns the value stored at \c data by \c encode.
+template <class T>
+T decode(const char* data)
+{
+  Bits<T> bits = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i)
+  {
+    const auto byte = static_cast<unsigned char>(data[i]);
+    bits |= static_cast<Bits<T>>(byte) << (8 * i);
+  }
+
+  T value;
+  std::memcpy(&value, &bits, sizeof(T));
+  return value;
+}
+
+//==============================================================================
+template <class T>
+void write(std::ostream& stream, const T& value)
+{
+  char data[sizeof(T)];
+  encode(value, data);
+  stream.write(data, sizeof(T));
+}
+
+//==============================================================================
+template <class T>
+T read(std::istream& stream)
+{
+  char data[sizeof(T)];
+  if (!stream.read(data, sizeof(T)))
+    throw std::runtime_error("Roadmap is truncated.");
+  return decode<T>(data);
+}
+
+//==============================================================================
+/// Returns the number of bytes left in \c stream, or the maximum value if
+/// \c stream cannot seek.
+std::uint64_t getRemainingSize(std::istream& stream)
+{
+  const auto position = stream.tellg();
+  if (position == std::istream::pos_type(-1))
+    return std::numeric_limits<std::uint64_t>::max();
+
+  stream.seekg(0, std::ios::end);
+  const auto end = stream.tellg();
+  stream.clear();
+  stream.seekg(position);
+
+  if (end == std::istream::pos_type(-1) || end < position)
+    return std::numeric_limits<std::uint64_t>::max();
+  return static_cast<std::uint64_t>(end - position);
+}
+
+} // namespace
+
+//==============================================================================
+RoadmapConfigurationToConfigurationPlanner::
+    RoadmapConfigurationToConfigurationPlanner(
+        statespace::ConstStateSpacePtr stateSpace,
+        distance::DistanceMetricPtr dmetric,
+        constraint::SampleablePtr sampler,
+        statespace::ConstInterpolatorPtr interpolator,
+        std::size_t numNeighbors,
+        double maxDistanceBtwValidityChecks)
+  : ConfigurationToConfigurationPlanner(std::move(stateSpace))
+  , mDistanceMetric(std::move(dmetric))
+  , mSampler(std::move(sampler))
+  , mInterpolator(std::move(interpolator))
+  , mNumNeighbors(numNeighbors)
+  , mMaxDistanceBtwValidityChecks(maxDistanceBtwValidityChecks)
+  , mNumEdges(0)
+{
+  if (!mDistanceMetric)
+    throw std::invalid_argument("DistanceMetric is nullptr.");
+
+  if (mDistanceMetric->getStateSpace() != mStateSpace)
+    throw std::invalid_argument(
+        "StateSpace of DistanceMetric not equal to planning StateSpace");
+
+  if (!mSampler)
+    throw std::invalid_argument("Sampler is nullptr.");
+
+  if (mSampler->getStateSpace() != mStateSpace)
+    throw std::invalid_argument(
+        "StateSpace of sampler not equal to planning StateSpace");
+
+  if (mMaxDistanceBtwValidityChecks <= 0.0)
+    throw std::invalid_argument(
+        "Max distance between validity checks must be positive");
+
+  if (!mInterpolator)
+  {
+    mInterpolator
+        = std::make_shared<statespace::GeodesicInterpolator>(mStateSpace);
+  }
+}
+
+//==============================================================================
+RoadmapConfigurationToConfigurationPlanner::
+    ~RoadmapConfigurationToConfigurationPlanner()
+{
+  clearRoadmap();
+}
+
+//==============================================================================
+void RoadmapConfigurationToConfigurationPlanner::buildRoadmap(
+    std::size_t numVertices)
+{
+  auto generator = mSampler->createSampleGenerator();
+  auto state = mStateSpace->createState();
+
+  mVertices.reserve(mVertices.size() + numVertices);
+  mAdjacency.reserve(mAdjacency.size() + numVertices);
+
+  for (std::size_t i = 0; i < numVertices && generator->canSample(); ++i)
+  {
+    if (generator->sample(state))
+      addVertex(state);
+  }
+}
+
+//==============================================================================
+void RoadmapConfigurationToConfigurationPlanner::clearRoadmap()
+{
+  for (auto vertex : mVertices)
+    mStateSpace->freeState(vertex);
+
+  mVertices.clear();
+  mAdjacency.clear();
+  mNumEdges = 0;
+}
+
+//==============================================================================
+std::size_t RoadmapConfigurationToConfigurationPlanner::getNumVertices() const
+{
+  return mVertices.size();
+}
+
+//==============================================================================
+std::size_t RoadmapConfigurationToConfigurationPlanner::getNumEdges() const
+{
+  return mNumEdges;
+}
+
+//==============================================================================
+void RoadmapConfigurationToConfigurationPlanner::saveRoadmap(
+    std::ostream& stream) const
+{
+  // Layout, in little-endian byte order: magic, version, dimension, number of
+  // vertices, number of edges, the tangent vector of each vertex (see
+  // StateSpace::logMap), and the vertices and length of each edge.
+  const auto dimension
+      = static_cast<std::uint32_t>(mStateSpace->getDimension());
+
+  stream.write(roadmapMagic, sizeof(roadmapMagic));
+  write(stream, roadmapVersion);
+  write(stream, dimension);
+  write(stream, static_cast<std::uint64_t>(mVertices.size()));
+  write(stream, static_cast<std::uint64_t>(mNumEdges));
+
+  Eigen::VectorXd tangent(dimension);
+  std::vector<char> data(dimension * sizeof(double));
+  for (const auto vertex : mVertices)
+  {
+    mStateSpace->logMap(vertex, tangent);
+    for (std::uint32_t i = 0; i < dimension; ++i)
+      encode(tangent[i], data.data() + i * sizeof(double));
+    stream.write(data.data(), data.size());
+  }
+
+  for (std::size_t u = 0; u < mAdjacency.size(); ++u)
+  {
+    for (const auto& edge : mAdjacency[u])
+    {
+      // Each edge is stored in the adjacency list of both of its vertices.
+      if (edge.mTarget < u)
+        continue;
+
+      write(stream, static_cast<std::uint32_t>(u));
+      write(stream, edge.mTarget);
+      write(stream, edge.mLength);
+    }
+  }
+
+  if (!stream)
+    throw std::runtime_error("Failed to write roadmap.");
+}
+
+//==============================================================================
+void RoadmapConfigurationToConfigurationPlanner::saveRoadmap(
+    const std::string& filename) const
+{
+  std::ofstream stream(filename, std::ios::binary);
+  if (!stream)
+    throw std::runtime_error("Unable to open '" + filename + "'");
+
+  saveRoadmap(stream);
+}
+
+//==============================================================================
+void RoadmapConfigurationToConfigurationPlanner::loadRoadmap(
+    std::istream& stream)
+{
+  char magic[sizeof(roadmapMagic)];
+  if (!stream.read(magic, sizeof(magic))
+      || std::memcmp(magic, roadmapMagic, sizeof(magic)) != 0)
+  {
+    throw std::runtime_error("Stream does not contain a roadmap.");
+  }
+
+  if (read<std::uint32_t>(stream) != roadmapVersion)
+    throw std::runtime_error("Unsupported roadmap version.");
+
+  const auto dimension = read<std::uint32_t>(stream);
+  if (dimension != mStateSpace->getDimension())
+    throw std::runtime_error("Roadmap does not match StateSpace dimension.");
+
+  const auto numVertices = read<std::uint64_t>(stream);
+  const auto numEdges = read<std::uint64_t>(stream);
+  if (numVertices >= std::numeric_limits<std::uint32_t>::max())
+    throw std::runtime_error("Roadmap has too many vertices.");
+
+  // The counts are only trusted once the stream is known to hold that much
+  // data. Streams that cannot seek are read without reserving memory.
+  const std::uint64_t vertexSize = std::uint64_t{dimension} * sizeof(double);
+  const std::uint64_t edgeSize = 2 * sizeof(std::uint32_t) + sizeof(double);
+  auto remainingSize = getRemainingSize(stream);
+  const bool isSizeKnown
+      = remainingSize != std::numeric_limits<std::uint64_t>::max();
+  if (vertexSize != 0 && numVertices > remainingSize / vertexSize)
+    throw std::runtime_error("Roadmap is truncated.");
+  remainingSize -= numVertices * vertexSize;
+  if (numEdges > remainingSize / edgeSize)
+    throw std::runtime_error("Roadmap is truncated.");
+
+  // Read into temporaries so that the current roadmap is kept on failure.
+  std::vector<statespace::StateSpace::State*> vertices;
+  std::vector<std::vector<Edge>> adjacency;
+  auto freeVertices = [&]() {
+    for (auto vertex : vertices)
+      mStateSpace->freeState(vertex);
+  };
+
+  try
+  {
+    Eigen::VectorXd tangent(dimension);
+    std::vector<char> data(vertexSize);
+    if (isSizeKnown)
+      vertices.reserve(numVertices);
+    for (std::uint64_t i = 0; i < numVertices; ++i)
+    {
+      if (!stream.read(data.data(), data.size()))
+        throw std::runtime_error("Roadmap is truncated.");
+      for (std::uint32_t j = 0; j < dimension; ++j)
+        tangent[j] = decode<double>(data.data() + j * sizeof(double));
+
+      vertices.emplace_back(mStateSpace->allocateState());
+      mStateSpace->expMap(tangent, vertices.back());
+    }
+
+    adjacency.resize(vertices.size());
+
+    for (std::uint64_t i = 0; i < numEdges; ++i)
+    {
+      const auto u = read<std::uint32_t>(stream);
+      const auto v = read<std::uint32_t>(stream);
+      const auto length = read<double>(stream);
+      if (u >= numVertices || v >= numVertices)
+        throw std::runtime_error("Roadmap edge refers to a missing vertex.");
+
+      adjacency[u].push_back(Edge{v, length});
+      adjacency[v].push_back(Edge{u, length});
+    }
+  }
+  catch (...)
+  {
+    freeVertices();
+    throw;
+  }
+
+  clearRoadmap();
+  mVertices = std::move(vertices);
+  mAdjacency = std::move(adjacency);
+  mNumEdges = numEdges;
+}
+
+//==============================================================================
+void RoadmapConfigurationToConfigurationPlanner::loadRoadmap(
+    const std::string& filename)
+{
+  std::ifstream stream(filename, std::ios::binary);
+  if (!stream)
+    throw std::runtime_error("Unable to open '" + filename + "'");
+
+  loadRoadmap(stream);
+}
+
+//==============================================================================
+trajectory::TrajectoryPtr RoadmapConfigurationToConfigurationPlanner::plan(
+    const SolvableProblem& problem, Result* result)
+{
+  using StateIndex = std::uint32_t;
+
+  const auto startState = problem.getStartState();
+  const auto goalState = problem.getGoalState();
+  const auto& constraint = *problem.getConstraint();
+
+  if (!constraint.isSatisfied(startState))
+  {
+    if (result)
+      result->setMessage("Start state does not satisfy the constraint.");
+    return nullptr;
+  }
+
+  if (!constraint.isSatisfied(goalState))
+  {
+    if (result)
+      result->setMessage("Goal state does not satisfy the constraint.");
+    return nullptr;
+  }
+
+  // The start and goal states are temporarily appended to the roadmap. Their
+  // edges are kept separately so that the roadmap itself is not modified.
+  const auto numVertices = static_cast<StateIndex>(mVertices.size());
+  const StateIndex startIndex = numVertices;
+  const StateIndex goalIndex = numVertices + 1;
+  const std::size_t numQueryVertices = numVertices + 2;
+
+  auto startEdges = findNearestVertices(startState, numVertices);
+  startEdges.push_back(
+      Edge{goalIndex, mDistanceMetric->distance(startState, goalState)});
+
+  std::unordered_map<StateIndex, double> goalEdges;
+  for (const auto& edge : findNearestVertices(goalState, numVertices))
+    goalEdges.emplace(edge.mTarget, edge.mLength);
+
+  auto getState = [&](StateIndex index) {
+    if (index == startIndex)
+      return startState;
+    if (index == goalIndex)
+      return goalState;
+    return static_cast<const statespace::StateSpace::State*>(mVertices[index]);
+  };
+
+  // Results of testing the constraint, reused within this query only.
+  std::vector<VertexStatus> vertexStatus(
+      numQueryVertices, VertexStatus::Unknown);
+  vertexStatus[startIndex] = VertexStatus::Valid;
+  vertexStatus[goalIndex] = VertexStatus::Valid;
+  std::unordered_set<std::uint64_t> validEdges;
+  std::unordered_set<std::uint64_t> invalidEdges;
+
+  // A* heuristic, computed on demand.
+  std::vector<double> heuristic(numQueryVertices, -1.0);
+  auto getHeuristic = [&](StateIndex index) {
+    if (heuristic[index] < 0.0)
+      heuristic[index] = mDistanceMetric->distance(getState(index), goalState);
+    return heuristic[index];
+  };
+
+  using QueueEntry = std::pair<double, StateIndex>;
+  std::vector<double> cost(numQueryVertices);
+  std::vector<StateIndex> parent(numQueryVertices);
+  std::vector<bool> closed(numQueryVertices);
+
+  while (true)
+  {
+    // Search for the shortest path that avoids known invalid vertices and
+    // edges.
+    std::fill(cost.begin(), cost.end(), std::numeric_limits<double>::max());
+    std::fill(closed.begin(), closed.end(), false);
+
+    std::priority_queue<
+        QueueEntry,
+        std::vector<QueueEntry>,
+        std::greater<QueueEntry>>
+        queue;
+    cost[startIndex] = 0.0;
+    queue.emplace(getHeuristic(startIndex), startIndex);
+
+    auto relax = [&](StateIndex from, StateIndex to, double length) {
+      if (vertexStatus[to] == VertexStatus::Invalid
+          || invalidEdges.count(getEdgeKey(from, to)))
+      {
+        return;
+      }
+
+      const double newCost = cost[from] + length;
+      if (newCost < cost[to])
+      {
+        cost[to] = newCost;
+        parent[to] = from;
+        queue.emplace(newCost + getHeuristic(to), to);
+      }
+    };
+
+    while (!queue.empty())
+    {
+      const StateIndex index = queue.top().second;
+      queue.pop();
+
+      if (closed[index])
+        continue;
+      closed[index] = true;
+
+      if (index == goalIndex)
+        break;
+
+      if (index == startIndex)
+      {
+        for (const auto& edge : startEdges)
+          relax(index, edge.mTarget, edge.mLength);
+        continue;
+      }
+
+      for (const auto& edge : mAdjacency[index])
+        relax(index, edge.mTarget, edge.mLength);
+
+      const auto goalEdge = goalEdges.find(index);
+      if (goalEdge != goalEdges.end())
+        relax(index, goalIndex, goalEdge->second);
+    }
+
+    if (!closed[goalIndex])
+    {
+      if (result)
+        result->setMessage("No path found on the roadmap.");
+      return nullptr;
+    }
+
+    std::vector<StateIndex> path{goalIndex};
+    while (path.back() != startIndex)
+      path.push_back(parent[path.back()]);
+    std::reverse(path.begin(), path.end());
+
+    // Test the vertices first, since they are cheaper than the edges.
+    bool isPathValid = true;
+    for (const auto index : path)
+    {
+      if (vertexStatus[index] != VertexStatus::Unknown)
+        continue;
+
+      if (constraint.isSatisfied(getState(index)))
+      {
+        vertexStatus[index] = VertexStatus::Valid;
+      }
+      else
+      {
+        vertexStatus[index] = VertexStatus::Invalid;
+        isPathValid = false;
+        break;
+      }
+    }
+
+    for (std::size_t i = 1; isPathValid && i < path.size(); ++i)
+    {
+      const auto key = getEdgeKey(path[i - 1], path[i]);
+      if (validEdges.count(key))
+        continue;
+
+      if (isEdgeValid(
+              getState(path[i - 1]),
+              getState(path[i]),
+              cost[path[i]] - cost[path[i - 1]],
+              constraint))
+      {
+        validEdges.insert(key);
+      }
+      else
+      {
+        invalidEdges.insert(key);
+        isPathValid = false;
+      }
+    }
+
+    if (!isPathValid)
+      continue;
+
+    auto trajectory = std::make_shared<trajectory::Interpolated>(
+        mStateSpace, mInterpolator);
+    for (std::size_t i = 0; i < path.size(); ++i)
+    {
+      // Arbitrary timing
+      trajectory->addWaypoint(i, getState(path[i]));
+    }
+    return trajectory;
+  }
+}
+
+//==============================================================================
+void RoadmapConfigurationToConfigurationPlanner::addVertex(
+    const statespace::StateSpace::State* state)
+{
+  const std::size_t index = mVertices.size();
+  if (index + 2 >= std::numeric_limits<std::uint32_t>::max())
+    throw std::overflow_error("Roadmap has too many vertices.");
+
+  auto vertex = mStateSpace->allocateState();
+  mStateSpace->copyState(state, vertex);
+
+  mVertices.emplace_back(vertex);
+  mAdjacency.emplace_back(findNearestVertices(vertex, index));
+  for (const auto& edge : mAdjacency.back())
+  {
+    mAdjacency[edge.mTarget].push_back(
+        Edge{static_cast<std::uint32_t>(index), edge.mLength});
+    ++mNumEdges;
+  }
+}
+
+//==============================================================================
+std::vector<RoadmapConfigurationToConfigurationPlanner::Edge>
+RoadmapConfigurationToConfigurationPlanner::findNearestVertices(
+    const statespace::StateSpace::State* state, std::size_t endVertex) const
+{
+  std::vector<Edge> edges;
+  edges.reserve(endVertex);
+  for (std::size_t i = 0; i < endVertex; ++i)
+  {
+    edges.push_back(
+        Edge{static_cast<std::uint32_t>(i),
+             mDistanceMetric->distance(state, mVertices[i])});
+  }
+
+  const std::size_t numNeighbors = std::min(mNumNeighbors, edges.size());
+  std::partial_sort(
+      edges.begin(),
+      edges.begin() + numNeighbors,
+      edges.end(),
+      [](const Edge& a, const Edge& b) { return a.mLength < b.mLength; });
+  edges.resize(numNeighbors);
+
+  return edges;
+}
+
+//==============================================================================
+bool RoadmapConfigurationToConfigurationPlanner::isEdgeValid(
+    const statespace::StateSpace::State* from,
+    const statespace::StateSpace::State* to,
+    double length,
+    const constraint::Testable& constraint) const
+{
+  // The endpoints have already been tested.
+  if (length <= mMaxDistanceBtwValidityChecks)
+    return true;
+
+  statespace::InterpolationContext interpolationContext(mInterpolator);
+  interpolationContext.setEndpoints(from, to);
+
+  // Sample the edge in coarse-to-fine order, so that collisions are likely to
+  // be found early.
+  std::vector<statespace::StateSpace::State*> testStates;
+  common::VanDerCorput vdc{
+      1, false, false, mMaxDistanceBtwValidityChecks / length};
+  for (const auto alpha : vdc)
+  {
+    testStates.emplace_back(mStateSpace->allocateState());
+    interpolationContext.interpolate(alpha, testStates.back());
+  }
+
+  std::vector<bool> satisfied;
+  const bool isValid = constraint.isSatisfiedBatch(
+      std::vector<const statespace::StateSpace::State*>(
+          testStates.begin(), testStates.end()),
+      satisfied);
+
+  for (auto testState : testStates)
+    mStateSpace->freeState(testState);
+
+  return isValid;
+}
+
+} // namespace planner
+} // namespace aikido
@@ -1,7 +1,10 @@
 #include "aikido/planner/SnapConfigurationToConfigurationPlanner.hpp"
 
+#include <vector>
+
 #include "aikido/common/VanDerCorput.hpp"
 #include "aikido/constraint/Testable.hpp"
+#include "aikido/statespace/InterpolationContext.hpp"
 #include "aikido/statespace/StateSpace.hpp"
 
 namespace aikido {
@@ -31,16 +34,38 @@ trajectory::TrajectoryPtr SnapConfigurationToConfigurationPlanner::plan(
 
   auto returnTraj
       = std::make_shared<trajectory::Interpolated>(mStateSpace, mInterpolator);
-  auto testState = mStateSpace->createState();
   auto startState = problem.getStartState();
   auto goalState = problem.getGoalState();
   auto constraint = problem.getConstraint();
 
+  statespace::InterpolationContext interpolationContext(mInterpolator);
+  interpolationContext.setEndpoints(startState, goalState);
+
+  // Test the edge in chunks of consecutive coarse-to-fine samples, so that
+  // the constraint can share work across each chunk while a collision near
+  // the start of the sequence is still found early.
+  constexpr std::size_t chunkSize = 8;
+  std::vector<statespace::StateSpace::ScopedState> chunkStates;
+  std::vector<const statespace::StateSpace::State*> chunk;
+  std::vector<bool> satisfied;
+  chunkStates.reserve(chunkSize);
+  chunk.reserve(chunkSize);
+  for (std::size_t i = 0; i < chunkSize; ++i)
+    chunkStates.emplace_back(mStateSpace->createState());
+
   aikido::common::VanDerCorput vdc{1, true, true, 0.02}; // TODO junk resolution
-  for (const auto alpha : vdc)
+  auto alpha = vdc.begin();
+  while (alpha != vdc.end())
   {
-    mInterpolator->interpolate(startState, goalState, alpha, testState);
-    if (!constraint->isSatisfied(testState))
+    chunk.clear();
+    for (; alpha != vdc.end() && chunk.size() < chunkSize; ++alpha)
+    {
+      auto testState = chunkStates[chunk.size()].getState();
+      interpolationContext.interpolate(*alpha, testState);
+      chunk.emplace_back(testState);
+    }
+
+    if (!constraint->isSatisfiedBatch(chunk, satisfied))
     {
       if (result)
         result->setMessage("Collision detected");
@@ -1,5 +1,7 @@
 #include "aikido/planner/World.hpp"
 
+#include <algorithm>
+
 #include "aikido/common/memory.hpp"
 
 namespace aikido {
@@ -8,7 +10,7 @@ namespace planner {
 dart::common::NameManager<World*> World::mWorldNameManager{"World", "world"};
 
 //==============================================================================
-World::World(const std::string& name)
+World::World(const std::string& name) : mVersion(0)
 {
   setName(name);
 
@@ -116,10 +118,28 @@ std::string World::addSkeleton(const dart::dynamics::SkeletonPtr& skeleton)
     return skeleton->getName();
   }
 
+  // Every BodyNode raises its transform update signal when any joint above
+  // it moves, so observing all of them catches every move of the Skeleton.
+  auto observer = common::make_unique<SkeletonObserver>();
+  observer->mIsMoved = false;
+  auto isMoved = &observer->mIsMoved;
+  observer->mConnections.reserve(skeleton->getNumBodyNodes());
+  for (std::size_t i = 0; i < skeleton->getNumBodyNodes(); ++i)
+  {
+    observer->mConnections.emplace_back(
+        skeleton->getBodyNode(i)->onTransformUpdated.connect(
+            [isMoved](const dart::dynamics::Entity*) { *isMoved = true; }));
+  }
+
   mSkeletons.push_back(skeleton);
+  {
+    std::lock_guard<std::mutex> versionLock(mVersionMutex);
+    mSkeletonObservers.emplace_back(std::move(observer));
+  }
 
   skeleton->setName(
       mSkeletonNameManager.issueNewNameAndAdd(skeleton->getName(), skeleton));
+  incrementVersion();
 
   return skeleton->getName();
 }
@@ -146,9 +166,48 @@ void World::removeSkeleton(const dart::dynamics::SkeletonPtr& skeleton)
   }
 
   // Remove skeleton from mSkeletons
+  {
+    std::lock_guard<std::mutex> versionLock(mVersionMutex);
+    mSkeletonObservers.erase(
+        mSkeletonObservers.begin() + (skelIt - mSkeletons.begin()));
+  }
   mSkeletons.erase(skelIt);
 
   mSkeletonNameManager.removeName(skeleton->getName());
+  incrementVersion();
+}
+
+//==============================================================================
+std::size_t World::getVersion(
+    const std::vector<std::string>& ignoredSkeletons) const
+{
+  std::lock_guard<std::mutex> lock(mVersionMutex);
+
+  bool changed = false;
+  for (std::size_t i = 0; i < mSkeletons.size(); ++i)
+  {
+    if (!ignoredSkeletons.empty()
+        && std::find(
+               ignoredSkeletons.begin(),
+               ignoredSkeletons.end(),
+               mSkeletons[i]->getName())
+               != ignoredSkeletons.end())
+      continue;
+
+    if (mSkeletonObservers[i]->mIsMoved.exchange(false))
+      changed = true;
+  }
+
+  if (changed)
+    return ++mVersion;
+
+  return mVersion.load();
+}
+
+//==============================================================================
+void World::incrementVersion()
+{
+  ++mVersion;
 }
 
 //==============================================================================
@@ -235,6 +294,8 @@ void World::setState(
     std::lock_guard<std::mutex> lock(skeleton->getMutex());
     skeleton->setConfiguration(it->second);
   }
+
+  incrementVersion();
 }
 
 } // namespace planner
@@ -1,5 +1,7 @@
 #include "aikido/planner/kunzretimer/KunzRetimer.hpp"
 
+#include <algorithm>
+
 #include "aikido/common/Spline.hpp"
 #include "aikido/common/StepSequence.hpp"
 #include "aikido/common/memory.hpp"
@@ -11,6 +13,7 @@
 #include "Path.h"
 #include "Trajectory.h"
 
+using aikido::common::fitCubicSegment;
 using aikido::statespace::ConstStateSpacePtr;
 using aikido::statespace::dart::MetaSkeletonStateSpace;
 using aikido::trajectory::ConstInterpolatedPtr;
@@ -56,16 +59,93 @@ std::unique_ptr<Path> convertToKunzPath(
   return path;
 }
 
+//==============================================================================
+bool isSegmentWithinError(
+    const Eigen::VectorXd& times,
+    const Eigen::MatrixXd& positions,
+    const Eigen::MatrixXd& velocities,
+    std::size_t begin,
+    std::size_t end,
+    double maxError)
+{
+  const auto coefficients = fitCubicSegment(
+      positions.col(begin),
+      velocities.col(begin),
+      positions.col(end),
+      velocities.col(end),
+      times[end] - times[begin]);
+
+  for (std::size_t i = begin + 1; i < end; ++i)
+  {
+    const double t = times[i] - times[begin];
+    const Eigen::VectorXd position
+        = ((coefficients.col(3) * t + coefficients.col(2)) * t
+           + coefficients.col(1))
+              * t
+          + coefficients.col(0);
+    const Eigen::VectorXd velocity
+        = (3. * coefficients.col(3) * t + 2. * coefficients.col(2)) * t
+          + coefficients.col(1);
+
+    if ((position - positions.col(i)).lpNorm<Eigen::Infinity>()
+            > maxError
+        || (velocity - velocities.col(i)).lpNorm<Eigen::Infinity>()
+               > maxError)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//==============================================================================
+std::size_t findSegmentEnd(
+    const Eigen::VectorXd& times,
+    const Eigen::MatrixXd& positions,
+    const Eigen::MatrixXd& velocities,
+    std::size_t begin,
+    double maxError)
+{
+  const std::size_t lastStep = times.size() - 1;
+
+  // Double the number of steps in the segment until it exceeds maxError, then
+  // bisect between the longest segment that fits and the shortest that does
+  // not.
+  std::size_t fits = begin + 1;
+  std::size_t exceeds = fits;
+  while (true)
+  {
+    exceeds = std::min(begin + 2 * (fits - begin), lastStep);
+    if (exceeds == fits)
+      return fits;
+    if (!isSegmentWithinError(
+            times, positions, velocities, begin, exceeds, maxError))
+      break;
+    fits = exceeds;
+  }
+
+  while (exceeds - fits > 1)
+  {
+    const std::size_t middle = fits + (exceeds - fits) / 2;
+    if (isSegmentWithinError(
+            times, positions, velocities, begin, middle, maxError))
+      fits = middle;
+    else
+      exceeds = middle;
+  }
+
+  return fits;
+}
+
 //==============================================================================
 std::unique_ptr<aikido::trajectory::Spline> convertToSpline(
     const Trajectory& traj,
     aikido::statespace::ConstStateSpacePtr stateSpace,
     double timeStep,
-    double startTime)
+    double startTime,
+    double maxFittingError)
 {
-  using CubicSplineProblem = aikido::common::
-      SplineProblem<double, int, 4, Eigen::Dynamic, Eigen::Dynamic>;
-
   std::size_t dimension = stateSpace->getDimension();
   double endTime = startTime + traj.getDuration();
 
@@ -77,32 +157,42 @@ std::unique_ptr<aikido::trajectory::Spline> convertToSpline(
   // create a sequence of time steps from start time to end time by time step
   aikido::common::StepSequence sequence(
       timeStep, true, true, startTime, endTime);
+  const std::size_t numSteps = sequence.getLength();
+
+  // Sample the time-optimal trajectory once at every time step.
+  Eigen::VectorXd times(numSteps);
+  Eigen::MatrixXd positions(dimension, numSteps);
+  Eigen::MatrixXd velocities(dimension, numSteps);
+  for (std::size_t i = 0; i < numSteps; ++i)
+  {
+    times[i] = sequence[i];
+    positions.col(i) = traj.getPosition(times[i] - startTime);
+    velocities.col(i) = traj.getVelocity(times[i] - startTime);
+  }
 
-  const Eigen::VectorXd zeroPosition = Eigen::VectorXd::Zero(dimension);
   auto currState = stateSpace->createState();
-  for (std::size_t i = 0; i < sequence.getLength() - 1; i++)
+  std::size_t begin = 0;
+  while (begin + 1 < numSteps)
   {
-    double currT = sequence[i];
-    double nextT = sequence[i + 1];
-    double segmentDuration = nextT - currT;
-    double currTShift = currT - startTime;
-    double nextTShift = nextT - startTime;
-    Eigen::VectorXd currentPosition = traj.getPosition(currTShift);
-    Eigen::VectorXd nextPosition = traj.getPosition(nextTShift);
-    Eigen::VectorXd currentVelocity = traj.getVelocity(currTShift);
-    Eigen::VectorXd nextVelocity = traj.getVelocity(nextTShift);
-
-    CubicSplineProblem problem(
-        Eigen::Vector2d{0., segmentDuration}, 4, dimension);
-    problem.addConstantConstraint(0, 0, zeroPosition);
-    problem.addConstantConstraint(0, 1, currentVelocity);
-    problem.addConstantConstraint(1, 0, nextPosition - currentPosition);
-    problem.addConstantConstraint(1, 1, nextVelocity);
-    const auto solution = problem.fit();
-    const auto coefficients = solution.getCoefficients().front();
-
-    stateSpace->expMap(currentPosition, currState);
+    std::size_t end = begin + 1;
+    if (maxFittingError > 0.)
+    {
+      end = findSegmentEnd(
+          times, positions, velocities, begin, maxFittingError);
+    }
+
+    const double segmentDuration = times[end] - times[begin];
+    const Eigen::MatrixXd coefficients = fitCubicSegment(
+        Eigen::VectorXd::Zero(dimension),
+        velocities.col(begin),
+        positions.col(end) - positions.col(begin),
+        velocities.col(end),
+        segmentDuration);
+
+    stateSpace->expMap(positions.col(begin), currState);
     outputTrajectory->addSegment(coefficients, segmentDuration, currState);
+
+    begin = end;
   }
 
   return outputTrajectory;
@@ -116,7 +206,8 @@ std::unique_ptr<aikido::trajectory::Spline> computeKunzTiming(
     const Eigen::VectorXd& maxVelocity,
     const Eigen::VectorXd& maxAcceleration,
     double maxDeviation,
-    double timeStep)
+    double timeStep,
+    double maxFittingError)
 {
   const auto stateSpace = inputTrajectory.getStateSpace();
   const auto dimension = stateSpace->getDimension();
@@ -143,7 +234,8 @@ std::unique_ptr<aikido::trajectory::Spline> computeKunzTiming(
   double startTime = inputTrajectory.getStartTime();
   auto path = detail::convertToKunzPath(inputTrajectory, maxDeviation);
   Trajectory trajectory(*path, maxVelocity, maxAcceleration, timeStep);
-  return detail::convertToSpline(trajectory, stateSpace, timeStep, startTime);
+  return detail::convertToSpline(
+      trajectory, stateSpace, timeStep, startTime, maxFittingError);
 }
 
 //==============================================================================
@@ -151,11 +243,13 @@ KunzRetimer::KunzRetimer(
     const Eigen::VectorXd& velocityLimits,
     const Eigen::VectorXd& accelerationLimits,
     double maxDeviation,
-    double timeStep)
+    double timeStep,
+    double maxFittingError)
   : mVelocityLimits{velocityLimits}
   , mAccelerationLimits{accelerationLimits}
   , mMaxDeviation(maxDeviation)
   , mTimeStep(timeStep)
+  , mMaxFittingError(maxFittingError)
 {
   // Do nothing
 }
@@ -171,7 +265,8 @@ std::unique_ptr<aikido::trajectory::Spline> KunzRetimer::postprocess(
       mVelocityLimits,
       mAccelerationLimits,
       mMaxDeviation,
-      mTimeStep);
+      mTimeStep,
+      mMaxFittingError);
 }
 
 //==============================================================================
@@ -233,6 +328,18 @@ void KunzRetimer::setMaxDeviation(double maxDeviation)
   mMaxDeviation = maxDeviation;
 }
 
+//==============================================================================
+double KunzRetimer::getMaxFittingError() const
+{
+  return mMaxFittingError;
+}
+
+//==============================================================================
+void KunzRetimer::setMaxFittingError(double maxFittingError)
+{
+  mMaxFittingError = maxFittingError;
+}
+
 } // namespace kunzretimer
 } // namespace planner
 } // namespace aikido
@@ -1,15 +1,86 @@
 #include "aikido/planner/ompl/CRRT.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <limits>
 
+#include <ompl/base/goals/GoalRegion.h>
 #include <ompl/base/goals/GoalSampleableRegion.h>
 #include <ompl/tools/config/SelfConfig.h>
 
+#include "aikido/common/ThreadPool.hpp"
+#include "aikido/constraint/TestableIntersection.hpp"
 #include "aikido/planner/ompl/GeometricStateSpace.hpp"
+#include "aikido/planner/ompl/GoalRegion.hpp"
+#include "aikido/planner/ompl/MotionValidator.hpp"
+#include "aikido/planner/ompl/StateSampler.hpp"
+#include "aikido/planner/ompl/StateValidityChecker.hpp"
 
 namespace aikido {
 namespace planner {
 namespace ompl {
+
+namespace {
+
+/// Goal whose states are those that satisfy a Testable. The distance of an
+/// unsatisfied state to the goal is delegated to the goal of the
+/// ProblemDefinition, if it is an ::ompl::base::GoalRegion that computes one,
+/// and is infinite otherwise.
+class TestableGoal : public ::ompl::base::Goal
+{
+public:
+  TestableGoal(
+      const ::ompl::base::SpaceInformationPtr& si,
+      constraint::TestablePtr testable)
+    : ::ompl::base::Goal(si), mTestable(std::move(testable))
+  {
+    // Do nothing
+  }
+
+  /// Sets the goal that computes the distance of unsatisfied states.
+  void setDistanceGoal(const ::ompl::base::Goal* goal)
+  {
+    // GoalRegion only reports zero or infinite distances, and evaluates a
+    // Testable that is shared across workers.
+    if (dynamic_cast<const GoalRegion*>(goal))
+      mDistanceGoal = nullptr;
+    else
+      mDistanceGoal = dynamic_cast<const ::ompl::base::GoalRegion*>(goal);
+  }
+
+  bool isSatisfied(const ::ompl::base::State* st) const override
+  {
+    auto state = static_cast<const GeometricStateSpace::StateType*>(st);
+    if (state == nullptr || state->mState == nullptr)
+      return false;
+
+    return mTestable->isSatisfied(state->mState);
+  }
+
+  bool isSatisfied(
+      const ::ompl::base::State* st, double* distance) const override
+  {
+    const bool satisfied = isSatisfied(st);
+    if (distance)
+    {
+      if (satisfied)
+        *distance = 0.0;
+      else if (mDistanceGoal)
+        *distance = mDistanceGoal->distanceGoal(st);
+      else
+        *distance = std::numeric_limits<double>::infinity();
+    }
+    return satisfied;
+  }
+
+private:
+  constraint::TestablePtr mTestable;
+  const ::ompl::base::GoalRegion* mDistanceGoal = nullptr;
+};
+
+} // namespace
+
 //==============================================================================
 CRRT::CRRT(const ::ompl::base::SpaceInformationPtr& _si) : CRRT(_si, "CRRT")
 {
@@ -91,6 +162,7 @@ void CRRT::clear()
 {
   ::ompl::base::Planner::clear();
   mSampler.reset();
+  mWorkers.clear();
   freeMemory();
   if (mStartTree)
     mStartTree->clear();
@@ -164,6 +236,41 @@ double CRRT::getMinStateDifference() const
   return mMinStepsize;
 }
 
+//==============================================================================
+void CRRT::setWorkerConstraints(std::vector<WorkerConstraints> _workers)
+{
+  const auto stateSpace
+      = ompl_static_pointer_cast<GeometricStateSpace>(si_->getStateSpace())
+            ->getAikidoStateSpace();
+
+  for (const auto& worker : _workers)
+  {
+    if (!worker.validityConstraint || !worker.pathConstraint
+        || !worker.goalTestable || !worker.sampler)
+    {
+      throw std::invalid_argument("Worker constraint is nullptr.");
+    }
+
+    if (worker.validityConstraint->getStateSpace() != stateSpace
+        || worker.pathConstraint->getStateSpace() != stateSpace
+        || worker.goalTestable->getStateSpace() != stateSpace
+        || worker.sampler->getStateSpace() != stateSpace)
+    {
+      throw std::invalid_argument(
+          "Worker constraint does not match planning StateSpace.");
+    }
+  }
+
+  mWorkerConstraints = std::move(_workers);
+  mWorkers.clear();
+}
+
+//==============================================================================
+std::size_t CRRT::getNumWorkers() const
+{
+  return std::max<std::size_t>(mWorkerConstraints.size(), 1);
+}
+
 //==============================================================================
 void CRRT::setup()
 {
@@ -179,6 +286,8 @@ void CRRT::setup()
       this,
       OMPL_PLACEHOLDER(_1),
       OMPL_PLACEHOLDER(_2)));
+
+  mWorkers.clear();
 }
 
 //==============================================================================
@@ -199,6 +308,137 @@ void CRRT::freeMemory()
   }
 }
 
+//==============================================================================
+std::vector<CRRT::Worker>& CRRT::getWorkers()
+{
+  if (mWorkerConstraints.empty())
+  {
+    // Rebuilt on every call, since the path constraint and the goal may
+    // change between calls to solve().
+    if (!mSampler)
+      mSampler = si_->allocStateSampler();
+
+    mWorkers.clear();
+    mWorkers.emplace_back(
+        Worker{si_, mSampler, mCons, pdef_->getGoal(), &mRng});
+    return mWorkers;
+  }
+
+  if (!mWorkers.empty())
+  {
+    // The goal of the ProblemDefinition may change between calls to solve().
+    for (auto& worker : mWorkers)
+    {
+      static_cast<TestableGoal&>(*worker.goal)
+          .setDistanceGoal(pdef_->getGoal().get());
+    }
+    return mWorkers;
+  }
+
+  auto sspace
+      = ompl_static_pointer_cast<GeometricStateSpace>(si_->getStateSpace());
+
+  mWorkerRngs.clear();
+  mWorkers.reserve(mWorkerConstraints.size());
+  for (const auto& constraints : mWorkerConstraints)
+  {
+    // Each worker checks states and motions with its own SpaceInformation,
+    // which shares the StateSpace of this planner.
+    auto si = ompl_make_shared<::ompl::base::SpaceInformation>(sspace);
+
+    std::vector<constraint::ConstTestablePtr> validityConstraints{
+        constraints.validityConstraint, sspace->getBoundsConstraint()};
+    si->setStateValidityChecker(ompl_make_shared<StateValidityChecker>(
+        si,
+        std::make_shared<constraint::TestableIntersection>(
+            sspace->getAikidoStateSpace(), std::move(validityConstraints))));
+    si->setMotionValidator(ompl_make_shared<MotionValidator>(
+        si, sspace->getMaxDistanceBetweenValidityChecks()));
+
+    mWorkerRngs.emplace_back(new ::ompl::RNG);
+    mWorkers.emplace_back(Worker{
+        si,
+        ompl_make_shared<StateSampler>(
+            sspace.get(), constraints.sampler->createSampleGenerator()),
+        constraints.pathConstraint,
+        ompl_make_shared<TestableGoal>(si, constraints.goalTestable),
+        mWorkerRngs.back().get()});
+    static_cast<TestableGoal&>(*mWorkers.back().goal)
+        .setDistanceGoal(pdef_->getGoal().get());
+  }
+
+  return mWorkers;
+}
+
+//==============================================================================
+void CRRT::runWorkers(const std::function<void(Worker&)>& _extend)
+{
+  auto& workers = getWorkers();
+  if (workers.size() == 1)
+  {
+    _extend(workers.front());
+    return;
+  }
+
+  if (!mThreadPool || mThreadPool->getNumThreads() != workers.size() - 1)
+    mThreadPool.reset(new common::ThreadPool(workers.size() - 1));
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(workers.size() - 1);
+  for (std::size_t i = 1; i < workers.size(); ++i)
+  {
+    Worker& worker = workers[i];
+    futures.emplace_back(
+        mThreadPool->submit([&_extend, &worker]() { _extend(worker); }));
+  }
+
+  std::exception_ptr error;
+  try
+  {
+    _extend(workers.front());
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+
+  // Wait for every worker before rethrowing any exception, since the workers
+  // reference the caller's local variables.
+  for (auto& future : futures)
+    future.wait();
+  if (error)
+    std::rethrow_exception(error);
+  for (auto& future : futures)
+    future.get();
+}
+
+//==============================================================================
+std::mutex& CRRT::getTreeMutex(const TreeData& /*_tree*/)
+{
+  return mStartTreeMutex;
+}
+
+//==============================================================================
+void CRRT::addMotion(TreeData& _tree, Motion* _motion)
+{
+  std::lock_guard<std::mutex> lock(getTreeMutex(_tree));
+  _tree->add(_motion);
+}
+
+//==============================================================================
+std::size_t CRRT::getTreeSize(TreeData& _tree)
+{
+  std::lock_guard<std::mutex> lock(getTreeMutex(_tree));
+  return _tree->size();
+}
+
+//==============================================================================
+CRRT::Motion* CRRT::nearestMotion(TreeData& _tree, Motion* _motion)
+{
+  std::lock_guard<std::mutex> lock(getTreeMutex(_tree));
+  return _tree->nearest(_motion);
+}
+
 //==============================================================================
 ::ompl::base::PlannerStatus CRRT::solve(
     const ::ompl::base::PlannerTerminationCondition& _ptc)
@@ -220,58 +460,82 @@ void CRRT::freeMemory()
     return ::ompl::base::PlannerStatus::INVALID_START;
   }
 
-  if (!mSampler)
-    mSampler = si_->allocStateSampler();
-
   Motion* solution = nullptr;
   Motion* approxsol = nullptr;
   double approxdif = std::numeric_limits<double>::infinity();
-  auto rmotion = std::unique_ptr<Motion>(new Motion(si_));
-  ::ompl::base::State* rstate = rmotion->state;
-  ::ompl::base::State* xstate = si_->allocState(); /* temp state */
+  std::mutex solutionMutex;
+
+  // Stop every worker as soon as one of them reaches the goal.
+  std::atomic<bool> foundgoal{false};
+  const ::ompl::base::PlannerTerminationCondition ptc
+      = ::ompl::base::plannerOrTerminationCondition(
+          _ptc,
+          ::ompl::base::PlannerTerminationCondition(
+              [&foundgoal]() { return foundgoal.load(); }));
+
+  runWorkers([&](Worker& worker) {
+    auto rmotion = std::unique_ptr<Motion>(new Motion(worker.si));
+    ::ompl::base::State* rstate = rmotion->state;
+    ::ompl::base::State* xstate = worker.si->allocState(); /* temp state */
+
+    while (ptc == false)
+    {
+      /* sample random state (with goal biasing) */
+      bool sampledGoal = false;
+      if (goalSampleable && worker.rng->uniform01() < mGoalBias)
+      {
+        std::lock_guard<std::mutex> lock(mGoalMutex);
+        if (goalSampleable->canSample())
+        {
+          goalSampleable->sampleGoal(rstate);
+          sampledGoal = true;
+        }
+      }
+      if (!sampledGoal)
+        worker.sampler->sampleUniform(rstate);
 
-  bool foundgoal = false;
-  while (_ptc == false)
-  {
-    /* sample random state (with goal biasing) */
-    if (goalSampleable && mRng.uniform01() < mGoalBias
-        && goalSampleable->canSample())
-      goalSampleable->sampleGoal(rstate);
-    else
-      mSampler->sampleUniform(rstate);
+      // Continue on invalid sample
+      if (!worker.si->isValid(rstate))
+      {
+        continue;
+      }
 
-    // Continue on invalid sample
-    if (!si_->isValid(rstate))
-    {
-      continue;
+      /* find closest state in the tree */
+      Motion* nmotion = nearestMotion(mStartTree, rmotion.get());
+
+      /* Perform a constrained extension */
+      double bestdist = std::numeric_limits<double>::infinity();
+      bool reachedgoal = false;
+      Motion* bestmotion = constrainedExtend(
+          ptc,
+          worker,
+          mStartTree,
+          nmotion,
+          rmotion->state,
+          xstate,
+          false,
+          bestdist,
+          reachedgoal);
+
+      std::lock_guard<std::mutex> lock(solutionMutex);
+      if (reachedgoal)
+      {
+        if (!solution)
+          solution = bestmotion;
+        foundgoal = true;
+        break;
+      }
+      else if (bestdist < approxdif)
+      {
+        approxdif = bestdist;
+        approxsol = bestmotion;
+      }
     }
 
-    /* find closest state in the tree */
-    Motion* nmotion = mStartTree->nearest(rmotion.get());
-
-    /* Perform a constrained extension */
-    double bestdist = std::numeric_limits<double>::infinity();
-    Motion* bestmotion = constrainedExtend(
-        _ptc,
-        mStartTree,
-        nmotion,
-        rmotion->state,
-        xstate,
-        goal,
-        false,
-        bestdist,
-        foundgoal);
-    if (foundgoal)
-    {
-      solution = bestmotion;
-      break;
-    }
-    else if (bestdist < approxdif)
-    {
-      approxdif = bestdist;
-      approxsol = bestmotion;
-    }
-  }
+    worker.si->freeState(xstate);
+    if (rmotion->state)
+      worker.si->freeState(rmotion->state);
+  });
 
   bool solved = false;
   bool approximate = false;
@@ -301,21 +565,17 @@ void CRRT::freeMemory()
     solved = true;
   }
 
-  si_->freeState(xstate);
-  if (rmotion->state)
-    si_->freeState(rmotion->state);
-
   return ::ompl::base::PlannerStatus(solved, approximate);
 }
 
 //==============================================================================
 CRRT::Motion* CRRT::constrainedExtend(
     const ::ompl::base::PlannerTerminationCondition& ptc,
+    const Worker& worker,
     TreeData& tree,
     Motion* nmotion,
     ::ompl::base::State* gstate,
     ::ompl::base::State* xstate,
-    ::ompl::base::Goal* goal,
     bool returnlast,
     double& dist,
     bool& foundgoal)
@@ -328,7 +588,7 @@ CRRT::Motion* CRRT::constrainedExtend(
 
   // Compute the current and previous distance to the goal state
   double prevDistToTarget = std::numeric_limits<double>::infinity();
-  double distToTarget = si_->distance(cmotion->state, gstate);
+  double distToTarget = worker.si->distance(cmotion->state, gstate);
 
   // Loop while time remaining
   foundgoal = false;
@@ -344,31 +604,31 @@ CRRT::Motion* CRRT::constrainedExtend(
     // Take a step towards the goal state
     double stepLength
         = std::min(mMaxDistance, std::min(mMaxStepsize, distToTarget));
-    si_->getStateSpace()->interpolate(
+    worker.si->getStateSpace()->interpolate(
         cmotion->state, gstate, stepLength / distToTarget, xstate);
 
-    if (mCons)
+    if (worker.pathConstraint)
     {
       // Project the endpoint of the step
       auto xst = xstate->as<GeometricStateSpace::StateType>();
-      if (!mCons->project(xst->mState))
+      if (!worker.pathConstraint->project(xst->mState))
       {
         // Can't project back to constraint anymore, return
         break;
       }
     }
 
-    if (si_->checkMotion(cmotion->state, xstate))
+    if (worker.si->checkMotion(cmotion->state, xstate))
     {
       // Add the motion to the tree
-      Motion* motion = new Motion(si_);
-      si_->copyState(motion->state, xstate);
+      Motion* motion = new Motion(worker.si);
+      worker.si->copyState(motion->state, xstate);
       motion->parent = cmotion;
-      tree->add(motion);
+      addMotion(tree, motion);
 
       cmotion = motion;
       double newdist = 0.0;
-      bool satisfied = goal->isSatisfied(motion->state, &newdist);
+      bool satisfied = worker.goal->isSatisfied(motion->state, &newdist);
       if (satisfied)
       {
         dist = newdist;
@@ -393,7 +653,7 @@ CRRT::Motion* CRRT::constrainedExtend(
       break;
     }
     prevDistToTarget = distToTarget;
-    distToTarget = si_->distance(cmotion->state, gstate);
+    distToTarget = worker.si->distance(cmotion->state, gstate);
   }
 
   return bestmotion;
@@ -1,5 +1,8 @@
 #include "aikido/planner/ompl/CRRTConnect.hpp"
 
+#include <atomic>
+#include <limits>
+
 #include <ompl/base/goals/GoalSampleableRegion.h>
 #include <ompl/tools/config/SelfConfig.h>
 
@@ -12,7 +15,10 @@ namespace ompl {
 
 //==============================================================================
 CRRTConnect::CRRTConnect(const ::ompl::base::SpaceInformationPtr& _si)
-  : CRRT(_si, "CRRTConnect"), mConnectionRadius(1e-4)
+  : CRRT(_si, "CRRTConnect")
+  , mNumSampledGoals(0)
+  , mNumPendingGoals(0)
+  , mConnectionRadius(1e-4)
 {
 
   specs_.recognizedGoal = ::ompl::base::GOAL_SAMPLEABLE_REGION;
@@ -74,12 +80,59 @@ void CRRTConnect::freeMemory()
   }
 }
 
+//==============================================================================
+std::mutex& CRRTConnect::getTreeMutex(const TreeData& _tree)
+{
+  if (&_tree == &mGoalTree)
+    return mGoalTreeMutex;
+
+  return CRRT::getTreeMutex(_tree);
+}
+
+//==============================================================================
+bool CRRTConnect::sampleGoal(
+    const ::ompl::base::GoalSampleableRegion* _goal,
+    ::ompl::base::State* _state)
+{
+  std::lock_guard<std::mutex> lock(mGoalMutex);
+  if (!_goal->canSample() || mNumSampledGoals >= _goal->maxSampleCount())
+    return false;
+
+  _goal->sampleGoal(_state);
+  ++mNumSampledGoals;
+  ++mNumPendingGoals;
+  return true;
+}
+
+//==============================================================================
+void CRRTConnect::finishGoalSample()
+{
+  {
+    std::lock_guard<std::mutex> lock(mGoalMutex);
+    --mNumPendingGoals;
+  }
+  mGoalSampleFinished.notify_all();
+}
+
+//==============================================================================
+bool CRRTConnect::waitForGoalSamples()
+{
+  {
+    std::unique_lock<std::mutex> lock(mGoalMutex);
+    mGoalSampleFinished.wait(lock, [this]() { return mNumPendingGoals == 0; });
+  }
+
+  return getTreeSize(mGoalTree) > 0;
+}
+
 //==============================================================================
 void CRRTConnect::clear()
 {
   CRRT::clear();
   if (mGoalTree)
     mGoalTree->clear();
+  mNumSampledGoals = 0;
+  mNumPendingGoals = 0;
   mConnectionPoint = std::make_pair<::ompl::base::State*, ::ompl::base::State*>(
       nullptr, nullptr);
 }
@@ -128,143 +181,190 @@ double CRRTConnect::getConnectionRadius() const
     return ::ompl::base::PlannerStatus::INVALID_GOAL;
   }
 
-  if (!mSampler)
-    mSampler = si_->allocStateSampler();
+  bool solved = false;
+  std::mutex solutionMutex;
 
-  // Extra state used during tree extensions
-  ::ompl::base::State* xstate = si_->allocState();
+  // Stop every worker as soon as one of them connects the trees.
+  std::atomic<bool> connected{false};
+  const ::ompl::base::PlannerTerminationCondition ptc
+      = ::ompl::base::plannerOrTerminationCondition(
+          _ptc,
+          ::ompl::base::PlannerTerminationCondition(
+              [&connected]() { return connected.load(); }));
 
-  auto rmotion = std::unique_ptr<Motion>(new Motion(si_));
-  ::ompl::base::State* rstate = rmotion->state;
+  runWorkers([&](Worker& worker) {
+    // Extra state used during tree extensions
+    ::ompl::base::State* xstate = worker.si->allocState();
 
-  bool startTree = true;
-  bool solved = false;
-  bool foundgoal = false;
+    auto rmotion = std::unique_ptr<Motion>(new Motion(worker.si));
+    ::ompl::base::State* rstate = rmotion->state;
 
-  while (_ptc == false)
-  {
-    TreeData& tree = startTree ? mStartTree : mGoalTree;
-    TreeData& otherTree = startTree ? mGoalTree : mStartTree;
-    startTree = !startTree;
+    bool startTree = true;
+    bool foundgoal = false;
 
-    if (mGoalTree->size() == 0
-        || pis_.getSampledGoalsCount() < mGoalTree->size() / 2)
+    while (ptc == false)
     {
-      while (_ptc == false)
+      TreeData& tree = startTree ? mStartTree : mGoalTree;
+      TreeData& otherTree = startTree ? mGoalTree : mStartTree;
+      startTree = !startTree;
+
+      const std::size_t goalTreeSize = getTreeSize(mGoalTree);
+      if (goalTreeSize == 0 || mNumSampledGoals < goalTreeSize / 2)
       {
-        const ::ompl::base::State* st = pis_.nextGoal(_ptc);
-        if (si_->isValid(st))
+        // Only sampling the goal is serialized; each worker checks its own
+        // samples, so goal validity checks run concurrently.
+        bool isGoalTreeEmpty = false;
+        while (ptc == false)
         {
-          Motion* motion = new Motion(si_);
-          si_->copyState(motion->state, st);
-          mGoalTree->add(motion);
+          if (!sampleGoal(goal, rstate))
+          {
+            // No goal samples remain, so the goal tree only grows if another
+            // worker is still checking one.
+            isGoalTreeEmpty = !waitForGoalSamples();
+            break;
+          }
+
+          bool valid = false;
+          try
+          {
+            valid = worker.si->isValid(rstate);
+            if (valid)
+            {
+              Motion* motion = new Motion(si_);
+              si_->copyState(motion->state, rstate);
+              addMotion(mGoalTree, motion);
+            }
+          }
+          catch (...)
+          {
+            finishGoalSample();
+            throw;
+          }
+          finishGoalSample();
+
+          // Wait for a valid goal only while no worker has found one.
+          if (valid || getTreeSize(mGoalTree) > 0)
+            break;
         }
-        if (mGoalTree->size() > 0)
+
+        // The trees can never be connected.
+        if (isGoalTreeEmpty)
           break;
       }
-    }
 
-    // Sample a random state
-    mSampler->sampleUniform(rstate);
-    if (!si_->isValid(rstate))
-      continue;
-
-    // Find closest state in tree
-    Motion* nmotion = tree->nearest(rmotion.get());
-
-    // Grow one tree toward the random sample
-    double bestdist = std::numeric_limits<double>::infinity();
-    Motion* lastmotion = constrainedExtend(
-        _ptc,
-        tree,
-        nmotion,
-        rmotion->state,
-        xstate,
-        goal,
-        true,
-        bestdist,
-        foundgoal);
-
-    if (lastmotion == nmotion)
-    {
-      // trapped
-      continue;
-    }
-
-    // Now grow the other tree
-    nmotion = otherTree->nearest(lastmotion);
-    Motion* newmotion = constrainedExtend(
-        _ptc,
-        otherTree,
-        nmotion,
-        lastmotion->state,
-        xstate,
-        goal,
-        true,
-        bestdist,
-        foundgoal);
-
-    Motion* startMotion = startTree ? newmotion : lastmotion;
-    Motion* goalMotion = startTree ? lastmotion : newmotion;
-
-    double treedist = si_->distance(newmotion->state, lastmotion->state);
-    if (treedist <= mConnectionRadius)
-    {
-      if (treedist < 1e-6)
+      // Sample a random state
+      worker.sampler->sampleUniform(rstate);
+      if (!worker.si->isValid(rstate))
+        continue;
+
+      // Find closest state in tree
+      Motion* nmotion = nearestMotion(tree, rmotion.get());
+
+      // Grow one tree toward the random sample
+      double bestdist = std::numeric_limits<double>::infinity();
+      Motion* lastmotion = constrainedExtend(
+          ptc,
+          worker,
+          tree,
+          nmotion,
+          rmotion->state,
+          xstate,
+          true,
+          bestdist,
+          foundgoal);
+
+      if (lastmotion == nmotion)
       {
-        // The start and goal trees hit the same point, remove one of them
-        // to avoid having a duplicate state on the path
-        if (startMotion->parent)
-          startMotion = startMotion->parent;
-        else
-          goalMotion = goalMotion->parent;
+        // trapped
+        continue;
       }
 
-      mConnectionPoint = std::make_pair(startMotion->state, goalMotion->state);
-
-      /* construct the solution path */
-      Motion* solution = startMotion;
-      std::vector<Motion*> mpath1;
-      while (solution != nullptr)
+      // Now grow the other tree
+      nmotion = nearestMotion(otherTree, lastmotion);
+      Motion* newmotion = constrainedExtend(
+          ptc,
+          worker,
+          otherTree,
+          nmotion,
+          lastmotion->state,
+          xstate,
+          true,
+          bestdist,
+          foundgoal);
+
+      Motion* startMotion = startTree ? newmotion : lastmotion;
+      Motion* goalMotion = startTree ? lastmotion : newmotion;
+
+      double treedist
+          = worker.si->distance(newmotion->state, lastmotion->state);
+      if (treedist <= mConnectionRadius)
       {
-        mpath1.push_back(solution);
-        solution = solution->parent;
-      }
+        if (treedist < 1e-6)
+        {
+          // The start and goal trees hit the same point, remove one of them
+          // to avoid having a duplicate state on the path
+          if (startMotion->parent)
+            startMotion = startMotion->parent;
+          else
+            goalMotion = goalMotion->parent;
+        }
 
-      solution = goalMotion;
-      std::vector<Motion*> mpath2;
-      while (solution != nullptr)
-      {
-        mpath2.push_back(solution);
-        solution = solution->parent;
-      }
+        /* construct the solution path */
+        Motion* solution = startMotion;
+        std::vector<Motion*> mpath1;
+        while (solution != nullptr)
+        {
+          mpath1.push_back(solution);
+          solution = solution->parent;
+        }
 
-      // Double check that the start and goal pair are valid
-      if (mpath1.size() > 0 && mpath2.size() > 0)
-      {
-        if (!goal->isStartGoalPairValid(
-                mpath1.front()->state, mpath2.back()->state))
-          continue;
-      }
+        solution = goalMotion;
+        std::vector<Motion*> mpath2;
+        while (solution != nullptr)
+        {
+          mpath2.push_back(solution);
+          solution = solution->parent;
+        }
 
-      auto path = ompl_make_shared<::ompl::geometric::PathGeometric>(si_);
-      path->getStates().reserve(mpath1.size() + mpath2.size());
-      for (int i = mpath1.size() - 1; i >= 0; --i)
-        path->append(mpath1[i]->state);
-      for (std::size_t i = 0; i < mpath2.size(); ++i)
-        path->append(mpath2[i]->state);
+        // Double check that the start and goal pair are valid
+        if (mpath1.size() > 0 && mpath2.size() > 0)
+        {
+          std::lock_guard<std::mutex> lock(mGoalMutex);
+          if (!goal->isStartGoalPairValid(
+                  mpath1.front()->state, mpath2.back()->state))
+            continue;
+        }
 
-      pdef_->addSolutionPath(path, false, 0.0);
-      solved = true;
-      break;
+        std::lock_guard<std::mutex> lock(solutionMutex);
+        if (solved)
+          break;
+
+        mConnectionPoint
+            = std::make_pair(startMotion->state, goalMotion->state);
+
+        auto path = ompl_make_shared<::ompl::geometric::PathGeometric>(si_);
+        path->getStates().reserve(mpath1.size() + mpath2.size());
+        for (int i = mpath1.size() - 1; i >= 0; --i)
+          path->append(mpath1[i]->state);
+        for (std::size_t i = 0; i < mpath2.size(); ++i)
+          path->append(mpath2[i]->state);
+
+        pdef_->addSolutionPath(path, false, 0.0);
+        solved = true;
+        connected = true;
+        break;
+      }
     }
-  }
 
-  si_->freeState(xstate);
-  si_->freeState(rstate);
+    worker.si->freeState(xstate);
+    worker.si->freeState(rstate);
+  });
 
-  return solved ? ::ompl::base::PlannerStatus::EXACT_SOLUTION
-                : ::ompl::base::PlannerStatus::TIMEOUT;
+  if (solved)
+    return ::ompl::base::PlannerStatus::EXACT_SOLUTION;
+  if (mGoalTree->size() == 0)
+    return ::ompl::base::PlannerStatus::INVALID_GOAL;
+  return ::ompl::base::PlannerStatus::TIMEOUT;
 }
 
 //==============================================================================
@@ -1,5 +1,7 @@
 #include "aikido/planner/ompl/GeometricStateSpace.hpp"
 
+#include <new>
+
 #include "aikido/common/memory.hpp"
 #include "aikido/constraint/Sampleable.hpp"
 #include "aikido/planner/ompl/BackwardCompatibility.hpp"
@@ -31,6 +33,7 @@ GeometricStateSpace::GeometricStateSpace(
   , mBoundsConstraint(std::move(boundsConstraint))
   , mBoundsProjection(std::move(boundsProjection))
   , mMaxDistanceBetweenValidityChecks(maxDistanceBetweenValidityChecks)
+  , mStateTypePool(sizeof(StateType))
 {
   if (mStateSpace == nullptr)
   {
@@ -224,7 +227,7 @@ void GeometricStateSpace::interpolate(
 ::ompl::base::State* GeometricStateSpace::allocState() const
 {
   auto ast = mStateSpace->allocateState();
-  return new StateType(ast);
+  return new (mStateTypePool.allocate()) StateType(ast);
 }
 
 //==============================================================================
@@ -233,7 +236,7 @@ void GeometricStateSpace::interpolate(
 {
   auto newState = mStateSpace->allocateState();
   mStateSpace->copyState(state, newState);
-  return new StateType(newState);
+  return new (mStateTypePool.allocate()) StateType(newState);
 }
 
 //==============================================================================
@@ -246,7 +249,8 @@ void GeometricStateSpace::freeState(::ompl::base::State* state) const
     {
       mStateSpace->freeState(sstate->mState);
     }
-    delete sstate;
+    sstate->~StateType();
+    mStateTypePool.deallocate(sstate);
   }
 }
 
@@ -1,13 +1,269 @@
 #include "aikido/planner/ompl/MotionValidator.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <ompl/base/SpaceInformation.h>
 
 #include "aikido/common/StepSequence.hpp"
 #include "aikido/common/VanDerCorput.hpp"
+#include "aikido/common/memory.hpp"
+#include "aikido/planner/ompl/GeometricStateSpace.hpp"
+#include "aikido/planner/ompl/StateValidityChecker.hpp"
+#include "aikido/statespace/InterpolationContext.hpp"
 
 namespace aikido {
 namespace planner {
 namespace ompl {
+
+namespace {
+
+//==============================================================================
+/// Interpolates along an edge. When the edge lies in a GeometricStateSpace,
+/// the geodesic is computed once per edge and reused for every sample;
+/// otherwise, this defers to StateSpace::interpolate().
+class EdgeInterpolator
+{
+public:
+  explicit EdgeInterpolator(const ::ompl::base::StateSpace* stateSpace)
+    : mStateSpace(stateSpace), mS1(nullptr), mS2(nullptr), mUseContext(false)
+  {
+    auto geometricStateSpace
+        = dynamic_cast<const GeometricStateSpace*>(mStateSpace);
+    if (geometricStateSpace)
+      mContext = common::make_unique<statespace::InterpolationContext>(
+          geometricStateSpace->getInterpolator());
+  }
+
+  void setEndpoints(
+      const ::ompl::base::State* s1, const ::ompl::base::State* s2)
+  {
+    mS1 = s1;
+    mS2 = s2;
+
+    auto from = static_cast<const GeometricStateSpace::StateType*>(mS1);
+    auto to = static_cast<const GeometricStateSpace::StateType*>(mS2);
+
+    // Let GeometricStateSpace::interpolate() report malformed states.
+    mUseContext = mContext && from && from->mState && from->mValid && to
+                  && to->mState && to->mValid;
+    if (mUseContext)
+      mContext->setEndpoints(from->mState, to->mState);
+  }
+
+  void interpolate(double t, ::ompl::base::State* out)
+  {
+    auto sout = static_cast<GeometricStateSpace::StateType*>(out);
+    if (mUseContext && sout && sout->mState)
+      mContext->interpolate(t, sout->mState);
+    else
+      mStateSpace->interpolate(mS1, mS2, t, out);
+  }
+
+private:
+  const ::ompl::base::StateSpace* mStateSpace;
+  const ::ompl::base::State* mS1;
+  const ::ompl::base::State* mS2;
+  std::unique_ptr<statespace::InterpolationContext> mContext;
+  bool mUseContext;
+};
+
+//==============================================================================
+double getSample(const common::VanDerCorput& sequence, std::size_t index)
+{
+  return sequence[index].first;
+}
+
+//==============================================================================
+double getSample(const common::StepSequence& sequence, std::size_t index)
+{
+  return sequence[index];
+}
+
+//==============================================================================
+/// Scratch states that consecutive samples of a sequence along an edge are
+/// interpolated into, so that they can be tested with one batched call.
+class SampleChunk
+{
+public:
+  /// Maximum number of samples in a chunk. This bounds the interpolation
+  /// wasted past an invalid sample while letting the constraint share work
+  /// across the chunk.
+  static constexpr std::size_t MAX_SIZE = 8;
+
+  explicit SampleChunk(::ompl::base::StateSpacePtr stateSpace)
+    : mStateSpace(std::move(stateSpace))
+  {
+    mStates.reserve(MAX_SIZE);
+    mSamples.reserve(MAX_SIZE);
+    mConstraintStates.reserve(MAX_SIZE);
+    for (std::size_t i = 0; i < MAX_SIZE; ++i)
+      mStates.emplace_back(mStateSpace->allocState());
+  }
+
+  SampleChunk(const SampleChunk&) = delete;
+  SampleChunk& operator=(const SampleChunk&) = delete;
+
+  ~SampleChunk()
+  {
+    for (auto state : mStates)
+      mStateSpace->freeState(state);
+  }
+
+  /// Interpolates samples \c begin to \c end (exclusive) of \c sequence,
+  /// with \c end - \c begin no more than \c MAX_SIZE.
+  template <class Sequence>
+  void interpolate(
+      EdgeInterpolator& interpolator,
+      const Sequence& sequence,
+      std::size_t begin,
+      std::size_t end)
+  {
+    mSamples.clear();
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      auto state = mStates[i - begin];
+      interpolator.interpolate(getSample(sequence, i), state);
+      mSamples.emplace_back(state);
+    }
+  }
+
+  /// Returns the number of leading samples in this chunk that are valid
+  /// according to the StateValidityChecker of \c si. An aikido
+  /// StateValidityChecker tests the whole chunk with one batched call.
+  std::size_t countLeadingValid(const ::ompl::base::SpaceInformation& si)
+  {
+    auto checker = dynamic_cast<const StateValidityChecker*>(
+        si.getStateValidityChecker().get());
+    if (checker)
+    {
+      checker->areValid(mSamples, mValid);
+      return countLeadingTrue();
+    }
+
+    std::size_t numValid = 0;
+    for (auto state : mSamples)
+    {
+      if (!si.isValid(state))
+        break;
+      ++numValid;
+    }
+    return numValid;
+  }
+
+  /// Returns the number of leading samples in this chunk that are
+  /// well-formed GeometricStateSpace states and satisfy \c constraint,
+  /// testing them with one batched call.
+  std::size_t countLeadingSatisfied(const constraint::Testable& constraint)
+  {
+    mConstraintStates.clear();
+    for (auto state : mSamples)
+    {
+      auto st = static_cast<const GeometricStateSpace::StateType*>(state);
+      if (st == nullptr || st->mState == nullptr || !st->mValid)
+        break;
+      mConstraintStates.emplace_back(st->mState);
+    }
+
+    using BatchMode = constraint::Testable::BatchMode;
+    constraint.isSatisfiedBatch(
+        mConstraintStates, mValid, BatchMode::FirstFailure);
+    return countLeadingTrue();
+  }
+
+private:
+  std::size_t countLeadingTrue() const
+  {
+    return static_cast<std::size_t>(
+        std::find(mValid.begin(), mValid.end(), false) - mValid.begin());
+  }
+
+  ::ompl::base::StateSpacePtr mStateSpace;
+  std::vector<::ompl::base::State*> mStates;
+  std::vector<const ::ompl::base::State*> mSamples;
+  std::vector<const statespace::StateSpace::State*> mConstraintStates;
+  std::vector<bool> mValid;
+};
+
+// Required for odr-use.
+constexpr std::size_t SampleChunk::MAX_SIZE;
+
+//==============================================================================
+/// Checks the samples in \c sequence in chunks of consecutive samples and
+/// returns the number of leading samples that are valid.
+template <class Sequence>
+std::size_t countLeadingValidSamples(
+    const ::ompl::base::SpaceInformation& si,
+    EdgeInterpolator& interpolator,
+    const Sequence& sequence)
+{
+  SampleChunk chunk(si.getStateSpace());
+
+  const std::size_t numSamples = sequence.getLength();
+  for (std::size_t begin = 0; begin < numSamples;
+       begin += SampleChunk::MAX_SIZE)
+  {
+    const std::size_t end = std::min(begin + SampleChunk::MAX_SIZE, numSamples);
+    chunk.interpolate(interpolator, sequence, begin, end);
+
+    const std::size_t numValid = chunk.countLeadingValid(si);
+    if (numValid < end - begin)
+      return begin + numValid;
+  }
+
+  return numSamples;
+}
+
+//==============================================================================
+/// State shared by a parallel segment check and the helper tasks it submits,
+/// which may only start running after the check has returned.
+struct HelperControl
+{
+  std::mutex mMutex;
+
+  /// Signaled when a running helper finishes.
+  std::condition_variable mHelperFinished;
+
+  /// Set once the check stops accepting helpers.
+  bool mIsClosed = false;
+
+  /// Number of helpers that have started and not yet finished.
+  std::size_t mNumRunning = 0;
+
+  /// First exception thrown by a helper.
+  std::exception_ptr mError;
+};
+
+} // namespace
+
+//==============================================================================
+struct MotionValidator::Worker
+{
+  Worker(
+      ::ompl::base::StateSpacePtr stateSpace,
+      constraint::ConstTestablePtr constraint)
+    : mStateSpace(std::move(stateSpace))
+    , mConstraint(std::move(constraint))
+    , mInterpolator(mStateSpace.get())
+    , mChunk(mStateSpace)
+  {
+    // Do nothing
+  }
+
+  ::ompl::base::StateSpacePtr mStateSpace;
+  constraint::ConstTestablePtr mConstraint;
+  EdgeInterpolator mInterpolator;
+
+  /// Scratch states that samples are interpolated into.
+  SampleChunk mChunk;
+};
+
+//==============================================================================
 MotionValidator::MotionValidator(
     const ::ompl::base::SpaceInformationPtr& _si,
     double _maxDistBtwValidityChecks)
@@ -26,6 +282,47 @@ MotionValidator::MotionValidator(
   }
 }
 
+//==============================================================================
+MotionValidator::MotionValidator(
+    const ::ompl::base::SpaceInformationPtr& _si,
+    double _maxDistBtwValidityChecks,
+    std::vector<constraint::ConstTestablePtr> _workerConstraints,
+    std::shared_ptr<common::ThreadPool> _threadPool)
+  : MotionValidator(_si, _maxDistBtwValidityChecks)
+{
+  for (const auto& constraint : _workerConstraints)
+  {
+    if (!constraint)
+      throw std::invalid_argument("Worker constraint is nullptr.");
+  }
+
+  mWorkers.reserve(_workerConstraints.size());
+  mIdleWorkers.reserve(_workerConstraints.size());
+  for (auto& constraint : _workerConstraints)
+  {
+    mWorkers.emplace_back(common::make_unique<Worker>(
+        _si->getStateSpace(), std::move(constraint)));
+    mIdleWorkers.emplace_back(mWorkers.back().get());
+  }
+
+  if (mWorkers.size() > 1)
+  {
+    mThreadPool = _threadPool ? std::move(_threadPool)
+                              : std::make_shared<common::ThreadPool>(
+                                    mWorkers.size() - 1);
+  }
+}
+
+//==============================================================================
+MotionValidator::~MotionValidator() = default;
+
+//==============================================================================
+std::size_t MotionValidator::getNumWorkers() const
+{
+  return mWorkers.size();
+}
+
+//==============================================================================
 bool MotionValidator::checkMotion(
     const ::ompl::base::State* _s1, const ::ompl::base::State* _s2) const
 {
@@ -35,23 +332,18 @@ bool MotionValidator::checkMotion(
                                    true, // include endpoints
                                    mSequenceResolution / dist};
 
-  auto stateSpace = si_->getStateSpace();
-  auto iState = stateSpace->allocState();
+  // Check the edge in coarse-to-fine order, stopping at the first invalid
+  // sample.
+  if (!mWorkers.empty())
+    return countLeadingValidSamplesInParallel(_s1, _s2, vdc, true)
+           == vdc.getLength();
 
-  bool valid = true;
-  for (double t : vdc)
-  {
-    stateSpace->interpolate(_s1, _s2, t, iState);
-    if (!si_->isValid(iState))
-    {
-      valid = false;
-      break;
-    }
-  }
-  stateSpace->freeState(iState);
-  return valid;
+  EdgeInterpolator interpolator(si_->getStateSpace().get());
+  interpolator.setEndpoints(_s1, _s2);
+  return countLeadingValidSamples(*si_, interpolator, vdc) == vdc.getLength();
 }
 
+//==============================================================================
 bool MotionValidator::checkMotion(
     const ::ompl::base::State* _s1,
     const ::ompl::base::State* _s2,
@@ -64,32 +356,167 @@ bool MotionValidator::checkMotion(
   aikido::common::StepSequence seq(
       mSequenceResolution / dist, true, true); // include endpoints
 
-  auto stateSpace = si_->getStateSpace();
-  auto iState = stateSpace->allocState();
+  EdgeInterpolator interpolator(si_->getStateSpace().get());
+  interpolator.setEndpoints(_s1, _s2);
 
-  bool valid = true;
-  double lastValidTime = 0.0;
-  for (double t : seq)
-  {
-    stateSpace->interpolate(_s1, _s2, t, iState);
-    if (!si_->isValid(iState))
-    {
-      valid = false;
-      break;
-    }
-    lastValidTime = t;
-  }
-  stateSpace->freeState(iState);
+  const std::size_t numValid
+      = mWorkers.empty()
+            ? countLeadingValidSamples(*si_, interpolator, seq)
+            : countLeadingValidSamplesInParallel(_s1, _s2, seq, false);
+
+  const bool valid = numValid == seq.getLength();
+  const double lastValidTime = numValid > 0 ? seq[numValid - 1] : 0.0;
 
   // Copy the last valid time and value into the return value
   _lastValid.second = lastValidTime;
   if (_lastValid.first)
   {
-    stateSpace->interpolate(_s1, _s2, _lastValid.second, _lastValid.first);
+    interpolator.interpolate(_lastValid.second, _lastValid.first);
   }
 
   return valid;
 }
+
+//==============================================================================
+template <class Sequence>
+std::size_t MotionValidator::countLeadingValidSamplesInParallel(
+    const ::ompl::base::State* _s1,
+    const ::ompl::base::State* _s2,
+    const Sequence& _sequence,
+    bool _stopAtAnyFailure) const
+{
+  const std::size_t numSamples = _sequence.getLength();
+
+  // Index of the next sample to check and of the first invalid sample found
+  // so far.
+  std::atomic<std::size_t> nextSample(0);
+  std::atomic<std::size_t> firstFailure(numSamples);
+
+  auto check = [&](Worker& worker) {
+    worker.mInterpolator.setEndpoints(_s1, _s2);
+
+    // Chunks of consecutive samples are taken in order, so every sample
+    // before the first failure is checked by some worker.
+    for (;;)
+    {
+      const std::size_t begin = nextSample.fetch_add(SampleChunk::MAX_SIZE);
+      if (begin >= numSamples)
+        return;
+
+      const std::size_t failure = firstFailure.load();
+      if (_stopAtAnyFailure ? failure != numSamples : failure < begin)
+        return;
+
+      const std::size_t end
+          = std::min(begin + SampleChunk::MAX_SIZE, numSamples);
+      worker.mChunk.interpolate(worker.mInterpolator, _sequence, begin, end);
+
+      const std::size_t numValid
+          = worker.mChunk.countLeadingSatisfied(*worker.mConstraint);
+      if (numValid == end - begin)
+        continue;
+
+      const std::size_t i = begin + numValid;
+      std::size_t expected = firstFailure.load();
+      while (i < expected && !firstFailure.compare_exchange_weak(expected, i))
+      {
+        // Retry until firstFailure holds the smaller index.
+      }
+      return;
+    }
+  };
+
+  // Helpers only join if a worker is idle, so that concurrent calls share the
+  // workers rather than waiting for each other. This call never waits for a
+  // helper that has not started: the pool may be busy, or this may be running
+  // on one of its threads, so such helpers are cancelled instead.
+  auto control = std::make_shared<HelperControl>();
+  for (std::size_t i = 1; i < mWorkers.size(); ++i)
+  {
+    mThreadPool->submit([this, control, &check]() {
+      {
+        std::lock_guard<std::mutex> lock(control->mMutex);
+        if (control->mIsClosed)
+          return;
+        ++control->mNumRunning;
+      }
+
+      std::exception_ptr error;
+      if (Worker* worker = acquireWorker(false))
+      {
+        try
+        {
+          check(*worker);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+        releaseWorker(worker);
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(control->mMutex);
+        if (error && !control->mError)
+          control->mError = error;
+        --control->mNumRunning;
+      }
+      control->mHelperFinished.notify_all();
+    });
+  }
+
+  std::exception_ptr error;
+  Worker* worker = acquireWorker(true);
+  try
+  {
+    check(*worker);
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+  releaseWorker(worker);
+
+  // Wait only for the helpers that have started, since they reference this
+  // stack frame.
+  {
+    std::unique_lock<std::mutex> lock(control->mMutex);
+    control->mIsClosed = true;
+    control->mHelperFinished.wait(
+        lock, [&control]() { return control->mNumRunning == 0; });
+    if (!error)
+      error = control->mError;
+  }
+  if (error)
+    std::rethrow_exception(error);
+
+  return firstFailure.load();
+}
+
+//==============================================================================
+MotionValidator::Worker* MotionValidator::acquireWorker(bool _wait) const
+{
+  std::unique_lock<std::mutex> lock(mWorkerMutex);
+  if (_wait)
+    mWorkerReleased.wait(lock, [this]() { return !mIdleWorkers.empty(); });
+  else if (mIdleWorkers.empty())
+    return nullptr;
+
+  Worker* worker = mIdleWorkers.back();
+  mIdleWorkers.pop_back();
+  return worker;
+}
+
+//==============================================================================
+void MotionValidator::releaseWorker(Worker* _worker) const
+{
+  {
+    std::lock_guard<std::mutex> lock(mWorkerMutex);
+    mIdleWorkers.emplace_back(_worker);
+  }
+  mWorkerReleased.notify_one();
+}
+
 } // namespace ompl
 } // namespace planner
 } // namespace aikido
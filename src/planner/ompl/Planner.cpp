@@ -22,7 +22,8 @@ namespace ompl {
     constraint::TestablePtr _validityConstraint,
     constraint::TestablePtr _boundsConstraint,
     constraint::ProjectablePtr _boundsProjector,
-    double _maxDistanceBtwValidityChecks)
+    double _maxDistanceBtwValidityChecks,
+    std::vector<constraint::TestablePtr> _workerValidityConstraints)
 {
   if (_stateSpace == nullptr)
   {
@@ -100,6 +101,21 @@ namespace ompl {
         "StateSpace of BoundsProjector not equal to planning StateSpace");
   }
 
+  for (const auto& workerValidityConstraint : _workerValidityConstraints)
+  {
+    if (workerValidityConstraint == nullptr)
+    {
+      throw std::invalid_argument("Worker ValidityConstraint is nullptr.");
+    }
+
+    if (_stateSpace != workerValidityConstraint->getStateSpace())
+    {
+      throw std::invalid_argument(
+          "StateSpace of worker ValidityConstraint not equal to planning "
+          "StateSpace");
+    }
+  }
+
   // Ensure max distance between validity checks is positive
   if (_maxDistanceBtwValidityChecks <= 0.0)
   {
@@ -122,16 +138,34 @@ namespace ompl {
 
   // Validity checking
   std::vector<constraint::ConstTestablePtr> constraints{
-      std::move(_validityConstraint), std::move(_boundsConstraint)};
+      std::move(_validityConstraint), _boundsConstraint};
   auto conjunctionConstraint
       = std::make_shared<constraint::TestableIntersection>(
-          std::move(_stateSpace), std::move(constraints));
+          _stateSpace, std::move(constraints));
   ::ompl::base::StateValidityCheckerPtr vchecker
       = ompl_make_shared<StateValidityChecker>(si, conjunctionConstraint);
   si->setStateValidityChecker(vchecker);
 
+  // The bounds constraint is shared by the workers, which only read it.
+  std::vector<constraint::ConstTestablePtr> workerConstraints;
+  workerConstraints.reserve(_workerValidityConstraints.size());
+  for (auto& workerValidityConstraint : _workerValidityConstraints)
+  {
+    std::vector<constraint::ConstTestablePtr> workerConstraint{
+        std::move(workerValidityConstraint), _boundsConstraint};
+    workerConstraints.emplace_back(
+        std::make_shared<constraint::TestableIntersection>(
+            _stateSpace, std::move(workerConstraint)));
+  }
+
   ::ompl::base::MotionValidatorPtr mvalidator
-      = ompl_make_shared<MotionValidator>(si, _maxDistanceBtwValidityChecks);
+      = workerConstraints.empty()
+            ? ompl_make_shared<MotionValidator>(
+                  si, _maxDistanceBtwValidityChecks)
+            : ompl_make_shared<MotionValidator>(
+                  si,
+                  _maxDistanceBtwValidityChecks,
+                  std::move(workerConstraints));
   si->setMotionValidator(mvalidator);
 
   return si;
@@ -170,10 +204,26 @@ trajectory::InterpolatedPtr planOMPL(
     statespace::ConstStateSpacePtr _sspace,
     statespace::InterpolatorPtr _interpolator,
     double _maxPlanTime)
+{
+  return planOMPL(
+      _planner,
+      _pdef,
+      std::move(_sspace),
+      std::move(_interpolator),
+      ::ompl::base::timedPlannerTerminationCondition(_maxPlanTime));
+}
+
+//==============================================================================
+trajectory::InterpolatedPtr planOMPL(
+    const ::ompl::base::PlannerPtr& _planner,
+    const ::ompl::base::ProblemDefinitionPtr& _pdef,
+    statespace::ConstStateSpacePtr _sspace,
+    statespace::InterpolatorPtr _interpolator,
+    const ::ompl::base::PlannerTerminationCondition& _ptc)
 {
   _planner->setProblemDefinition(_pdef);
   _planner->setup();
-  auto solved = _planner->solve(_maxPlanTime);
+  auto solved = _planner->solve(_ptc);
 
   if (solved)
   {
@@ -190,6 +240,7 @@ trajectory::InterpolatedPtr planOMPL(
           "Trajectory");
     }
 
+    returnTraj->reserveWaypoints(path->getStateCount());
     for (std::size_t idx = 0; idx < path->getStateCount(); ++idx)
     {
       const auto* st
@@ -219,7 +270,8 @@ trajectory::InterpolatedPtr planCRRT(
     double _maxPlanTime,
     double _maxExtensionDistance,
     double _maxDistanceBtwProjections,
-    double _minStepsize)
+    double _minStepsize,
+    std::vector<CRRT::WorkerConstraints> _workerConstraints)
 {
   if (_trajConstraint == nullptr)
   {
@@ -279,6 +331,7 @@ trajectory::InterpolatedPtr planCRRT(
   planner->setRange(_maxExtensionDistance);
   planner->setProjectionResolution(_maxDistanceBtwProjections);
   planner->setMinStateDifference(_minStepsize);
+  planner->setWorkerConstraints(std::move(_workerConstraints));
   return planOMPL(
       planner,
       pdef,
@@ -304,7 +357,8 @@ trajectory::InterpolatedPtr planCRRTConnect(
     double _maxExtensionDistance,
     double _maxDistanceBtwProjections,
     double _minStepsize,
-    double _minTreeConnectionDistance)
+    double _minTreeConnectionDistance,
+    std::vector<CRRT::WorkerConstraints> _workerConstraints)
 {
   if (_trajConstraint == nullptr)
   {
@@ -370,6 +424,7 @@ trajectory::InterpolatedPtr planCRRTConnect(
   planner->setProjectionResolution(_maxDistanceBtwProjections);
   planner->setConnectionRadius(_minTreeConnectionDistance);
   planner->setMinStateDifference(_minStepsize);
+  planner->setWorkerConstraints(std::move(_workerConstraints));
   return planOMPL(
       planner,
       pdef,
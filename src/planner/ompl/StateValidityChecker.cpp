@@ -36,6 +36,49 @@ bool StateValidityChecker::isValid(const ::ompl::base::State* _state) const
   return mConstraint->isSatisfied(st->mState);
 }
 
+//==============================================================================
+bool StateValidityChecker::areValid(
+    const std::vector<const ::ompl::base::State*>& _states,
+    std::vector<bool>& _valid,
+    constraint::Testable::BatchMode _mode) const
+{
+  using BatchMode = constraint::Testable::BatchMode;
+
+  _valid.assign(_states.size(), false);
+
+  // Gather the states that can be passed to the constraint, remembering their
+  // position in the input.
+  std::vector<const statespace::StateSpace::State*> batch;
+  std::vector<std::size_t> indices;
+  batch.reserve(_states.size());
+  indices.reserve(_states.size());
+
+  bool allWellFormed = true;
+  for (std::size_t i = 0; i < _states.size(); ++i)
+  {
+    auto st = static_cast<const GeometricStateSpace::StateType*>(_states[i]);
+    if (st == nullptr || st->mState == nullptr || !st->mValid)
+    {
+      allWellFormed = false;
+      if (_mode == BatchMode::FirstFailure)
+        break;
+      continue;
+    }
+
+    batch.emplace_back(st->mState);
+    indices.emplace_back(i);
+  }
+
+  std::vector<bool> satisfied;
+  const bool allSatisfied
+      = mConstraint->isSatisfiedBatch(batch, satisfied, _mode);
+
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    _valid[indices[i]] = satisfied[i];
+
+  return allWellFormed && allSatisfied;
+}
+
 } // namespace ompl
 } // namespace planner
 } // namespace aikido
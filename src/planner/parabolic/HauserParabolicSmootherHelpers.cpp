@@ -4,6 +4,7 @@
 #include <cmath>
 
 #include "aikido/common/VanDerCorput.hpp"
+#include "aikido/statespace/InterpolationContext.hpp"
 
 #include "Config.h"
 #include "HauserMath.h"
@@ -25,7 +26,12 @@ public:
     : mTestable(std::move(testable))
     , mCheckResolution(checkResolution)
     , mStateSpace(mTestable->getStateSpace())
-    , mInterpolator(mStateSpace)
+    , mInterpolationContext(
+          std::make_shared<aikido::statespace::GeodesicInterpolator>(
+              mStateSpace))
+    , mStartState(mStateSpace->createState())
+    , mGoalState(mStateSpace->createState())
+    , mTestState(mStateSpace->createState())
   {
     // Do nothing
   }
@@ -33,9 +39,8 @@ public:
   bool ConfigFeasible(const ParabolicRamp::Vector& x) override
   {
     Eigen::VectorXd eigX = toEigen(x);
-    auto state = mStateSpace->createState();
-    mStateSpace->expMap(eigX, state);
-    return mTestable->isSatisfied(state);
+    mStateSpace->expMap(eigX, mTestState);
+    return mTestable->isSatisfied(mTestState);
   }
 
   bool SegmentFeasible(
@@ -44,11 +49,9 @@ public:
     Eigen::VectorXd eigA = toEigen(a);
     Eigen::VectorXd eigB = toEigen(b);
 
-    auto testState = mStateSpace->createState();
-    auto startState = mStateSpace->createState();
-    auto goalState = mStateSpace->createState();
-    mStateSpace->expMap(eigA, startState);
-    mStateSpace->expMap(eigB, goalState);
+    mStateSpace->expMap(eigA, mStartState);
+    mStateSpace->expMap(eigB, mGoalState);
+    mInterpolationContext.setEndpoints(mStartState, mGoalState);
 
     // both ends of the segment have already been checked by calling
     // ConfigFeasible(),
@@ -57,8 +60,8 @@ public:
 
     for (const auto alpha : vdc)
     {
-      mInterpolator.interpolate(startState, goalState, alpha, testState);
-      if (!mTestable->isSatisfied(testState))
+      mInterpolationContext.interpolate(alpha, mTestState);
+      if (!mTestable->isSatisfied(mTestState))
       {
         return false;
       }
@@ -70,7 +73,12 @@ private:
   aikido::constraint::TestablePtr mTestable;
   double mCheckResolution;
   aikido::statespace::ConstStateSpacePtr mStateSpace;
-  aikido::statespace::GeodesicInterpolator mInterpolator;
+  aikido::statespace::InterpolationContext mInterpolationContext;
+
+  // Scratch states reused across feasibility checks.
+  aikido::statespace::StateSpace::ScopedState mStartState;
+  aikido::statespace::StateSpace::ScopedState mGoalState;
+  aikido::statespace::StateSpace::ScopedState mTestState;
 };
 
 bool needsBlend(const ParabolicRamp::ParabolicRampND& rampNd)
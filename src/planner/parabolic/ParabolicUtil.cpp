@@ -15,15 +15,12 @@
 
 #include "DynamicPath.h"
 
+using aikido::common::fitCubicSegment;
 using aikido::statespace::StateSpace;
 using aikido::statespace::dart::MetaSkeletonStateSpace;
 using aikido::trajectory::ConstInterpolatedPtr;
 using aikido::trajectory::ConstSplinePtr;
 using aikido::trajectory::toR1JointTrajectory;
-using Eigen::Vector2d;
-
-using CubicSplineProblem
-    = aikido::common::SplineProblem<double, int, 4, Eigen::Dynamic, 2>;
 
 namespace aikido {
 namespace planner {
@@ -112,18 +109,16 @@ std::unique_ptr<aikido::trajectory::Spline> convertToSpline(
     Eigen::VectorXd positionCurr, velocityCurr;
     evaluateAtTime(_inputPath, timeCurr, positionCurr, velocityCurr);
 
-    CubicSplineProblem problem(Vector2d(0, timeCurr - timePrev), 4, dimension);
-    problem.addConstantConstraint(0, 0, Eigen::VectorXd::Zero(dimension));
-    problem.addConstantConstraint(0, 1, velocityPrev);
-    problem.addConstantConstraint(1, 0, positionCurr - positionPrev);
-    problem.addConstantConstraint(1, 1, velocityCurr);
-    const auto spline = problem.fit();
+    const Eigen::MatrixXd coefficients = fitCubicSegment(
+        Eigen::VectorXd::Zero(dimension),
+        velocityPrev,
+        positionCurr - positionPrev,
+        velocityCurr,
+        timeCurr - timePrev);
 
     _stateSpace->expMap(positionPrev, segmentStartState);
 
     // Add the ramp to the output trajectory.
-    assert(spline.getCoefficients().size() == 1);
-    const auto& coefficients = spline.getCoefficients().front();
     _outputTrajectory->addSegment(
         coefficients, timeCurr - timePrev, segmentStartState);
 
@@ -0,0 +1,671 @@
+#include "aikido/planner/toppra/ToppraRetimer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "aikido/common/Spline.hpp"
+#include "aikido/common/memory.hpp"
+#include "aikido/statespace/dart/MetaSkeletonStateSaver.hpp"
+#include "aikido/statespace/dart/MetaSkeletonStateSpace.hpp"
+#include "aikido/trajectory/util.hpp"
+
+#include "Path.h"
+
+using aikido::common::fitCubicSegment;
+using aikido::statespace::dart::MetaSkeletonStateSaver;
+using aikido::statespace::dart::MetaSkeletonStateSpace;
+using aikido::trajectory::ConstInterpolatedPtr;
+using aikido::trajectory::toR1JointTrajectory;
+
+namespace aikido {
+namespace planner {
+namespace toppra {
+
+namespace {
+
+/// Tolerance that absorbs round-off in the reachability analysis.
+constexpr double feasibilityTolerance = 1e-9;
+
+/// Path sampled at the grid points. Column i of each matrix holds the
+/// position, or its first or second derivative with respect to the path
+/// parameter, at the path parameter mGrid[i].
+struct GridPath
+{
+  std::vector<double> mGrid;
+  Eigen::MatrixXd mPositions;
+  Eigen::MatrixXd mTangents;
+  Eigen::MatrixXd mCurvatures;
+};
+
+/// Linear constraints mLower <= mA * u + mB * x <= mUpper on the path
+/// acceleration u and the squared path velocity x at a grid point, in addition
+/// to 0 <= x <= mMaxX.
+struct GridConstraints
+{
+  Eigen::VectorXd mA;
+  Eigen::VectorXd mB;
+  Eigen::VectorXd mLower;
+  Eigen::VectorXd mUpper;
+  double mMaxX;
+};
+
+/// Constraints at a grid point in the form u >= m + n * x (mLower), u <= m + n
+/// * x (mUpper) and mMinX <= x <= mMaxX, where each line is stored as (m, n).
+struct AccelerationBounds
+{
+  std::vector<std::pair<double, double>> mLower;
+  std::vector<std::pair<double, double>> mUpper;
+  double mMinX;
+  double mMaxX;
+};
+
+//==============================================================================
+void checkLimits(
+    std::size_t dimension,
+    const Eigen::VectorXd& maxVelocity,
+    const Eigen::VectorXd& maxAcceleration,
+    std::size_t numGridPoints,
+    const ::dart::dynamics::MetaSkeletonPtr& metaSkeleton)
+{
+  if (static_cast<std::size_t>(maxVelocity.size()) != dimension)
+    throw std::invalid_argument("Velocity limits have wrong dimension.");
+
+  if (static_cast<std::size_t>(maxAcceleration.size()) != dimension)
+    throw std::invalid_argument("Acceleration limits have wrong dimension.");
+
+  for (std::size_t i = 0; i < dimension; ++i)
+  {
+    if (maxVelocity[i] <= 0.)
+      throw std::invalid_argument("Velocity limits must be positive.");
+    if (!std::isfinite(maxVelocity[i]))
+      throw std::invalid_argument("Velocity limits must be finite.");
+
+    if (maxAcceleration[i] <= 0.)
+      throw std::invalid_argument("Acceleration limits must be positive.");
+    if (!std::isfinite(maxAcceleration[i]))
+      throw std::invalid_argument("Acceleration limits must be finite.");
+  }
+
+  if (numGridPoints < 2)
+    throw std::invalid_argument("At least two grid points are required.");
+
+  if (metaSkeleton && metaSkeleton->getNumDofs() != dimension)
+  {
+    throw std::invalid_argument(
+        "MetaSkeleton does not match the dimension of the state space.");
+  }
+}
+
+//==============================================================================
+std::vector<double> createGrid(
+    double start,
+    double end,
+    std::size_t numGridPoints,
+    std::vector<double> extraGridPoints)
+{
+  if (!(end > start))
+    throw std::invalid_argument("Path has zero length.");
+
+  std::vector<double> grid;
+  grid.reserve(numGridPoints + extraGridPoints.size());
+  for (std::size_t i = 0; i < numGridPoints; ++i)
+    grid.emplace_back(start + (end - start) * i / (numGridPoints - 1));
+  grid.back() = end;
+
+  for (const double point : extraGridPoints)
+  {
+    if (point > start && point < end)
+      grid.emplace_back(point);
+  }
+  std::sort(grid.begin(), grid.end());
+
+  // Drop points too close to their predecessor to form a grid interval.
+  const double minSpacing = feasibilityTolerance * (end - start);
+  std::vector<double> uniqueGrid{grid.front()};
+  for (std::size_t i = 1; i < grid.size(); ++i)
+  {
+    if (grid[i] - uniqueGrid.back() > minSpacing)
+      uniqueGrid.emplace_back(grid[i]);
+  }
+  uniqueGrid.back() = end;
+
+  return uniqueGrid;
+}
+
+//==============================================================================
+GridPath samplePath(const Path& path, std::size_t numGridPoints)
+{
+  std::vector<double> switchingPoints;
+  for (const auto& switchingPoint : path.getSwitchingPoints())
+    switchingPoints.emplace_back(switchingPoint.first);
+
+  GridPath gridPath;
+  gridPath.mGrid
+      = createGrid(0., path.getLength(), numGridPoints, switchingPoints);
+
+  const auto dimension = path.getConfig(0.).size();
+  const auto numPoints = gridPath.mGrid.size();
+  gridPath.mPositions.resize(dimension, numPoints);
+  gridPath.mTangents.resize(dimension, numPoints);
+  gridPath.mCurvatures.resize(dimension, numPoints);
+  for (std::size_t i = 0; i < numPoints; ++i)
+  {
+    gridPath.mPositions.col(i) = path.getConfig(gridPath.mGrid[i]);
+    gridPath.mTangents.col(i) = path.getTangent(gridPath.mGrid[i]);
+    gridPath.mCurvatures.col(i) = path.getCurvature(gridPath.mGrid[i]);
+  }
+
+  return gridPath;
+}
+
+//==============================================================================
+GridPath sampleSpline(
+    const aikido::trajectory::Spline& spline, std::size_t numGridPoints)
+{
+  std::vector<double> waypointTimes;
+  for (std::size_t i = 0; i < spline.getNumWaypoints(); ++i)
+    waypointTimes.emplace_back(spline.getWaypointTime(i));
+
+  GridPath gridPath;
+  gridPath.mGrid = createGrid(
+      spline.getStartTime(), spline.getEndTime(), numGridPoints, waypointTimes);
+
+  const Eigen::VectorXd times = Eigen::Map<const Eigen::VectorXd>(
+      gridPath.mGrid.data(), gridPath.mGrid.size());
+  spline.evaluateBatch(times, gridPath.mPositions);
+  spline.evaluateDerivativeBatch(times, 1, gridPath.mTangents);
+  spline.evaluateDerivativeBatch(times, 2, gridPath.mCurvatures);
+
+  return gridPath;
+}
+
+//==============================================================================
+std::vector<GridConstraints> createConstraints(
+    const GridPath& path,
+    const Eigen::VectorXd& maxVelocity,
+    const Eigen::VectorXd& maxAcceleration,
+    const ::dart::dynamics::MetaSkeletonPtr& metaSkeleton)
+{
+  const auto dimension = path.mPositions.rows();
+  const auto numConstraints = metaSkeleton ? 2 * dimension : dimension;
+
+  std::unique_ptr<MetaSkeletonStateSaver> saver;
+  Eigen::VectorXd savedVelocities;
+  Eigen::VectorXd forceLowerLimits;
+  Eigen::VectorXd forceUpperLimits;
+  if (metaSkeleton)
+  {
+    saver = ::aikido::common::make_unique<MetaSkeletonStateSaver>(
+        metaSkeleton, MetaSkeletonStateSaver::POSITIONS);
+    savedVelocities = metaSkeleton->getVelocities();
+    forceLowerLimits = metaSkeleton->getForceLowerLimits();
+    forceUpperLimits = metaSkeleton->getForceUpperLimits();
+  }
+
+  std::vector<GridConstraints> constraints(path.mGrid.size());
+  for (std::size_t i = 0; i < path.mGrid.size(); ++i)
+  {
+    const Eigen::VectorXd tangent = path.mTangents.col(i);
+    const Eigen::VectorXd curvature = path.mCurvatures.col(i);
+    auto& gridConstraints = constraints[i];
+
+    // Velocity limits bound the squared path velocity directly.
+    gridConstraints.mMaxX = std::numeric_limits<double>::infinity();
+    for (int j = 0; j < dimension; ++j)
+    {
+      if (tangent[j] != 0.)
+      {
+        const double maxPathVelocity = maxVelocity[j] / std::abs(tangent[j]);
+        gridConstraints.mMaxX = std::min(
+            gridConstraints.mMaxX, maxPathVelocity * maxPathVelocity);
+      }
+    }
+
+    // The joint acceleration is tangent * u + curvature * x.
+    gridConstraints.mA.resize(numConstraints);
+    gridConstraints.mB.resize(numConstraints);
+    gridConstraints.mLower.resize(numConstraints);
+    gridConstraints.mUpper.resize(numConstraints);
+    gridConstraints.mA.head(dimension) = tangent;
+    gridConstraints.mB.head(dimension) = curvature;
+    gridConstraints.mLower.head(dimension) = -maxAcceleration;
+    gridConstraints.mUpper.head(dimension) = maxAcceleration;
+
+    // The joint torque is M * (tangent * u + curvature * x) + C * x + g, where
+    // C is the Coriolis force at the joint velocity tangent.
+    if (metaSkeleton)
+    {
+      metaSkeleton->setPositions(path.mPositions.col(i));
+      metaSkeleton->setVelocities(tangent);
+      const Eigen::MatrixXd massMatrix = metaSkeleton->getMassMatrix();
+      const Eigen::VectorXd coriolisForces
+          = metaSkeleton->getCoriolisForces();
+      metaSkeleton->setVelocities(Eigen::VectorXd::Zero(dimension));
+      const Eigen::VectorXd gravityForces = metaSkeleton->getGravityForces();
+
+      gridConstraints.mA.tail(dimension) = massMatrix * tangent;
+      gridConstraints.mB.tail(dimension)
+          = massMatrix * curvature + coriolisForces;
+      gridConstraints.mLower.tail(dimension)
+          = forceLowerLimits - gravityForces;
+      gridConstraints.mUpper.tail(dimension)
+          = forceUpperLimits - gravityForces;
+    }
+  }
+
+  if (metaSkeleton)
+    metaSkeleton->setVelocities(savedVelocities);
+
+  return constraints;
+}
+
+//==============================================================================
+/// Adds the constraint alpha * u <= beta + gamma * x to bounds.
+void addHalfPlane(
+    double alpha, double beta, double gamma, AccelerationBounds& bounds)
+{
+  // Infinite force limits do not constrain anything.
+  if (beta == std::numeric_limits<double>::infinity())
+    return;
+
+  if (std::abs(alpha) <= feasibilityTolerance * feasibilityTolerance)
+  {
+    if (gamma > 0.)
+      bounds.mMinX = std::max(bounds.mMinX, -beta / gamma);
+    else if (gamma < 0.)
+      bounds.mMaxX = std::min(bounds.mMaxX, -beta / gamma);
+    else if (beta < -feasibilityTolerance)
+      bounds.mMinX = std::numeric_limits<double>::infinity();
+  }
+  else if (alpha > 0.)
+  {
+    bounds.mUpper.emplace_back(beta / alpha, gamma / alpha);
+  }
+  else
+  {
+    bounds.mLower.emplace_back(beta / alpha, gamma / alpha);
+  }
+}
+
+//==============================================================================
+/// Returns the constraints at a grid point at distance delta from the next
+/// grid point, whose squared path velocity must lie in [nextMinX, nextMaxX].
+AccelerationBounds createBounds(
+    const GridConstraints& constraints,
+    double delta,
+    double nextMinX,
+    double nextMaxX)
+{
+  AccelerationBounds bounds;
+  bounds.mMinX = 0.;
+  bounds.mMaxX = constraints.mMaxX;
+
+  for (int k = 0; k < constraints.mA.size(); ++k)
+  {
+    const double a = constraints.mA[k];
+    const double b = constraints.mB[k];
+    addHalfPlane(a, constraints.mUpper[k], -b, bounds);
+    addHalfPlane(-a, -constraints.mLower[k], b, bounds);
+  }
+
+  // The next squared path velocity is x + 2 * delta * u.
+  addHalfPlane(2. * delta, nextMaxX, -1., bounds);
+  addHalfPlane(-2. * delta, -nextMinX, 1., bounds);
+
+  return bounds;
+}
+
+//==============================================================================
+/// Computes the range of x for which some u satisfies bounds, i.e. projects
+/// the feasible polygon onto the x axis. Returns false if it is empty.
+bool computeFeasibleRange(
+    const AccelerationBounds& bounds, double& minX, double& maxX)
+{
+  minX = bounds.mMinX;
+  maxX = bounds.mMaxX;
+
+  // Some u exists iff every lower bound on u is below every upper bound.
+  for (const auto& lower : bounds.mLower)
+  {
+    for (const auto& upper : bounds.mUpper)
+    {
+      const double slope = lower.second - upper.second;
+      const double offset = upper.first - lower.first;
+      if (slope > 0.)
+        maxX = std::min(maxX, offset / slope);
+      else if (slope < 0.)
+        minX = std::max(minX, offset / slope);
+      else if (offset < -feasibilityTolerance)
+        return false;
+    }
+  }
+
+  if (minX > maxX)
+  {
+    if (minX - maxX > feasibilityTolerance * std::max(1., maxX))
+      return false;
+    minX = maxX;
+  }
+
+  return true;
+}
+
+//==============================================================================
+/// Returns the largest u that satisfies bounds at x.
+double computeMaxAcceleration(const AccelerationBounds& bounds, double x)
+{
+  double minU = -std::numeric_limits<double>::infinity();
+  double maxU = std::numeric_limits<double>::infinity();
+  for (const auto& lower : bounds.mLower)
+    minU = std::max(minU, lower.first + lower.second * x);
+  for (const auto& upper : bounds.mUpper)
+    maxU = std::min(maxU, upper.first + upper.second * x);
+
+  // x is in the controllable set, so minU <= maxU up to round-off.
+  return std::max(minU, maxU);
+}
+
+//==============================================================================
+/// Computes the squared path velocity at each grid point.
+Eigen::VectorXd computeSquaredPathVelocities(
+    const std::vector<double>& grid,
+    const std::vector<GridConstraints>& constraints)
+{
+  const std::size_t numPoints = grid.size();
+
+  // Backward pass: controllable sets, from which the path can be completed
+  // with zero velocity at the end.
+  std::vector<double> minX(numPoints, 0.);
+  std::vector<double> maxX(numPoints, 0.);
+  for (std::size_t i = numPoints - 1; i-- > 0;)
+  {
+    const auto bounds = createBounds(
+        constraints[i], grid[i + 1] - grid[i], minX[i + 1], maxX[i + 1]);
+    if (!computeFeasibleRange(bounds, minX[i], maxX[i]))
+    {
+      throw std::runtime_error(
+          "Path cannot be followed within the limits: empty controllable "
+          "set.");
+    }
+  }
+
+  if (minX[0] > feasibilityTolerance)
+  {
+    throw std::runtime_error(
+        "Path cannot be followed within the limits from rest.");
+  }
+
+  // Forward pass: greedily take the largest path acceleration that keeps the
+  // next squared path velocity controllable.
+  Eigen::VectorXd x(numPoints);
+  x[0] = 0.;
+  for (std::size_t i = 0; i + 1 < numPoints; ++i)
+  {
+    const double delta = grid[i + 1] - grid[i];
+    const auto bounds
+        = createBounds(constraints[i], delta, minX[i + 1], maxX[i + 1]);
+    const double u = computeMaxAcceleration(bounds, x[i]);
+    if (!std::isfinite(u))
+    {
+      throw std::runtime_error(
+          "Path cannot be followed within the limits: unbounded path "
+          "acceleration.");
+    }
+
+    x[i + 1] = std::min(
+        std::max(x[i] + 2. * delta * u, minX[i + 1]), maxX[i + 1]);
+    x[i + 1] = std::max(x[i + 1], 0.);
+  }
+
+  return x;
+}
+
+//==============================================================================
+std::unique_ptr<aikido::trajectory::Spline> computeTiming(
+    const GridPath& path,
+    const Eigen::VectorXd& maxVelocity,
+    const Eigen::VectorXd& maxAcceleration,
+    const ::dart::dynamics::MetaSkeletonPtr& metaSkeleton,
+    aikido::statespace::ConstStateSpacePtr stateSpace,
+    double startTime)
+{
+  const auto constraints
+      = createConstraints(path, maxVelocity, maxAcceleration, metaSkeleton);
+  const Eigen::VectorXd x
+      = computeSquaredPathVelocities(path.mGrid, constraints);
+  const Eigen::VectorXd pathVelocities = x.cwiseSqrt();
+
+  auto outputTrajectory
+      = ::aikido::common::make_unique<aikido::trajectory::Spline>(
+          stateSpace, startTime);
+
+  auto startState = stateSpace->createState();
+  auto endState = stateSpace->createState();
+  auto inverseStartState = stateSpace->createState();
+  auto relativeState = stateSpace->createState();
+  Eigen::VectorXd displacement;
+
+  stateSpace->expMap(path.mPositions.col(0), startState);
+  for (std::size_t i = 0; i + 1 < path.mGrid.size(); ++i)
+  {
+    // The path acceleration is constant between grid points.
+    const double delta = path.mGrid[i + 1] - path.mGrid[i];
+    const double sumPathVelocities = pathVelocities[i] + pathVelocities[i + 1];
+    if (!(sumPathVelocities > 0.))
+    {
+      throw std::runtime_error(
+          "Path cannot be followed within the limits: zero path velocity.");
+    }
+    const double duration = 2. * delta / sumPathVelocities;
+
+    stateSpace->expMap(path.mPositions.col(i + 1), endState);
+    stateSpace->getInverse(startState, inverseStartState);
+    stateSpace->compose(inverseStartState, endState, relativeState);
+    stateSpace->logMap(relativeState, displacement);
+
+    const Eigen::MatrixXd coefficients = fitCubicSegment(
+        Eigen::VectorXd::Zero(displacement.size()),
+        path.mTangents.col(i) * pathVelocities[i],
+        displacement,
+        path.mTangents.col(i + 1) * pathVelocities[i + 1],
+        duration);
+    outputTrajectory->addSegment(coefficients, duration, startState);
+
+    stateSpace->copyState(endState, startState);
+  }
+
+  return outputTrajectory;
+}
+
+} // namespace
+
+//==============================================================================
+std::unique_ptr<aikido::trajectory::Spline> computeToppraTiming(
+    const aikido::trajectory::Interpolated& inputTrajectory,
+    const Eigen::VectorXd& maxVelocity,
+    const Eigen::VectorXd& maxAcceleration,
+    double maxDeviation,
+    std::size_t numGridPoints,
+    const ::dart::dynamics::MetaSkeletonPtr& metaSkeleton)
+{
+  const auto stateSpace = inputTrajectory.getStateSpace();
+  checkLimits(
+      stateSpace->getDimension(),
+      maxVelocity,
+      maxAcceleration,
+      numGridPoints,
+      metaSkeleton);
+
+  if (inputTrajectory.getNumWaypoints() < 2)
+    throw std::invalid_argument("Trajectory needs at least two waypoints.");
+
+  // Unwrap SO2 joints so that the path is continuous.
+  const aikido::trajectory::Interpolated* trajectory = &inputTrajectory;
+  ConstInterpolatedPtr r1Trajectory;
+  if (std::dynamic_pointer_cast<const MetaSkeletonStateSpace>(stateSpace))
+  {
+    r1Trajectory = toR1JointTrajectory(inputTrajectory);
+    trajectory = r1Trajectory.get();
+  }
+
+  const auto pathStateSpace = trajectory->getStateSpace();
+  std::list<Eigen::VectorXd> waypoints;
+  Eigen::VectorXd position;
+  for (std::size_t i = 0; i < trajectory->getNumWaypoints(); ++i)
+  {
+    pathStateSpace->logMap(trajectory->getWaypoint(i), position);
+    waypoints.emplace_back(position);
+  }
+  const Path path(waypoints, maxDeviation);
+
+  return computeTiming(
+      samplePath(path, numGridPoints),
+      maxVelocity,
+      maxAcceleration,
+      metaSkeleton,
+      stateSpace,
+      inputTrajectory.getStartTime());
+}
+
+//==============================================================================
+std::unique_ptr<aikido::trajectory::Spline> computeToppraTiming(
+    const aikido::trajectory::Spline& inputTrajectory,
+    const Eigen::VectorXd& maxVelocity,
+    const Eigen::VectorXd& maxAcceleration,
+    std::size_t numGridPoints,
+    const ::dart::dynamics::MetaSkeletonPtr& metaSkeleton)
+{
+  const auto stateSpace = inputTrajectory.getStateSpace();
+  checkLimits(
+      stateSpace->getDimension(),
+      maxVelocity,
+      maxAcceleration,
+      numGridPoints,
+      metaSkeleton);
+
+  if (inputTrajectory.getNumSegments() == 0)
+    throw std::invalid_argument("Trajectory is empty.");
+
+  return computeTiming(
+      sampleSpline(inputTrajectory, numGridPoints),
+      maxVelocity,
+      maxAcceleration,
+      metaSkeleton,
+      stateSpace,
+      inputTrajectory.getStartTime());
+}
+
+//==============================================================================
+ToppraRetimer::ToppraRetimer(
+    const Eigen::VectorXd& velocityLimits,
+    const Eigen::VectorXd& accelerationLimits,
+    double maxDeviation,
+    std::size_t numGridPoints,
+    ::dart::dynamics::MetaSkeletonPtr metaSkeleton)
+  : mVelocityLimits{velocityLimits}
+  , mAccelerationLimits{accelerationLimits}
+  , mMaxDeviation(maxDeviation)
+  , mNumGridPoints(numGridPoints)
+  , mMetaSkeleton(std::move(metaSkeleton))
+{
+  // Do nothing
+}
+
+//==============================================================================
+std::unique_ptr<aikido::trajectory::Spline> ToppraRetimer::postprocess(
+    const aikido::trajectory::Interpolated& inputTraj,
+    const aikido::common::RNG& /*rng*/,
+    const aikido::constraint::TestablePtr& /*constraint*/)
+{
+  return computeToppraTiming(
+      inputTraj,
+      mVelocityLimits,
+      mAccelerationLimits,
+      mMaxDeviation,
+      mNumGridPoints,
+      mMetaSkeleton);
+}
+
+//==============================================================================
+std::unique_ptr<aikido::trajectory::Spline> ToppraRetimer::postprocess(
+    const aikido::trajectory::Spline& inputTraj,
+    const aikido::common::RNG& /*rng*/,
+    const aikido::constraint::TestablePtr& /*constraint*/)
+{
+  return computeToppraTiming(
+      inputTraj,
+      mVelocityLimits,
+      mAccelerationLimits,
+      mNumGridPoints,
+      mMetaSkeleton);
+}
+
+//==============================================================================
+const Eigen::VectorXd& ToppraRetimer::getVelocityLimits() const
+{
+  return mVelocityLimits;
+}
+
+//==============================================================================
+const Eigen::VectorXd& ToppraRetimer::getAccelerationLimits() const
+{
+  return mAccelerationLimits;
+}
+
+//==============================================================================
+void ToppraRetimer::setVelocityLimits(const Eigen::VectorXd& velocityLimits)
+{
+  mVelocityLimits = velocityLimits;
+}
+
+//==============================================================================
+void ToppraRetimer::setAccelerationLimits(
+    const Eigen::VectorXd& accelerationLimits)
+{
+  mAccelerationLimits = accelerationLimits;
+}
+
+//==============================================================================
+double ToppraRetimer::getMaxDeviation() const
+{
+  return mMaxDeviation;
+}
+
+//==============================================================================
+void ToppraRetimer::setMaxDeviation(double maxDeviation)
+{
+  mMaxDeviation = maxDeviation;
+}
+
+//==============================================================================
+std::size_t ToppraRetimer::getNumGridPoints() const
+{
+  return mNumGridPoints;
+}
+
+//==============================================================================
+void ToppraRetimer::setNumGridPoints(std::size_t numGridPoints)
+{
+  mNumGridPoints = numGridPoints;
+}
+
+//==============================================================================
+::dart::dynamics::MetaSkeletonPtr ToppraRetimer::getMetaSkeleton() const
+{
+  return mMetaSkeleton;
+}
+
+//==============================================================================
+void ToppraRetimer::setMetaSkeleton(
+    ::dart::dynamics::MetaSkeletonPtr metaSkeleton)
+{
+  mMetaSkeleton = std::move(metaSkeleton);
+}
+
+} // namespace toppra
+} // namespace planner
+} // namespace aikido
@@ -1,5 +1,8 @@
 #include "aikido/planner/vectorfield/BodyNodePoseVectorField.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #include "aikido/common/StepSequence.hpp"
 #include "aikido/planner/vectorfield/VectorFieldUtil.hpp"
 
@@ -63,6 +66,10 @@ bool BodyNodePoseVectorField::evaluateVelocity(
     return false;
   }
 
+  // Use the shared solvers unless another evaluation holds them.
+  std::unique_lock<std::mutex> lock(
+      mJointVelocitySolverMutex, std::try_to_lock);
+
   bool result = computeJointVelocityFromTwist(
       qd,
       desiredTwist,
@@ -72,7 +79,9 @@ bool BodyNodePoseVectorField::evaluateVelocity(
       mVelocityLowerLimits,
       mVelocityUpperLimits,
       mEnforceJointVelocityLimits,
-      mMaxStepSize);
+      mMaxStepSize,
+      lock.owns_lock() ? &mJointVelocitySolver : nullptr,
+      lock.owns_lock() ? &mJointVelocityWorkspace : nullptr);
   return result;
 }
 
@@ -105,7 +114,6 @@ bool BodyNodePoseVectorField::evaluateTrajectory(
   {
     return true;
   }
-  auto state = mMetaSkeletonStateSpace->createState();
 
   aikido::common::StepSequence seq(
       evalStepSize,
@@ -114,14 +122,39 @@ bool BodyNodePoseVectorField::evaluateTrajectory(
       evalTimePivot,
       trajectory.getEndTime());
 
-  for (double t : seq)
+  // Evaluate the trajectory in small batches, so that a constraint violated
+  // early does not pay for evaluating the rest of the trajectory.
+  constexpr std::size_t batchSize = 16;
+  std::vector<aikido::statespace::dart::MetaSkeletonStateSpace::ScopedState>
+      batchStates;
+  std::vector<aikido::statespace::StateSpace::State*> states;
+  batchStates.reserve(batchSize);
+  for (std::size_t i = 0; i < batchSize; ++i)
+    batchStates.emplace_back(mMetaSkeletonStateSpace->createState());
+
+  Eigen::VectorXd times;
+  for (std::size_t begin = 0; begin < seq.getLength(); begin += batchSize)
   {
-    trajectory.evaluate(t, state);
-    // update current evaluation time pivot
-    evalTimePivot = t;
-    if (!constraint->isSatisfied(state))
+    const std::size_t end = std::min(begin + batchSize, seq.getLength());
+
+    times.resize(end - begin);
+    states.clear();
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      times[i - begin] = seq[i];
+      states.emplace_back(batchStates[i - begin].getState());
+    }
+
+    trajectory.evaluateBatch(times, states);
+
+    for (Eigen::Index i = 0; i < times.size(); ++i)
     {
-      return false;
+      // update current evaluation time pivot
+      evalTimePivot = times[i];
+      if (!constraint->isSatisfied(states[i]))
+      {
+        return false;
+      }
     }
   }
 
@@ -1,9 +1,8 @@
 #include "aikido/planner/vectorfield/VectorFieldUtil.hpp"
 
 #include <Eigen/Geometry>
-#include <dart/optimizer/Solver.hpp>
-#include <dart/optimizer/nlopt/NloptSolver.hpp>
 
+#include "aikido/common/PseudoInverse.hpp"
 #include "aikido/common/algorithm.hpp"
 #include "aikido/trajectory/Spline.hpp"
 
@@ -11,61 +10,6 @@ namespace aikido {
 namespace planner {
 namespace vectorfield {
 
-namespace {
-
-/// A function class that defines an objective. The objective measures
-/// the difference between a desired twist and Jacobian * joint velocities.
-///
-class DesiredTwistFunction : public dart::optimizer::Function
-{
-public:
-  using Twist = Eigen::Vector6d;
-  using Jacobian = dart::math::Jacobian;
-
-  /// Constructor.
-  ///
-  /// \param[in] twist A desired twist.
-  /// \param[in] jacobian System Jacobian.
-  DesiredTwistFunction(const Twist& twist, const Jacobian& jacobian)
-    : dart::optimizer::Function("DesiredTwistFunction")
-    , mTwist(twist)
-    , mJacobian(jacobian)
-  {
-    // Do nothing
-  }
-
-  /// Implementation inherited.
-  /// Evaluating an objective by a state value.
-  ///
-  /// \param[in] qd Joint velocities.
-  /// \return Objective value.
-  double eval(const Eigen::VectorXd& qd) override
-  {
-    return 0.5 * (mJacobian * qd - mTwist).squaredNorm();
-  }
-
-  /// Implementation inherited.
-  /// Evaluating gradient of an objective by a state value.
-  /// \param[in] qd Joint velocities.
-  /// \param[out] grad Gradient of a defined objective.
-  void evalGradient(
-      const Eigen::VectorXd& qd, Eigen::Map<Eigen::VectorXd> grad) override
-  {
-    grad = mJacobian.transpose() * (mJacobian * qd - mTwist);
-  }
-
-protected:
-  /// Twist.
-  Twist mTwist;
-
-  /// Jacobian of Meta Skeleton.
-  Jacobian mJacobian;
-
-public:
-  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
-};
-} // namespace
-
 //==============================================================================
 bool computeJointVelocityFromTwist(
     Eigen::VectorXd& jointVelocity,
@@ -76,72 +20,77 @@ bool computeJointVelocityFromTwist(
     const Eigen::VectorXd& jointVelocityLowerLimits,
     const Eigen::VectorXd& jointVelocityUpperLimits,
     bool enforceJointVelocityLimits,
-    double stepSize)
+    double stepSize,
+    common::BoundedLeastSquares* solver,
+    common::LeastSquaresWorkspace<6, Eigen::Dynamic>* workspace)
 {
   using dart::math::Jacobian;
-  using dart::optimizer::Problem;
-  using dart::optimizer::Solver;
   using Eigen::VectorXd;
 
-  // Use LBFGS to find joint angles that won't violate the joint limits.
   const Jacobian jacobian = metaSkeleton->getWorldJacobian(bodyNode);
 
   const std::size_t numDofs = metaSkeleton->getNumDofs();
 
-  jointVelocity = Eigen::VectorXd::Zero(numDofs);
   VectorXd positions = metaSkeleton->getPositions();
   VectorXd initialGuess = metaSkeleton->getVelocities();
+
+  if (!enforceJointVelocityLimits)
+  {
+    // Without bounds the objective is an unconstrained least-squares problem.
+    // Use its solution closest to the initial guess, which has a closed form.
+    common::LeastSquaresWorkspace<6, Eigen::Dynamic> localWorkspace;
+    if (!workspace)
+      workspace = &localWorkspace;
+
+    const Eigen::Vector6d residual = desiredTwist - jacobian * initialGuess;
+    common::solveLeastSquares(jacobian, residual, jointVelocity, *workspace);
+    jointVelocity += initialGuess;
+    return true;
+  }
+
   VectorXd positionLowerLimits = metaSkeleton->getPositionLowerLimits();
   VectorXd positionUpperLimits = metaSkeleton->getPositionUpperLimits();
   VectorXd velocityLowerLimits = jointVelocityLowerLimits;
   VectorXd velocityUpperLimits = jointVelocityUpperLimits;
 
-  const auto problem = std::make_shared<Problem>(numDofs);
-  if (enforceJointVelocityLimits)
+  for (std::size_t i = 0; i < numDofs; ++i)
   {
-    for (std::size_t i = 0; i < numDofs; ++i)
+    const double position = positions[i];
+    const double positionLowerLimit = positionLowerLimits[i];
+    const double positionUpperLimit = positionUpperLimits[i];
+    const double velocityLowerLimit = velocityLowerLimits[i];
+    const double velocityUpperLimit = velocityUpperLimits[i];
+
+    if (position + stepSize * velocityLowerLimit
+        <= positionLowerLimit + jointLimitPadding)
     {
-      const double position = positions[i];
-      const double positionLowerLimit = positionLowerLimits[i];
-      const double positionUpperLimit = positionUpperLimits[i];
-      const double velocityLowerLimit = velocityLowerLimits[i];
-      const double velocityUpperLimit = velocityUpperLimits[i];
-
-      if (position + stepSize * velocityLowerLimit
-          <= positionLowerLimit + jointLimitPadding)
-      {
-        velocityLowerLimits[i] = 0.0;
-      }
-
-      if (position + stepSize * velocityUpperLimit
-          >= positionUpperLimit - jointLimitPadding)
-      {
-        velocityUpperLimits[i] = 0.0;
-      }
-
-      initialGuess[i] = common::clamp(
-          initialGuess[i], velocityLowerLimits[i], velocityUpperLimits[i]);
+      velocityLowerLimits[i] = 0.0;
     }
-    problem->setLowerBounds(velocityLowerLimits);
-    problem->setUpperBounds(velocityUpperLimits);
-  }
 
-  problem->setInitialGuess(initialGuess);
-  problem->setObjective(dart::common::make_aligned_shared<DesiredTwistFunction>(
-      desiredTwist, jacobian));
-
-#if DART_VERSION_AT_LEAST(6, 9, 0)
-  dart::optimizer::NloptSolver solver(
-      problem, dart::optimizer::NloptSolver::LD_LBFGS);
-#else
-  dart::optimizer::NloptSolver solver(problem, nlopt::LD_LBFGS);
-#endif
-  if (!solver.solve())
-  {
-    return false;
+    if (position + stepSize * velocityUpperLimit
+        >= positionUpperLimit - jointLimitPadding)
+    {
+      velocityUpperLimits[i] = 0.0;
+    }
+
+    initialGuess[i] = common::clamp(
+        initialGuess[i], velocityLowerLimits[i], velocityUpperLimits[i]);
   }
-  jointVelocity = problem->getOptimalSolution();
-  return true;
+
+  // Find the joint velocities within the bounds that best achieve the desired
+  // twist. Among equally good solutions, the one closest to the initial guess
+  // is used. The previous solution in jointVelocity warm-starts the solver.
+  common::BoundedLeastSquares localSolver;
+  if (!solver)
+    solver = &localSolver;
+
+  return solver->solve(
+      jacobian,
+      desiredTwist,
+      velocityLowerLimits,
+      velocityUpperLimits,
+      initialGuess,
+      jointVelocity);
 }
 
 //==============================================================================
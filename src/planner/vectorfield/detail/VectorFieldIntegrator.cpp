@@ -15,37 +15,50 @@ namespace planner {
 namespace vectorfield {
 namespace detail {
 
+namespace {
+
+//==============================================================================
+/// Appends the segment that moves linearly from \c from to \c to.
+///
+/// \param[in] from Knot at the start of the segment.
+/// \param[in] to Knot at the end of the segment.
+/// \param[in,out] spline Trajectory to append the segment to.
+/// \param[in] startState Scratch state in the state space of \c spline.
+void addLinearSegment(
+    const Knot& from,
+    const Knot& to,
+    aikido::trajectory::Spline& spline,
+    aikido::statespace::StateSpace::State* startState)
+{
+  const double segmentDuration = to.mT - from.mT;
+
+  // The linear polynomial with p(0) = 0 and p(segmentDuration) = to - from.
+  const Eigen::MatrixXd coefficients = ::aikido::common::fitLinearSegment(
+      Eigen::VectorXd::Zero(from.mPositions.size()),
+      to.mPositions - from.mPositions,
+      segmentDuration);
+
+  spline.getStateSpace()->expMap(from.mPositions, startState);
+  spline.addSegment(coefficients, segmentDuration, startState);
+}
+
+} // namespace
+
 //==============================================================================
 std::unique_ptr<aikido::trajectory::Spline> convertToSpline(
     const std::vector<Knot>& knots,
     aikido::statespace::ConstStateSpacePtr stateSpace)
 {
-  std::size_t dimension = stateSpace->getDimension();
-
   auto outputTrajectory
       = ::aikido::common::make_unique<aikido::trajectory::Spline>(stateSpace);
 
-  using CubicSplineProblem = aikido::common::
-      SplineProblem<double, int, 2, Eigen::Dynamic, Eigen::Dynamic>;
-
-  const Eigen::VectorXd zeroPosition = Eigen::VectorXd::Zero(dimension);
   auto currState = stateSpace->createState();
-  for (std::size_t iknot = 0; iknot < knots.size() - 1; ++iknot)
+  for (std::size_t iknot = 0; iknot + 1 < knots.size(); ++iknot)
   {
-    const double segmentDuration = knots[iknot + 1].mT - knots[iknot].mT;
-    Eigen::VectorXd currentPosition = knots[iknot].mPositions;
-    Eigen::VectorXd nextPosition = knots[iknot + 1].mPositions;
-
-    CubicSplineProblem problem(
-        Eigen::Vector2d{0., segmentDuration}, 2, dimension);
-    problem.addConstantConstraint(0, 0, zeroPosition);
-    problem.addConstantConstraint(1, 0, nextPosition - currentPosition);
-    const auto solution = problem.fit();
-    const auto coefficients = solution.getCoefficients().front();
-
-    stateSpace->expMap(currentPosition, currState);
-    outputTrajectory->addSegment(coefficients, segmentDuration, currState);
+    addLinearSegment(
+        knots[iknot], knots[iknot + 1], *outputTrajectory, currState);
   }
+
   return outputTrajectory;
 }
 
@@ -84,6 +97,7 @@ VectorFieldIntegrator::VectorFieldIntegrator(
   , mTimelimit(timelimit)
   , mConstraintCheckResolution(checkConstraintResolution)
   , mState(mVectorField->getStateSpace()->createState())
+  , mSegmentStartState(mVectorField->getStateSpace()->createState())
   , mLastEvaluationTime(0.0)
 {
   // Do nothing
@@ -94,6 +108,8 @@ void VectorFieldIntegrator::start()
 {
   mTimer.start();
   mKnots.clear();
+  mSpline = ::aikido::common::make_unique<aikido::trajectory::Spline>(
+      mVectorField->getStateSpace());
   mCacheIndex = -1;
   mLastEvaluationTime = 0.0;
 }
@@ -147,10 +163,13 @@ void VectorFieldIntegrator::check(const Eigen::VectorXd& q, double t)
 
   if (mKnots.size() > 1)
   {
-    auto trajSegment = convertToSpline(mKnots, mVectorField->getStateSpace());
+    // Only the new segment has to be fitted, and only the part of the
+    // trajectory after mLastEvaluationTime is checked.
+    addLinearSegment(
+        mKnots[mKnots.size() - 2], mKnots.back(), *mSpline, mSegmentStartState);
 
     if (!mVectorField->evaluateTrajectory(
-            *trajSegment,
+            *mSpline,
             mConstraint,
             mConstraintCheckResolution,
             mLastEvaluationTime,
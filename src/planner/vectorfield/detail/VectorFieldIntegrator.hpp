@@ -125,6 +125,12 @@ protected:
   /// Current state in integration
   aikido::statespace::StateSpace::ScopedState mState;
 
+  /// Scratch state used when appending segments to mSpline.
+  aikido::statespace::StateSpace::ScopedState mSegmentStartState;
+
+  /// Trajectory through mKnots, extended by one segment per check().
+  std::unique_ptr<aikido::trajectory::Spline> mSpline;
+
   /// Last evaluation time in checking trajectory
   double mLastEvaluationTime;
 };
@@ -47,6 +47,19 @@ ConcreteManipulator::retimePathWithKunz(
   return mRobot->retimePathWithKunz(metaSkeleton, path, maxDeviation, timestep);
 }
 
+//==============================================================================
+std::unique_ptr<aikido::trajectory::Spline>
+ConcreteManipulator::retimePathWithToppra(
+    const dart::dynamics::MetaSkeletonPtr& metaSkeleton,
+    const aikido::trajectory::Trajectory* path,
+    double maxDeviation,
+    std::size_t numGridPoints,
+    bool enforceTorqueLimits)
+{
+  return mRobot->retimePathWithToppra(
+      metaSkeleton, path, maxDeviation, numGridPoints, enforceTorqueLimits);
+}
+
 //==============================================================================
 std::future<void> ConcreteManipulator::executeTrajectory(
     const trajectory::TrajectoryPtr& trajectory) const
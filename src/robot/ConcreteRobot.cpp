@@ -2,6 +2,7 @@
 
 #include "aikido/constraint/TestableIntersection.hpp"
 #include "aikido/planner/kunzretimer/KunzRetimer.hpp"
+#include "aikido/planner/toppra/ToppraRetimer.hpp"
 #include "aikido/robot/util.hpp"
 #include "aikido/statespace/StateSpace.hpp"
 
@@ -16,6 +17,7 @@ using planner::TrajectoryPostProcessor;
 using planner::kunzretimer::KunzRetimer;
 using planner::parabolic::ParabolicSmoother;
 using planner::parabolic::ParabolicTimer;
+using planner::toppra::ToppraRetimer;
 using statespace::StateSpace;
 using statespace::StateSpacePtr;
 using statespace::dart::ConstMetaSkeletonStateSpacePtr;
@@ -187,6 +189,34 @@ UniqueSplinePtr ConcreteRobot::retimePathWithKunz(
   throw std::invalid_argument("Path should be either Spline or Interpolated.");
 }
 
+//==============================================================================
+UniqueSplinePtr ConcreteRobot::retimePathWithToppra(
+    const dart::dynamics::MetaSkeletonPtr& metaSkeleton,
+    const aikido::trajectory::Trajectory* path,
+    double maxDeviation,
+    std::size_t numGridPoints,
+    bool enforceTorqueLimits)
+{
+  Eigen::VectorXd velocityLimits = getVelocityLimits(*metaSkeleton);
+  Eigen::VectorXd accelerationLimits = getAccelerationLimits(*metaSkeleton);
+  auto retimer = std::make_shared<ToppraRetimer>(
+      velocityLimits,
+      accelerationLimits,
+      maxDeviation,
+      numGridPoints,
+      enforceTorqueLimits ? metaSkeleton : nullptr);
+
+  auto interpolated = dynamic_cast<const Interpolated*>(path);
+  if (interpolated)
+    return retimer->postprocess(*interpolated, *(cloneRNG().get()));
+
+  auto spline = dynamic_cast<const Spline*>(path);
+  if (spline)
+    return retimer->postprocess(*spline, *(cloneRNG().get()));
+
+  throw std::invalid_argument("Path should be either Spline or Interpolated.");
+}
+
 //==============================================================================
 std::future<void> ConcreteRobot::executeTrajectory(
     const TrajectoryPtr& trajectory) const
@@ -414,7 +444,9 @@ TrajectoryPtr ConcreteRobot::planToTSR(
     const CollisionFreePtr& collisionFree,
     double timelimit,
     std::size_t maxNumTrials,
-    const distance::ConstConfigurationRankerPtr& ranker)
+    const distance::ConstConfigurationRankerPtr& ranker,
+    std::size_t numThreads,
+    const util::CollisionTestableFactory& createWorkerCollisionTestable)
 {
   auto collisionConstraint
       = getFullCollisionConstraint(stateSpace, metaSkeleton, collisionFree);
@@ -428,7 +460,9 @@ TrajectoryPtr ConcreteRobot::planToTSR(
       cloneRNG().get(),
       timelimit,
       maxNumTrials,
-      ranker);
+      ranker,
+      numThreads,
+      createWorkerCollisionTestable);
 }
 
 //==============================================================================
@@ -439,7 +473,9 @@ TrajectoryPtr ConcreteRobot::planToTSRwithTrajectoryConstraint(
     const TSRPtr& goalTsr,
     const TSRPtr& constraintTsr,
     const CollisionFreePtr& collisionFree,
-    double timelimit)
+    double timelimit,
+    std::size_t numThreads,
+    const util::CollisionTestableFactory& createWorkerCollisionTestable)
 {
   auto collisionConstraint
       = getFullCollisionConstraint(stateSpace, metaSkeleton, collisionFree);
@@ -453,7 +489,9 @@ TrajectoryPtr ConcreteRobot::planToTSRwithTrajectoryConstraint(
       constraintTsr,
       collisionConstraint,
       timelimit,
-      mCRRTParameters);
+      mCRRTParameters,
+      numThreads,
+      createWorkerCollisionTestable);
 }
 
 //==============================================================================
@@ -1,12 +1,14 @@
 #include "aikido/robot/util.hpp"
 
 #include <algorithm>
+#include <atomic>
 
 #include <dart/common/Console.hpp>
 #include <dart/common/Timer.hpp>
 #include <ompl/geometric/planners/rrt/RRTConnect.h>
 
 #include "aikido/common/RNG.hpp"
+#include "aikido/common/ThreadPool.hpp"
 #include "aikido/common/memory.hpp"
 #include "aikido/constraint/CyclicSampleable.hpp"
 #include "aikido/constraint/FiniteSampleable.hpp"
@@ -65,6 +67,8 @@ using trajectory::TrajectoryPtr;
 using dart::collision::FCLCollisionDetector;
 using dart::dynamics::BodyNodePtr;
 using dart::dynamics::ChainPtr;
+using dart::dynamics::DegreeOfFreedom;
+using dart::dynamics::Group;
 using dart::dynamics::InverseKinematics;
 using dart::dynamics::MetaSkeleton;
 using dart::dynamics::MetaSkeletonPtr;
@@ -163,6 +167,513 @@ trajectory::TrajectoryPtr planToConfigurations(
   return nullptr;
 }
 
+namespace {
+
+/// Maximum number of IK solutions sampled by planToTSR.
+constexpr std::size_t maxSnapSamples{100};
+
+/// Copy of the robot owned by one thread of the parallel planToTSR.
+struct PlanningWorker
+{
+  SkeletonPtr mSkeleton;
+  MetaSkeletonPtr mMetaSkeleton;
+  MetaSkeletonStateSpacePtr mStateSpace;
+  BodyNodePtr mBodyNode;
+  TestablePtr mCollisionTestable;
+  std::unique_ptr<RNG> mRng;
+};
+
+//==============================================================================
+std::vector<PlanningWorker> createPlanningWorkers(
+    const MetaSkeletonPtr& metaSkeleton,
+    const BodyNodePtr& bodyNode,
+    const CollisionTestableFactory& createCollisionTestable,
+    RNG* rng,
+    std::size_t numWorkers)
+{
+  auto skeleton = metaSkeleton->getDof(0)->getSkeleton();
+  auto rngs = common::cloneRNGsFrom(*rng, numWorkers);
+
+  std::vector<PlanningWorker> workers(numWorkers);
+  for (std::size_t i = 0; i < numWorkers; ++i)
+  {
+    auto& worker = workers[i];
+
+    {
+      std::lock_guard<std::mutex> lock(skeleton->getMutex());
+#if DART_VERSION_AT_LEAST(6, 7, 0)
+      worker.mSkeleton = skeleton->cloneSkeleton();
+#else
+      worker.mSkeleton = skeleton->clone();
+#endif
+      worker.mSkeleton->setConfiguration(skeleton->getConfiguration());
+    }
+
+    std::vector<DegreeOfFreedom*> dofs;
+    dofs.reserve(metaSkeleton->getNumDofs());
+    for (std::size_t j = 0; j < metaSkeleton->getNumDofs(); ++j)
+    {
+      dofs.emplace_back(
+          worker.mSkeleton->getDof(metaSkeleton->getDof(j)->getName()));
+    }
+
+    worker.mMetaSkeleton = Group::create(metaSkeleton->getName(), dofs);
+    worker.mStateSpace = std::make_shared<MetaSkeletonStateSpace>(
+        worker.mMetaSkeleton.get());
+    worker.mBodyNode = worker.mSkeleton->getBodyNode(bodyNode->getName());
+    worker.mRng = std::move(rngs[i]);
+
+    if (createCollisionTestable)
+    {
+      worker.mCollisionTestable
+          = createCollisionTestable(worker.mStateSpace, worker.mMetaSkeleton);
+      if (!worker.mCollisionTestable)
+        throw std::invalid_argument("Worker collision constraint is nullptr.");
+    }
+  }
+
+  return workers;
+}
+
+//==============================================================================
+/// Samples up to \c numSamples IK solutions for \c tsr on the robot copy of
+/// \c worker, and returns their positions.
+std::vector<Eigen::VectorXd> sampleIkSolutions(
+    PlanningWorker& worker,
+    const TSR& tsr,
+    std::size_t maxNumTrials,
+    std::size_t numSamples)
+{
+  auto ik = InverseKinematics::create(worker.mBodyNode);
+  ik->setDofs(worker.mMetaSkeleton->getDofs());
+
+  auto workerTsr = std::make_shared<TSR>(tsr);
+  workerTsr->setRNG(cloneRNGFrom(*worker.mRng));
+
+  InverseKinematicsSampleable ikSampleable(
+      worker.mStateSpace,
+      worker.mMetaSkeleton,
+      workerTsr,
+      createSampleableBounds(worker.mStateSpace, cloneRNGFrom(*worker.mRng)),
+      ik,
+      static_cast<int>(maxNumTrials));
+  auto generator = ikSampleable.createSampleGenerator();
+
+  auto state = worker.mStateSpace->createState();
+  std::vector<Eigen::VectorXd> solutions;
+  for (std::size_t i = 0; i < numSamples && generator->canSample(); ++i)
+  {
+    if (!generator->sample(state))
+      continue;
+
+    solutions.emplace_back();
+    worker.mStateSpace->convertStateToPositions(state, solutions.back());
+  }
+
+  return solutions;
+}
+
+//==============================================================================
+/// Returns a copy of \c trajectory, which is defined on the state space of a
+/// worker's robot copy, defined on \c space instead.
+InterpolatedPtr convertToStateSpace(
+    const Interpolated& trajectory, const MetaSkeletonStateSpacePtr& space)
+{
+  const auto trajectorySpace
+      = std::static_pointer_cast<const MetaSkeletonStateSpace>(
+          trajectory.getStateSpace());
+
+  auto converted = std::make_shared<Interpolated>(
+      space, std::make_shared<GeodesicInterpolator>(space));
+
+  Eigen::VectorXd positions;
+  auto state = space->createState();
+  for (std::size_t i = 0; i < trajectory.getNumWaypoints(); ++i)
+  {
+    trajectorySpace->convertStateToPositions(
+        static_cast<const MetaSkeletonStateSpace::State*>(
+            trajectory.getWaypoint(i)),
+        positions);
+    space->convertPositionsToState(positions, state);
+    converted->addWaypoint(trajectory.getWaypointTime(i), state);
+  }
+
+  return converted;
+}
+
+//==============================================================================
+/// Returns the snap plan from \c start to the best-ranked of \c goals to
+/// which it is collision-free, checking the goals concurrently. \c goals are
+/// positions in ranked order.
+InterpolatedPtr planSnapInParallel(
+    std::vector<PlanningWorker>& workers,
+    common::ThreadPool& threadPool,
+    const Eigen::VectorXd& start,
+    const std::vector<Eigen::VectorXd>& goals)
+{
+  // Goals are handed out in ranked order; a worker stops once a better-ranked
+  // goal than the next one it would check has succeeded.
+  std::atomic<std::size_t> nextGoal{0};
+  std::atomic<std::size_t> firstSuccess{goals.size()};
+  std::vector<TrajectoryPtr> trajectories(goals.size());
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(workers.size());
+  for (auto& worker : workers)
+  {
+    futures.emplace_back(threadPool.submit([&]() {
+      const auto& space = worker.mStateSpace;
+      auto snapPlanner
+          = std::make_shared<SnapConfigurationToConfigurationPlanner>(
+              space, std::make_shared<GeodesicInterpolator>(space));
+      SnapConfigurationToConfigurationPlanner::Result pResult;
+
+      auto startState = space->createState();
+      auto goalState = space->createState();
+      space->convertPositionsToState(start, startState);
+
+      while (true)
+      {
+        const std::size_t i = nextGoal++;
+        if (i >= firstSuccess.load())
+          return;
+
+        space->convertPositionsToState(goals[i], goalState);
+        auto problem = ConfigurationToConfiguration(
+            space, startState, goalState, worker.mCollisionTestable);
+
+        trajectories[i] = snapPlanner->plan(problem, &pResult);
+        if (!trajectories[i])
+          continue;
+
+        auto current = firstSuccess.load();
+        while (i < current && !firstSuccess.compare_exchange_weak(current, i))
+          continue;
+        return;
+      }
+    }));
+  }
+
+  // Wait for every task before rethrowing any exception, since the tasks
+  // reference local variables.
+  for (auto& future : futures)
+    future.wait();
+  for (auto& future : futures)
+    future.get();
+
+  if (firstSuccess.load() == goals.size())
+    return nullptr;
+
+  return std::static_pointer_cast<Interpolated>(
+      trajectories[firstSuccess.load()]);
+}
+
+//==============================================================================
+/// Races RRTConnect plans from \c start to each of \c goals, one per worker,
+/// and returns the first solution found.
+InterpolatedPtr planRRTConnectInParallel(
+    std::vector<PlanningWorker>& workers,
+    common::ThreadPool& threadPool,
+    const Eigen::VectorXd& start,
+    const std::vector<Eigen::VectorXd>& goals,
+    double timelimit)
+{
+  using planner::ompl::GeometricStateSpace;
+
+  const std::size_t numGoals = std::min(workers.size(), goals.size());
+
+  std::atomic<bool> isSolved{false};
+  InterpolatedPtr solution;
+  std::mutex solutionMutex;
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(numGoals);
+  for (std::size_t i = 0; i < numGoals; ++i)
+  {
+    futures.emplace_back(threadPool.submit([&, i]() {
+      auto& worker = workers[i];
+      const auto& space = worker.mStateSpace;
+      auto interpolator = std::make_shared<GeodesicInterpolator>(space);
+
+      auto si = planner::ompl::getSpaceInformation(
+          space,
+          interpolator,
+          createDistanceMetric(space),
+          createSampleableBounds(space, cloneRNGFrom(*worker.mRng)),
+          worker.mCollisionTestable,
+          createTestableBounds(space),
+          createProjectableBounds(space),
+          0.1);
+
+      auto startState = space->createState();
+      auto goalState = space->createState();
+      space->convertPositionsToState(start, startState);
+      space->convertPositionsToState(goals[i], goalState);
+
+      // ProblemDefinition clones states and keeps them internally
+      auto pdef = planner::ompl::ompl_make_shared<
+          ::ompl::base::ProblemDefinition>(si);
+      auto sspace = planner::ompl::ompl_static_pointer_cast<
+          GeometricStateSpace>(si->getStateSpace());
+      auto omplStart = sspace->allocState(startState);
+      auto omplGoal = sspace->allocState(goalState);
+      pdef->setStartAndGoalStates(omplStart, omplGoal);
+      sspace->freeState(omplStart);
+      sspace->freeState(omplGoal);
+
+      auto rrtConnect
+          = planner::ompl::ompl_make_shared<::ompl::geometric::RRTConnect>(
+              si);
+      auto ptc = ::ompl::base::plannerOrTerminationCondition(
+          ::ompl::base::timedPlannerTerminationCondition(timelimit),
+          ::ompl::base::PlannerTerminationCondition(
+              [&isSolved]() { return isSolved.load(); }));
+
+      auto trajectory = planner::ompl::planOMPL(
+          rrtConnect, pdef, space, std::move(interpolator), ptc);
+      if (!trajectory || isSolved.exchange(true))
+        return;
+
+      std::lock_guard<std::mutex> lock(solutionMutex);
+      solution = std::move(trajectory);
+    }));
+  }
+
+  // Wait for every task before rethrowing any exception, since the tasks
+  // reference local variables.
+  for (auto& future : futures)
+    future.wait();
+  for (auto& future : futures)
+    future.get();
+
+  return solution;
+}
+
+//==============================================================================
+/// Plans from \c startState to each of the ranked \c configurations in
+/// turn, first with the snap planner and then with planToConfiguration, and
+/// returns the first trajectory found.
+trajectory::TrajectoryPtr planToRankedConfigurations(
+    const MetaSkeletonStateSpacePtr& space,
+    const MetaSkeletonPtr& metaSkeleton,
+    const StateSpace::State* startState,
+    const std::vector<MetaSkeletonStateSpace::ScopedState>& configurations,
+    const TestablePtr& collisionTestable,
+    RNG* rng,
+    double timelimit,
+    std::size_t maxNumTrials)
+{
+  // Save the current state of the space
+  auto saver = MetaSkeletonStateSaver(metaSkeleton);
+  DART_UNUSED(saver);
+
+  // HACK: try lots of snap plans first
+  auto snapPlanner = std::make_shared<SnapConfigurationToConfigurationPlanner>(
+      space, std::make_shared<GeodesicInterpolator>(space));
+  SnapConfigurationToConfigurationPlanner::Result pResult;
+
+  for (const auto& configuration : configurations)
+  {
+    auto problem = ConfigurationToConfiguration(
+        space, startState, configuration, collisionTestable);
+    if (auto traj = snapPlanner->plan(problem, &pResult))
+      return traj;
+  }
+
+  // TODO: Change this to timelimit once we use a fail-fast planner
+  const double timelimitPerSample = timelimit / maxNumTrials;
+
+  // Start the timer
+  dart::common::Timer timer;
+  timer.start();
+  for (const auto& configuration : configurations)
+  {
+    // planToConfiguration plans from the current state of metaSkeleton, which
+    // the collision checks may have changed.
+    space->setState(metaSkeleton.get(), startState);
+
+    auto traj = planToConfiguration(
+        space,
+        metaSkeleton,
+        configuration,
+        collisionTestable,
+        rng,
+        std::min(timelimitPerSample, timelimit - timer.getElapsedTime()));
+
+    if (traj)
+      return traj;
+  }
+  return nullptr;
+}
+
+//==============================================================================
+/// Returns a thread pool with at least \c numThreads threads. The pool is
+/// shared by every call, so that repeated parallel queries do not start and
+/// join their own threads.
+std::shared_ptr<common::ThreadPool> getThreadPool(std::size_t numThreads)
+{
+  static std::mutex mutex;
+  static std::shared_ptr<common::ThreadPool> threadPool;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!threadPool || threadPool->getNumThreads() < numThreads)
+    threadPool = std::make_shared<common::ThreadPool>(numThreads);
+
+  return threadPool;
+}
+
+//==============================================================================
+trajectory::TrajectoryPtr planToTSRInParallel(
+    const MetaSkeletonStateSpacePtr& space,
+    const MetaSkeletonPtr& metaSkeleton,
+    const BodyNodePtr& bn,
+    const TSRPtr& tsr,
+    const TestablePtr& collisionTestable,
+    RNG* rng,
+    double timelimit,
+    std::size_t maxNumTrials,
+    const distance::ConstConfigurationRankerPtr& ranker,
+    std::size_t numThreads,
+    const CollisionTestableFactory& createWorkerCollisionTestable)
+{
+  auto workers = createPlanningWorkers(
+      metaSkeleton, bn, createWorkerCollisionTestable, rng, numThreads);
+  const auto threadPool = getThreadPool(numThreads);
+
+  // Split the IK samples evenly between the workers.
+  std::vector<std::future<std::vector<Eigen::VectorXd>>> sampleFutures;
+  sampleFutures.reserve(numThreads);
+  for (std::size_t i = 0; i < numThreads; ++i)
+  {
+    const std::size_t numSamples
+        = maxSnapSamples / numThreads
+          + (i < maxSnapSamples % numThreads ? 1 : 0);
+
+    auto& worker = workers[i];
+    sampleFutures.emplace_back(threadPool->submit([&, numSamples]() {
+      return sampleIkSolutions(worker, *tsr, maxNumTrials, numSamples);
+    }));
+  }
+
+  std::vector<MetaSkeletonStateSpace::ScopedState> configurations;
+  for (auto& future : sampleFutures)
+  {
+    for (const auto& positions : future.get())
+    {
+      configurations.emplace_back(space->createState());
+      space->convertPositionsToState(positions, configurations.back());
+    }
+  }
+
+  if (configurations.empty())
+    return nullptr;
+
+  auto startState = space->getScopedStateFromMetaSkeleton(metaSkeleton.get());
+
+  ConstConfigurationRankerPtr configurationRanker(ranker);
+  if (!ranker)
+  {
+    configurationRanker = std::make_shared<const NominalConfigurationRanker>(
+        space, metaSkeleton, startState);
+  }
+  configurationRanker->rankConfigurations(configurations);
+
+  if (!createWorkerCollisionTestable)
+  {
+    // The caller's constraint is not thread-safe, so plan one goal at a time.
+    return planToRankedConfigurations(
+        space,
+        metaSkeleton,
+        startState,
+        configurations,
+        collisionTestable,
+        rng,
+        timelimit,
+        maxNumTrials);
+  }
+
+  Eigen::VectorXd start;
+  space->convertStateToPositions(startState, start);
+
+  std::vector<Eigen::VectorXd> goals(configurations.size());
+  for (std::size_t i = 0; i < configurations.size(); ++i)
+    space->convertStateToPositions(configurations[i], goals[i]);
+
+  if (auto traj = planSnapInParallel(workers, *threadPool, start, goals))
+    return convertToStateSpace(*traj, space);
+
+  if (auto traj = planRRTConnectInParallel(
+          workers, *threadPool, start, goals, timelimit))
+    return convertToStateSpace(*traj, space);
+
+  return nullptr;
+}
+
+//==============================================================================
+/// Creates the constraints each thread of planToTSRwithTrajectoryConstraint
+/// extends the CRRTConnect trees with. The constraints are defined on the
+/// planning StateSpace \c space but act on the robot copy of each worker.
+std::vector<planner::ompl::CRRT::WorkerConstraints> createCRRTWorkerConstraints(
+    const MetaSkeletonStateSpacePtr& space,
+    const std::vector<PlanningWorker>& workers,
+    const TSR& constraintTsr,
+    const TSR& goalTsr,
+    const CollisionTestableFactory& createCollisionTestable,
+    const CRRTPlannerParameters& crrtParameters)
+{
+  using constraint::NewtonsMethodProjectable;
+  using constraint::dart::FrameDifferentiable;
+  using constraint::dart::FrameTestable;
+
+  std::vector<planner::ompl::CRRT::WorkerConstraints> constraints(
+      workers.size());
+  for (std::size_t i = 0; i < workers.size(); ++i)
+  {
+    const auto& worker = workers[i];
+    auto& workerConstraints = constraints[i];
+
+    workerConstraints.validityConstraint
+        = createCollisionTestable(space, worker.mMetaSkeleton);
+
+    auto frameDiff = std::make_shared<FrameDifferentiable>(
+        space,
+        worker.mMetaSkeleton,
+        worker.mBodyNode.get(),
+        std::make_shared<TSR>(constraintTsr));
+    std::vector<double> projectionTolerances(
+        frameDiff->getConstraintDimension(),
+        crrtParameters.projectionTolerance);
+    workerConstraints.pathConstraint
+        = std::make_shared<NewtonsMethodProjectable>(
+            frameDiff,
+            projectionTolerances,
+            crrtParameters.projectionMaxIteration);
+
+    workerConstraints.goalTestable = std::make_shared<FrameTestable>(
+        space,
+        worker.mMetaSkeleton,
+        worker.mBodyNode.get(),
+        std::make_shared<TSR>(goalTsr));
+
+    auto ik = InverseKinematics::create(worker.mBodyNode);
+    ik->setDofs(worker.mMetaSkeleton->getDofs());
+
+    auto workerTsr = std::make_shared<TSR>(constraintTsr);
+    workerTsr->setRNG(cloneRNGFrom(*worker.mRng));
+    workerConstraints.sampler = std::make_shared<InverseKinematicsSampleable>(
+        space,
+        worker.mMetaSkeleton,
+        workerTsr,
+        createSampleableBounds(space, cloneRNGFrom(*worker.mRng)),
+        ik,
+        crrtParameters.maxNumTrials);
+  }
+
+  return constraints;
+}
+
+} // namespace
+
 //==============================================================================
 trajectory::TrajectoryPtr planToTSR(
     const MetaSkeletonStateSpacePtr& space,
@@ -173,7 +684,9 @@ trajectory::TrajectoryPtr planToTSR(
     RNG* rng,
     double timelimit,
     std::size_t maxNumTrials,
-    const distance::ConstConfigurationRankerPtr& ranker)
+    const distance::ConstConfigurationRankerPtr& ranker,
+    std::size_t numThreads,
+    const CollisionTestableFactory& createWorkerCollisionTestable)
 {
   // Create an IK solver with metaSkeleton dofs.
   auto ik = InverseKinematics::create(bn);
@@ -189,6 +702,25 @@ trajectory::TrajectoryPtr planToTSR(
       throw std::invalid_argument("MetaSkeleton has more than 1 skeleton.");
   }
 
+  if (numThreads == 0)
+    throw std::invalid_argument("Number of threads must be positive.");
+
+  if (numThreads > 1)
+  {
+    return planToTSRInParallel(
+        space,
+        metaSkeleton,
+        bn,
+        tsr,
+        collisionTestable,
+        rng,
+        timelimit,
+        maxNumTrials,
+        ranker,
+        numThreads,
+        createWorkerCollisionTestable);
+  }
+
   ik->setDofs(metaSkeleton->getDofs());
 
   // Convert TSR constraint into IK constraint
@@ -207,21 +739,9 @@ trajectory::TrajectoryPtr planToTSR(
 
   auto startState = space->getScopedStateFromMetaSkeleton(metaSkeleton.get());
 
-  // TODO: Change this to timelimit once we use a fail-fast planner
-  double timelimitPerSample = timelimit / maxNumTrials;
-
-  // Save the current state of the space
-  auto saver = MetaSkeletonStateSaver(metaSkeleton);
-  DART_UNUSED(saver);
-
-  // HACK: try lots of snap plans first
-  static const std::size_t maxSnapSamples{100};
   std::size_t snapSamples = 0;
 
   auto robot = metaSkeleton->getBodyNode(0)->getSkeleton();
-  SnapConfigurationToConfigurationPlanner::Result pResult;
-  auto snapPlanner = std::make_shared<SnapConfigurationToConfigurationPlanner>(
-      space, std::make_shared<GeodesicInterpolator>(space));
 
   std::vector<MetaSkeletonStateSpace::ScopedState> configurations;
 
@@ -235,20 +755,26 @@ trajectory::TrajectoryPtr planToTSR(
         space, metaSkeleton, nominalState);
   }
 
-  while (snapSamples < maxSnapSamples && generator->canSample())
   {
-    // Sample from TSR
-    std::lock_guard<std::mutex> lock(robot->getMutex());
-    bool sampled = generator->sample(goalState);
+    // Sampling moves the robot, so restore its state afterwards.
+    auto saver = MetaSkeletonStateSaver(metaSkeleton);
+    DART_UNUSED(saver);
 
-    // Increment even if it's not a valid sample since this loop
-    // has to terminate even if none are valid.
-    ++snapSamples;
+    while (snapSamples < maxSnapSamples && generator->canSample())
+    {
+      // Sample from TSR
+      std::lock_guard<std::mutex> lock(robot->getMutex());
+      bool sampled = generator->sample(goalState);
 
-    if (!sampled)
-      continue;
+      // Increment even if it's not a valid sample since this loop
+      // has to terminate even if none are valid.
+      ++snapSamples;
 
-    configurations.emplace_back(goalState.clone());
+      if (!sampled)
+        continue;
+
+      configurations.emplace_back(goalState.clone());
+    }
   }
 
   if (configurations.empty())
@@ -256,38 +782,15 @@ trajectory::TrajectoryPtr planToTSR(
 
   configurationRanker->rankConfigurations(configurations);
 
-  // Try snap planner first
-  for (std::size_t i = 0; i < configurations.size(); ++i)
-  {
-    auto problem = ConfigurationToConfiguration(
-        space, startState, configurations[i], collisionTestable);
-
-    auto traj = snapPlanner->plan(problem, &pResult);
-
-    if (traj)
-      return traj;
-  }
-
-  // Start the timer
-  dart::common::Timer timer;
-  timer.start();
-  for (std::size_t i = 0; i < configurations.size(); ++i)
-  {
-    auto problem = ConfigurationToConfiguration(
-        space, startState, configurations[i], collisionTestable);
-
-    auto traj = planToConfiguration(
-        space,
-        metaSkeleton,
-        goalState,
-        collisionTestable,
-        rng,
-        std::min(timelimitPerSample, timelimit - timer.getElapsedTime()));
-
-    if (traj)
-      return traj;
-  }
-  return nullptr;
+  return planToRankedConfigurations(
+      space,
+      metaSkeleton,
+      startState,
+      configurations,
+      collisionTestable,
+      rng,
+      timelimit,
+      maxNumTrials);
 }
 
 //==============================================================================
@@ -299,7 +802,9 @@ InterpolatedPtr planToTSRwithTrajectoryConstraint(
     const TSRPtr& constraintTsr,
     const TestablePtr& collisionTestable,
     double timelimit,
-    const CRRTPlannerParameters& crrtParameters)
+    const CRRTPlannerParameters& crrtParameters,
+    std::size_t numThreads,
+    const CollisionTestableFactory& createWorkerCollisionTestable)
 {
   using aikido::constraint::CyclicSampleable;
   using aikido::constraint::NewtonsMethodProjectable;
@@ -309,9 +814,35 @@ InterpolatedPtr planToTSRwithTrajectoryConstraint(
   using aikido::constraint::dart::InverseKinematicsSampleable;
   using aikido::planner::ompl::planCRRTConnect;
 
+  if (numThreads == 0)
+    throw std::invalid_argument("Number of threads must be positive.");
+
   std::size_t projectionMaxIteration = crrtParameters.projectionMaxIteration;
   double projectionTolerance = crrtParameters.projectionTolerance;
 
+  // The robot copies are made before locking the robot, since cloning it
+  // locks it as well.
+  std::vector<planner::ompl::CRRT::WorkerConstraints> workerConstraints;
+  if (numThreads > 1 && createWorkerCollisionTestable)
+  {
+    if (metaSkeleton->getNumDofs() == 0)
+      throw std::invalid_argument("MetaSkeleton has 0 degrees of freedom.");
+
+    auto workers = createPlanningWorkers(
+        metaSkeleton,
+        bodyNode,
+        nullptr,
+        crrtParameters.rng,
+        numThreads);
+    workerConstraints = createCRRTWorkerConstraints(
+        space,
+        workers,
+        *constraintTsr,
+        *goalTsr,
+        createWorkerCollisionTestable,
+        crrtParameters);
+  }
+
   auto robot = metaSkeleton->getBodyNode(0)->getSkeleton();
   std::lock_guard<std::mutex> lock(robot->getMutex());
 
@@ -390,7 +921,8 @@ InterpolatedPtr planToTSRwithTrajectoryConstraint(
       crrtParameters.maxExtensionDistance,
       crrtParameters.maxDistanceBtwProjections,
       crrtParameters.minStepSize,
-      crrtParameters.minTreeConnectionDistance);
+      crrtParameters.minTreeConnectionDistance,
+      std::move(workerConstraints));
 
   return traj;
 }
@@ -2,6 +2,9 @@
 
 #include <iostream>
 
+#include "aikido/statespace/Rn.hpp"
+#include "aikido/statespace/SO2.hpp"
+
 namespace aikido {
 namespace statespace {
 
@@ -10,11 +13,25 @@ CartesianProduct::CartesianProduct(std::vector<ConstStateSpacePtr> _subspaces)
   : mSubspaces(std::move(_subspaces))
   , mOffsets(mSubspaces.size(), 0u)
   , mSizeInBytes(0u)
+  , mDimension(0u)
+  , mIsPacked(true)
 {
+  static_assert(
+      sizeof(SO2::State) == sizeof(double),
+      "SO2::State is expected to hold a single double.");
+
   for (const auto& subspace : mSubspaces)
   {
     if (subspace == nullptr)
       throw std::invalid_argument("Subspace is null.");
+
+    // Derived classes of SO2 are assumed not to change the group operations.
+    if (dynamic_cast<const SO2*>(subspace.get()))
+      mPackedAngleIndices.push_back(mDimension);
+    else if (!isRealVectorSpace(subspace.get()))
+      mIsPacked = false;
+
+    mDimension += subspace->getDimension();
   }
 
   if (!mSubspaces.empty())
@@ -48,6 +65,18 @@ std::size_t CartesianProduct::getNumSubspaces() const
   return mSubspaces.size();
 }
 
+//==============================================================================
+bool CartesianProduct::isPacked() const
+{
+  return mIsPacked;
+}
+
+//==============================================================================
+std::size_t CartesianProduct::getSubStateOffset(std::size_t _index) const
+{
+  return mOffsets.at(_index);
+}
+
 //==============================================================================
 std::size_t CartesianProduct::getStateSizeInBytes() const
 {
@@ -84,6 +113,14 @@ void CartesianProduct::compose(
   if (_state1 == _out || _state2 == _out)
     throw std::invalid_argument("Output aliases input.");
 
+  if (mIsPacked)
+  {
+    getPackedValues(_out)
+        = getPackedValues(_state1) + getPackedValues(_state2);
+    wrapPackedAngles(_out);
+    return;
+  }
+
   auto state1 = static_cast<const State*>(_state1);
   auto state2 = static_cast<const State*>(_state2);
   auto out = static_cast<State*>(_out);
@@ -100,6 +137,12 @@ void CartesianProduct::compose(
 //==============================================================================
 void CartesianProduct::getIdentity(StateSpace::State* _out) const
 {
+  if (mIsPacked)
+  {
+    getPackedValues(_out).setZero();
+    return;
+  }
+
   auto state = static_cast<State*>(_out);
 
   for (std::size_t i = 0; i < mSubspaces.size(); ++i)
@@ -116,6 +159,13 @@ void CartesianProduct::getInverse(
   if (_out == _in)
     throw std::invalid_argument("Output aliases input.");
 
+  if (mIsPacked)
+  {
+    getPackedValues(_out) = -getPackedValues(_in);
+    wrapPackedAngles(_out);
+    return;
+  }
+
   auto in = static_cast<const State*>(_in);
   auto out = static_cast<State*>(_out);
 
@@ -128,18 +178,19 @@ void CartesianProduct::getInverse(
 //==============================================================================
 std::size_t CartesianProduct::getDimension() const
 {
-  std::size_t dim = 0;
-  for (auto const& sspace : mSubspaces)
-  {
-    dim += sspace->getDimension();
-  }
-  return dim;
+  return mDimension;
 }
 
 //==============================================================================
 void CartesianProduct::copyState(
     const StateSpace::State* _source, StateSpace::State* _destination) const
 {
+  if (mIsPacked)
+  {
+    getPackedValues(_destination) = getPackedValues(_source);
+    return;
+  }
+
   auto destination = static_cast<State*>(_destination);
   auto source = static_cast<const State*>(_source);
   for (std::size_t i = 0; i < mSubspaces.size(); ++i)
@@ -165,6 +216,13 @@ void CartesianProduct::expMap(
     throw std::runtime_error(msg.str());
   }
 
+  if (mIsPacked)
+  {
+    getPackedValues(_out) = _tangent;
+    wrapPackedAngles(_out);
+    return;
+  }
+
   int index = 0;
   for (std::size_t i = 0; i < mSubspaces.size(); ++i)
   {
@@ -186,13 +244,21 @@ void CartesianProduct::logMap(
     _tangent.resize(dimension);
   }
 
+  if (mIsPacked)
+  {
+    _tangent = getPackedValues(_in);
+    return;
+  }
+
   auto in = static_cast<const State*>(_in);
 
+  // Subspaces take an Eigen::VectorXd, so reuse one buffer for all of them.
+  Eigen::VectorXd segment;
+
   int index = 0;
   for (std::size_t i = 0; i < mSubspaces.size(); ++i)
   {
     auto dim = mSubspaces[i]->getDimension();
-    Eigen::VectorXd segment(dim);
     mSubspaces[i]->logMap(getSubState<>(in, i), segment);
 
     _tangent.segment(index, dim) = segment;
@@ -215,5 +281,33 @@ void CartesianProduct::print(
   }
 }
 
+//==============================================================================
+Eigen::Map<Eigen::VectorXd> CartesianProduct::getPackedValues(
+    StateSpace::State* _state) const
+{
+  return Eigen::Map<Eigen::VectorXd>(
+      reinterpret_cast<double*>(_state), mDimension);
+}
+
+//==============================================================================
+Eigen::Map<const Eigen::VectorXd> CartesianProduct::getPackedValues(
+    const StateSpace::State* _state) const
+{
+  return Eigen::Map<const Eigen::VectorXd>(
+      reinterpret_cast<const double*>(_state), mDimension);
+}
+
+//==============================================================================
+void CartesianProduct::wrapPackedAngles(StateSpace::State* _state) const
+{
+  auto values = reinterpret_cast<double*>(_state);
+
+  for (const auto index : mPackedAngleIndices)
+  {
+    auto angleState = reinterpret_cast<SO2::State*>(values + index);
+    angleState->fromAngle(values[index]);
+  }
+}
+
 } // namespace statespace
 } // namespace aikido
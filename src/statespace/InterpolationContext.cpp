@@ -0,0 +1,136 @@
+#include "aikido/statespace/InterpolationContext.hpp"
+
+namespace aikido {
+namespace statespace {
+
+//==============================================================================
+InterpolationContext::InterpolationContext(ConstInterpolatorPtr interpolator)
+  : mInterpolator(std::move(interpolator))
+  , mIsGeodesic(false)
+  , mFrom(nullptr)
+  , mTo(nullptr)
+  , mInverseState(nullptr)
+  , mRelativeState(nullptr)
+{
+  if (!mInterpolator)
+    throw std::invalid_argument("Interpolator is null.");
+
+  mStateSpace = mInterpolator->getStateSpace();
+  mIsGeodesic = static_cast<bool>(
+      std::dynamic_pointer_cast<const GeodesicInterpolator>(mInterpolator));
+
+  if (!mIsGeodesic)
+    return;
+
+  mTangent.resize(mStateSpace->getDimension());
+  mScaledTangent.resize(mStateSpace->getDimension());
+  mInverseState = mStateSpace->allocateState();
+  mRelativeState = mStateSpace->allocateState();
+
+  // Packed products already apply the group operations to the whole state at
+  // once, so only split the tangent of products that dispatch per subspace.
+  auto cartesianProduct
+      = std::dynamic_pointer_cast<const CartesianProduct>(mStateSpace);
+  if (!cartesianProduct || cartesianProduct->isPacked())
+    return;
+
+  mCartesianProduct = std::move(cartesianProduct);
+
+  const auto numSubspaces = mCartesianProduct->getNumSubspaces();
+  mSubspaces.reserve(numSubspaces);
+  mSubspaceTangents.reserve(numSubspaces);
+  mScaledSubspaceTangents.reserve(numSubspaces);
+
+  for (std::size_t i = 0; i < numSubspaces; ++i)
+  {
+    mSubspaces.emplace_back(mCartesianProduct->getSubspace<>(i));
+
+    const auto dimension = mSubspaces.back()->getDimension();
+    mSubspaceTangents.emplace_back(dimension);
+    mScaledSubspaceTangents.emplace_back(dimension);
+  }
+}
+
+//==============================================================================
+InterpolationContext::~InterpolationContext()
+{
+  if (mInverseState)
+    mStateSpace->freeState(mInverseState);
+
+  if (mRelativeState)
+    mStateSpace->freeState(mRelativeState);
+}
+
+//==============================================================================
+ConstInterpolatorPtr InterpolationContext::getInterpolator() const
+{
+  return mInterpolator;
+}
+
+//==============================================================================
+void InterpolationContext::setEndpoints(
+    const StateSpace::State* from, const StateSpace::State* to)
+{
+  mFrom = from;
+  mTo = to;
+
+  if (!mIsGeodesic)
+    return;
+
+  // Same as GeodesicInterpolator::getTangentVector(), but using the scratch
+  // states owned by this context.
+  mStateSpace->getInverse(mFrom, mInverseState);
+  mStateSpace->compose(mInverseState, mTo, mRelativeState);
+  mStateSpace->logMap(mRelativeState, mTangent);
+
+  Eigen::Index index = 0;
+  for (std::size_t i = 0; i < mSubspaces.size(); ++i)
+  {
+    const auto dimension = mSubspaceTangents[i].size();
+    mSubspaceTangents[i] = mTangent.segment(index, dimension);
+    index += dimension;
+  }
+}
+
+//==============================================================================
+void InterpolationContext::interpolate(double alpha, StateSpace::State* out)
+{
+  if (!mFrom || !mTo)
+    throw std::logic_error("Endpoints have not been set.");
+
+  if (!mIsGeodesic)
+  {
+    mInterpolator->interpolate(mFrom, mTo, alpha, out);
+    return;
+  }
+
+  if (!mCartesianProduct)
+  {
+    mScaledTangent.noalias() = alpha * mTangent;
+    mStateSpace->expMap(mScaledTangent, mRelativeState);
+    mStateSpace->compose(mFrom, mRelativeState, out);
+    return;
+  }
+
+  // CartesianProduct::expMap() copies each block of the tangent into a
+  // temporary vector, so apply the group operations per subspace instead.
+  using CompoundState = CartesianProduct::State;
+  const auto from = static_cast<const CompoundState*>(mFrom);
+  const auto relative = static_cast<CompoundState*>(mRelativeState);
+  const auto compoundOut = static_cast<CompoundState*>(out);
+
+  for (std::size_t i = 0; i < mSubspaces.size(); ++i)
+  {
+    auto relativeSubState = mCartesianProduct->getSubState<>(relative, i);
+
+    mScaledSubspaceTangents[i].noalias() = alpha * mSubspaceTangents[i];
+    mSubspaces[i]->expMap(mScaledSubspaceTangents[i], relativeSubState);
+    mSubspaces[i]->compose(
+        mCartesianProduct->getSubState<>(from, i),
+        relativeSubState,
+        mCartesianProduct->getSubState<>(compoundOut, i));
+  }
+}
+
+} // namespace statespace
+} // namespace aikido
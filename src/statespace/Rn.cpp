@@ -15,5 +15,13 @@ template class R<6>;
 
 template class R<Eigen::Dynamic>;
 
+//==============================================================================
+bool isRealVectorSpace(const StateSpace* _space)
+{
+  return dynamic_cast<const R0*>(_space) || dynamic_cast<const R1*>(_space)
+         || dynamic_cast<const R2*>(_space) || dynamic_cast<const R3*>(_space)
+         || dynamic_cast<const R6*>(_space) || dynamic_cast<const Rn*>(_space);
+}
+
 } // namespace statespace
 } // namespace aikido
@@ -3,6 +3,19 @@
 namespace aikido {
 namespace statespace {
 
+//==============================================================================
+StateSpace::StateSpace(const StateSpace& /*other*/)
+{
+  // Do nothing. Each space owns the memory of the states it allocates.
+}
+
+//==============================================================================
+StateSpace& StateSpace::operator=(const StateSpace& /*other*/)
+{
+  // Do nothing. Each space owns the memory of the states it allocates.
+  return *this;
+}
+
 //==============================================================================
 auto StateSpace::createState() const -> ScopedState
 {
@@ -38,13 +51,23 @@ void StateSpace::getInverse(State* _state) const
 //==============================================================================
 auto StateSpace::allocateState() const -> State*
 {
-  return allocateStateInBuffer(new char[getStateSizeInBytes()]);
+  return allocateStateInBuffer(getStatePool().allocate());
 }
 
 //==============================================================================
 void StateSpace::freeState(StateSpace::State* _state) const
 {
-  delete[] reinterpret_cast<char*>(_state);
+  getStatePool().deallocate(_state);
+}
+
+//==============================================================================
+common::FixedSizePool& StateSpace::getStatePool() const
+{
+  std::call_once(mStatePoolFlag, [this]() {
+    mStatePool.reset(new common::FixedSizePool(getStateSizeInBytes()));
+  });
+
+  return *mStatePool;
 }
 
 } // namespace statespace
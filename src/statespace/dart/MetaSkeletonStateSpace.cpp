@@ -6,6 +6,8 @@
 #include <dart/common/Console.hpp>
 
 #include "aikido/common/memory.hpp"
+#include "aikido/statespace/Rn.hpp"
+#include "aikido/statespace/SO2.hpp"
 #include "aikido/statespace/dart/JointStateSpaceHelpers.hpp"
 
 namespace aikido {
@@ -92,9 +94,13 @@ MetaSkeletonStateSpace::Properties::Properties(
 {
   // TODO: Acquire the metaskeleton's mutex once DART supports it.
 
+  mJointDofOffsets.reserve(mNumJoints + 1);
+  mJointDofIndices.reserve(mDofNames.size());
+
   for (std::size_t ijoint = 0; ijoint < metaskeleton->getNumJoints(); ++ijoint)
   {
     const auto joint = metaskeleton->getJoint(ijoint);
+    mJointDofOffsets.push_back(mJointDofIndices.size());
 
     // FIXME: This duplicates some of the logic in createStateSpace above.
     for (std::size_t idof = 0; idof < joint->getNumDofs(); ++idof)
@@ -112,9 +118,11 @@ MetaSkeletonStateSpace::Properties::Properties(
       }
 
       mDofNames[dofIndex] = dofName;
-      mIndexMap[std::make_pair(ijoint, idof)] = dofIndex;
+      mJointDofIndices.push_back(dofIndex);
     }
   }
+
+  mJointDofOffsets.push_back(mJointDofIndices.size());
 }
 
 //==============================================================================
@@ -146,7 +154,31 @@ MetaSkeletonStateSpace::Properties::getDofNames() const
 std::size_t MetaSkeletonStateSpace::Properties::getDofIndex(
     std::size_t ijoint, std::size_t ijointdof) const
 {
-  return mIndexMap.at(std::make_pair(ijoint, ijointdof));
+  if (ijoint >= mNumJoints)
+    throw std::out_of_range("Joint index is out of range.");
+
+  const auto index = mJointDofOffsets[ijoint] + ijointdof;
+  if (index >= mJointDofOffsets[ijoint + 1])
+    throw std::out_of_range("Joint DOF index is out of range.");
+
+  return mJointDofIndices[index];
+}
+
+//==============================================================================
+const std::vector<std::size_t>&
+MetaSkeletonStateSpace::Properties::getJointDofIndices() const
+{
+  return mJointDofIndices;
+}
+
+//==============================================================================
+std::size_t MetaSkeletonStateSpace::Properties::getJointDofOffset(
+    std::size_t ijoint) const
+{
+  if (ijoint >= mNumJoints)
+    throw std::out_of_range("Joint index is out of range.");
+
+  return mJointDofOffsets[ijoint];
 }
 
 //==============================================================================
@@ -222,7 +254,10 @@ bool MetaSkeletonStateSpace::Properties::operator==(
   if (mDofNames != otherProperties.mDofNames)
     return false;
 
-  if (mIndexMap != otherProperties.mIndexMap)
+  if (mJointDofOffsets != otherProperties.mJointDofOffsets)
+    return false;
+
+  if (mJointDofIndices != otherProperties.mJointDofIndices)
     return false;
 
   for (std::size_t i = 0; i < mNumJoints; ++i)
@@ -254,7 +289,25 @@ MetaSkeletonStateSpace::MetaSkeletonStateSpace(const MetaSkeleton* metaskeleton)
             createStateSpace(*metaskeleton)))
   , mProperties(MetaSkeletonStateSpace::Properties(metaskeleton))
 {
-  // Do nothing.
+  mJointInfos.reserve(getNumSubspaces());
+
+  for (std::size_t isubspace = 0; isubspace < getNumSubspaces(); ++isubspace)
+  {
+    const auto subspace = getSubspace<JointStateSpace>(isubspace);
+
+    JointInfo info;
+    if (isRealVectorSpace(subspace.get()))
+      info.mLayout = JointLayout::RealVector;
+    else if (dynamic_cast<const SO2*>(subspace.get()))
+      info.mLayout = JointLayout::Angle;
+    else
+      info.mLayout = JointLayout::Generic;
+    info.mStateOffset = getSubStateOffset(isubspace);
+    info.mFirstDof = mProperties.getJointDofOffset(isubspace);
+    info.mNumDofs = subspace->getProperties().getNumDofs();
+    info.mSpace = subspace.get();
+    mJointInfos.push_back(info);
+  }
 }
 
 //==============================================================================
@@ -311,18 +364,39 @@ void MetaSkeletonStateSpace::convertPositionsToState(
   if (static_cast<std::size_t>(_positions.size()) != mProperties.getNumDofs())
     throw std::invalid_argument("Incorrect number of positions.");
 
-  for (std::size_t isubspace = 0; isubspace < getNumSubspaces(); ++isubspace)
+  const auto buffer = reinterpret_cast<char*>(_state);
+  const auto& jointDofIndices = mProperties.getJointDofIndices();
+  Eigen::VectorXd jointPositions;
+
+  for (const auto& info : mJointInfos)
   {
-    const auto subspace = getSubspace<JointStateSpace>(isubspace);
-    const auto numJointDofs = subspace->getProperties().getNumDofs();
+    const auto substate = buffer + info.mStateOffset;
+    const auto dofIndices = jointDofIndices.data() + info.mFirstDof;
+
+    switch (info.mLayout)
+    {
+      case JointLayout::RealVector:
+      {
+        const auto values = reinterpret_cast<double*>(substate);
+        for (std::size_t idof = 0; idof < info.mNumDofs; ++idof)
+          values[idof] = _positions[dofIndices[idof]];
+        break;
+      }
 
-    Eigen::VectorXd jointPositions(numJointDofs);
-    for (std::size_t idof = 0; idof < numJointDofs; ++idof)
-      jointPositions[idof]
-          = _positions[mProperties.getDofIndex(isubspace, idof)];
+      case JointLayout::Angle:
+        reinterpret_cast<SO2::State*>(substate)->fromAngle(
+            _positions[dofIndices[0]]);
+        break;
 
-    const auto substate = getSubState<>(_state, isubspace);
-    subspace->convertPositionsToState(jointPositions, substate);
+      case JointLayout::Generic:
+        jointPositions.resize(info.mNumDofs);
+        for (std::size_t idof = 0; idof < info.mNumDofs; ++idof)
+          jointPositions[idof] = _positions[dofIndices[idof]];
+
+        info.mSpace->convertPositionsToState(
+            jointPositions, reinterpret_cast<StateSpace::State*>(substate));
+        break;
+    }
   }
 }
 
@@ -332,18 +406,39 @@ void MetaSkeletonStateSpace::convertStateToPositions(
 {
   _positions.resize(mProperties.getNumDofs());
 
-  for (std::size_t isubspace = 0; isubspace < getNumSubspaces(); ++isubspace)
+  const auto buffer = reinterpret_cast<const char*>(_state);
+  const auto& jointDofIndices = mProperties.getJointDofIndices();
+  Eigen::VectorXd jointPositions;
+
+  for (const auto& info : mJointInfos)
   {
-    const auto subspace = getSubspace<JointStateSpace>(isubspace);
-    const auto numJointDofs = subspace->getProperties().getNumDofs();
-    const auto substate = getSubState<>(_state, isubspace);
+    const auto substate = buffer + info.mStateOffset;
+    const auto dofIndices = jointDofIndices.data() + info.mFirstDof;
 
-    Eigen::VectorXd jointPositions(numJointDofs);
-    subspace->convertStateToPositions(substate, jointPositions);
+    switch (info.mLayout)
+    {
+      case JointLayout::RealVector:
+      {
+        const auto values = reinterpret_cast<const double*>(substate);
+        for (std::size_t idof = 0; idof < info.mNumDofs; ++idof)
+          _positions[dofIndices[idof]] = values[idof];
+        break;
+      }
+
+      case JointLayout::Angle:
+        _positions[dofIndices[0]]
+            = reinterpret_cast<const SO2::State*>(substate)->toAngle();
+        break;
 
-    for (std::size_t idof = 0; idof < numJointDofs; ++idof)
-      _positions[mProperties.getDofIndex(isubspace, idof)]
-          = jointPositions[idof];
+      case JointLayout::Generic:
+        info.mSpace->convertStateToPositions(
+            reinterpret_cast<const StateSpace::State*>(substate),
+            jointPositions);
+
+        for (std::size_t idof = 0; idof < info.mNumDofs; ++idof)
+          _positions[dofIndices[idof]] = jointPositions[idof];
+        break;
+    }
   }
 }
 
@@ -1,5 +1,10 @@
 #include "aikido/trajectory/Interpolated.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+
 using aikido::statespace::GeodesicInterpolator;
 
 namespace aikido {
@@ -7,20 +12,70 @@ namespace trajectory {
 
 using State = aikido::statespace::StateSpace::State;
 
+namespace {
+
+//==============================================================================
+/// Rounds \c size up so that consecutive states in a buffer have the same
+/// alignment as memory returned by \c new.
+std::size_t roundUpToAlignment(std::size_t size)
+{
+  constexpr std::size_t alignment = alignof(std::max_align_t);
+  return std::max<std::size_t>(
+      ((size + alignment - 1) / alignment) * alignment, alignment);
+}
+
+} // namespace
+
 //==============================================================================
 Interpolated::Interpolated(
     statespace::ConstStateSpacePtr _stateSpace,
     statespace::ConstInterpolatorPtr _interpolator)
-  : mStateSpace(std::move(_stateSpace)), mInterpolator(std::move(_interpolator))
+  : mStateSpace(std::move(_stateSpace))
+  , mInterpolator(std::move(_interpolator))
+  , mStateStride(roundUpToAlignment(mStateSpace->getStateSizeInBytes()))
+  , mStateCapacity(0)
 {
   // Do nothing
 }
 
+//==============================================================================
+Interpolated::Interpolated(
+    statespace::ConstStateSpacePtr _stateSpace,
+    statespace::ConstInterpolatorPtr _interpolator,
+    const Eigen::VectorXd& _times,
+    const Eigen::MatrixXd& _positions)
+  : Interpolated(std::move(_stateSpace), std::move(_interpolator))
+{
+  if (_positions.cols() != _times.size())
+    throw std::invalid_argument(
+        "Number of positions does not match the number of times.");
+
+  if (static_cast<std::size_t>(_positions.rows())
+      != mStateSpace->getDimension())
+    throw std::invalid_argument(
+        "Positions do not match the dimension of the state space.");
+
+  for (Eigen::Index i = 1; i < _times.size(); ++i)
+  {
+    if (!(_times[i - 1] <= _times[i]))
+      throw std::invalid_argument("Times must be non-decreasing.");
+  }
+
+  reserveWaypoints(_times.size());
+  for (Eigen::Index i = 0; i < _times.size(); ++i)
+  {
+    State* state = mStateSpace->allocateStateInBuffer(
+        mWaypointStates.get() + i * mStateStride);
+    mWaypointTimes.push_back(_times[i]);
+    mStateSpace->expMap(_positions.col(i), state);
+  }
+}
+
 //==============================================================================
 Interpolated::~Interpolated()
 {
-  for (auto& waypoint : mWaypoints)
-    waypoint.free(mStateSpace);
+  for (std::size_t i = 0; i < mWaypointTimes.size(); ++i)
+    mStateSpace->freeStateInBuffer(getWaypointState(i));
 }
 
 //==============================================================================
@@ -44,25 +99,25 @@ std::size_t Interpolated::getNumDerivatives() const
 //==============================================================================
 double Interpolated::getStartTime() const
 {
-  if (mWaypoints.empty())
+  if (mWaypointTimes.empty())
     throw std::domain_error("Requested getEndTime on empty trajectory.");
 
-  return mWaypoints.front().t;
+  return mWaypointTimes.front();
 }
 
 //==============================================================================
 double Interpolated::getEndTime() const
 {
-  if (mWaypoints.empty())
+  if (mWaypointTimes.empty())
     throw std::domain_error("Requested getEndTime on empty trajectory.");
 
-  return mWaypoints.back().t;
+  return mWaypointTimes.back();
 }
 
 //==============================================================================
 double Interpolated::getDuration() const
 {
-  if (!mWaypoints.empty())
+  if (!mWaypointTimes.empty())
     return getEndTime() - getStartTime();
   else
     return 0.;
@@ -71,7 +126,7 @@ double Interpolated::getDuration() const
 //==============================================================================
 void Interpolated::evaluate(double _t, State* _state) const
 {
-  if (mWaypoints.empty())
+  if (mWaypointTimes.empty())
     throw std::invalid_argument(
         "Requested trajectory point from an empty trajectory");
 
@@ -81,23 +136,24 @@ void Interpolated::evaluate(double _t, State* _state) const
     if (idx == 0)
     {
       // Time before beginning of trajectory - return first waypoint
-      mStateSpace->copyState(mWaypoints[0].state, _state);
+      mStateSpace->copyState(getWaypointState(0), _state);
     }
     else
     {
-      Waypoint currentWpt = mWaypoints[idx];
-      Waypoint prevWpt = mWaypoints[idx - 1];
+      const double currentTime = mWaypointTimes[idx];
+      const double prevTime = mWaypointTimes[idx - 1];
       mInterpolator->interpolate(
-          prevWpt.state,
-          currentWpt.state,
-          (_t - prevWpt.t) / (currentWpt.t - prevWpt.t),
+          getWaypointState(idx - 1),
+          getWaypointState(idx),
+          (_t - prevTime) / (currentTime - prevTime),
           _state);
     }
   }
   catch (const std::domain_error& e)
   {
     // Time past end of trajectory - return last waypoint
-    mStateSpace->copyState(mWaypoints.back().state, _state);
+    mStateSpace->copyState(
+        getWaypointState(mWaypointTimes.size() - 1), _state);
   }
 }
 
@@ -129,12 +185,12 @@ void Interpolated::evaluateDerivative(
     if (idx == 0)
       throw std::domain_error("Time is before the trajectory starts.");
 
-    const auto segmentTime = mWaypoints[idx].t - mWaypoints[idx - 1].t;
-    const auto alpha = (_t - mWaypoints[idx - 1].t) / segmentTime;
+    const auto segmentTime = mWaypointTimes[idx] - mWaypointTimes[idx - 1];
+    const auto alpha = (_t - mWaypointTimes[idx - 1]) / segmentTime;
 
     mInterpolator->getDerivative(
-        mWaypoints[idx - 1].state,
-        mWaypoints[idx].state,
+        getWaypointState(idx - 1),
+        getWaypointState(idx),
         _derivative,
         alpha,
         _tangentVector);
@@ -149,23 +205,167 @@ void Interpolated::evaluateDerivative(
   }
 }
 
+//==============================================================================
+void Interpolated::evaluateBatch(
+    const Eigen::VectorXd& _times, Eigen::MatrixXd& _positions) const
+{
+  if (mWaypointTimes.empty())
+    throw std::invalid_argument(
+        "Requested trajectory point from an empty trajectory");
+
+  _positions.resize(mStateSpace->getDimension(), _times.size());
+
+  auto state = mStateSpace->allocateState();
+  Eigen::VectorXd position;
+  std::size_t idx = 0;
+
+  for (Eigen::Index i = 0; i < _times.size(); ++i)
+  {
+    mStateSpace->logMap(evaluateAfterIndex(_times[i], idx, state), position);
+    _positions.col(i) = position;
+  }
+
+  mStateSpace->freeState(state);
+}
+
+//==============================================================================
+void Interpolated::evaluateBatch(
+    const Eigen::VectorXd& _times, const std::vector<State*>& _states) const
+{
+  if (mWaypointTimes.empty())
+    throw std::invalid_argument(
+        "Requested trajectory point from an empty trajectory");
+  if (_states.size() != static_cast<std::size_t>(_times.size()))
+    throw std::invalid_argument("Number of states and times differ.");
+
+  std::size_t idx = 0;
+  for (Eigen::Index i = 0; i < _times.size(); ++i)
+  {
+    const State* state = evaluateAfterIndex(_times[i], idx, _states[i]);
+    if (state != _states[i])
+      mStateSpace->copyState(state, _states[i]);
+  }
+}
+
+//==============================================================================
+const State* Interpolated::evaluateAfterIndex(
+    double _t, std::size_t& _idx, State* _state) const
+{
+  _idx = findWaypointIndexAfterTime(_t, _idx);
+  if (_idx == 0)
+  {
+    // Time before beginning of trajectory - return first waypoint
+    return getWaypointState(0);
+  }
+  else if (_idx == mWaypointTimes.size())
+  {
+    // Time past end of trajectory - return last waypoint
+    return getWaypointState(_idx - 1);
+  }
+
+  const double currentTime = mWaypointTimes[_idx];
+  const double prevTime = mWaypointTimes[_idx - 1];
+  mInterpolator->interpolate(
+      getWaypointState(_idx - 1),
+      getWaypointState(_idx),
+      (_t - prevTime) / (currentTime - prevTime),
+      _state);
+  return _state;
+}
+
+//==============================================================================
+void Interpolated::evaluateDerivativeBatch(
+    const Eigen::VectorXd& _times,
+    int _derivative,
+    Eigen::MatrixXd& _tangentVectors) const
+{
+  if (_derivative == 0)
+    throw std::invalid_argument(
+        "0th derivative not available. Use evaluateBatch(times, positions).");
+
+  _tangentVectors.setZero(mStateSpace->getDimension(), _times.size());
+
+  if (static_cast<std::size_t>(_derivative)
+      > mInterpolator->getNumDerivatives())
+    return;
+
+  Eigen::VectorXd tangentVector;
+  std::size_t idx = 0;
+
+  for (Eigen::Index i = 0; i < _times.size(); ++i)
+  {
+    idx = findWaypointIndexAfterTime(_times[i], idx);
+
+    // Time before beginning or past end of trajectory - return zero
+    if (idx == 0 || idx == mWaypointTimes.size())
+      continue;
+
+    const auto segmentTime = mWaypointTimes[idx] - mWaypointTimes[idx - 1];
+    const auto alpha = (_times[i] - mWaypointTimes[idx - 1]) / segmentTime;
+
+    mInterpolator->getDerivative(
+        getWaypointState(idx - 1),
+        getWaypointState(idx),
+        _derivative,
+        alpha,
+        tangentVector);
+
+    _tangentVectors.col(i) = tangentVector / segmentTime;
+  }
+}
+
 //==============================================================================
 void Interpolated::addWaypoint(double _t, const State* _state)
 {
-  State* state = mStateSpace->allocateState();
-  mStateSpace->copyState(_state, state);
+  // Copy a state of this trajectory first, since the states may move below.
+  const char* buffer = mWaypointStates.get();
+  const char* address = reinterpret_cast<const char*>(_state);
+  if (std::greater_equal<const char*>()(address, buffer)
+      && std::less<const char*>()(
+             address, buffer + mStateCapacity * mStateStride))
+  {
+    const auto copy = mStateSpace->cloneState(_state);
+    addWaypoint(_t, copy);
+    return;
+  }
+
+  // Maintain a sorted list of waypoints. Appending is the common case.
+  const std::size_t numWaypoints = mWaypointTimes.size();
+  std::size_t index = numWaypoints;
+  if (numWaypoints > 0 && !(mWaypointTimes.back() < _t))
+  {
+    index = std::distance(
+        mWaypointTimes.begin(),
+        std::lower_bound(mWaypointTimes.begin(), mWaypointTimes.end(), _t));
+  }
+
+  if (numWaypoints == mStateCapacity)
+    reallocateWaypointStates(std::max<std::size_t>(2 * mStateCapacity, 4));
 
-  // Maintain a sorted list of waypoints
-  auto it = std::lower_bound(mWaypoints.begin(), mWaypoints.end(), _t);
-  mWaypoints.insert(it, Waypoint(_t, state));
+  mStateSpace->allocateStateInBuffer(
+      mWaypointStates.get() + numWaypoints * mStateStride);
+  for (std::size_t i = numWaypoints; i > index; --i)
+    mStateSpace->copyState(getWaypointState(i - 1), getWaypointState(i));
+  mStateSpace->copyState(_state, getWaypointState(index));
+
+  mWaypointTimes.insert(mWaypointTimes.begin() + index, _t);
+}
+
+//==============================================================================
+void Interpolated::reserveWaypoints(std::size_t _numWaypoints)
+{
+  if (_numWaypoints > mStateCapacity)
+    reallocateWaypointStates(_numWaypoints);
+
+  mWaypointTimes.reserve(_numWaypoints);
 }
 
 //==============================================================================
 const statespace::StateSpace::State* Interpolated::getWaypoint(
     std::size_t _index) const
 {
-  if (_index < mWaypoints.size())
-    return mWaypoints[_index].state;
+  if (_index < mWaypointTimes.size())
+    return getWaypointState(_index);
   else
     throw std::domain_error("Waypoint index is out of bounds.");
 }
@@ -173,8 +373,8 @@ const statespace::StateSpace::State* Interpolated::getWaypoint(
 //==============================================================================
 double Interpolated::getWaypointTime(std::size_t _index) const
 {
-  if (_index < mWaypoints.size())
-    return mWaypoints[_index].t;
+  if (_index < mWaypointTimes.size())
+    return mWaypointTimes[_index];
   else
     throw std::domain_error("Waypoint index is out of bounds.");
 }
@@ -182,50 +382,66 @@ double Interpolated::getWaypointTime(std::size_t _index) const
 //==============================================================================
 std::size_t Interpolated::getNumWaypoints() const
 {
-  return mWaypoints.size();
+  return mWaypointTimes.size();
 }
 
 //==============================================================================
-int Interpolated::getWaypointIndexAfterTime(double _t) const
+State* Interpolated::getWaypointState(std::size_t _index) const
 {
-  auto it = std::lower_bound(mWaypoints.begin(), mWaypoints.end(), _t);
-  if (it == mWaypoints.end())
-  {
-    throw std::domain_error(
-        "_t is larger than the time value on the last waypoint.");
-  }
-
-  return std::distance(mWaypoints.begin(), it);
+  // States are constructed at the start of their slot in the buffer.
+  return reinterpret_cast<State*>(
+      mWaypointStates.get() + _index * mStateStride);
 }
 
 //==============================================================================
-Interpolated::Waypoint::Waypoint(
-    double _t, statespace::StateSpace::State* _state)
-  : t(_t), state(_state)
+void Interpolated::reallocateWaypointStates(std::size_t _capacity)
 {
-}
+  const std::size_t numWaypoints = mWaypointTimes.size();
+  assert(_capacity >= numWaypoints);
 
-//==============================================================================
-bool Interpolated::Waypoint::operator<(const Waypoint& rhs) const
-{
-  return t < rhs.t;
+  std::unique_ptr<char[]> waypointStates(new char[_capacity * mStateStride]);
+  for (std::size_t i = 0; i < numWaypoints; ++i)
+  {
+    State* state = mStateSpace->allocateStateInBuffer(
+        waypointStates.get() + i * mStateStride);
+    mStateSpace->copyState(getWaypointState(i), state);
+    mStateSpace->freeStateInBuffer(getWaypointState(i));
+  }
+
+  mWaypointStates = std::move(waypointStates);
+  mStateCapacity = _capacity;
 }
 
 //==============================================================================
-bool Interpolated::Waypoint::operator<(double rhs) const
+int Interpolated::getWaypointIndexAfterTime(double _t) const
 {
-  return t < rhs;
+  auto it = std::lower_bound(mWaypointTimes.begin(), mWaypointTimes.end(), _t);
+  if (it == mWaypointTimes.end())
+  {
+    throw std::domain_error(
+        "_t is larger than the time value on the last waypoint.");
+  }
+
+  return std::distance(mWaypointTimes.begin(), it);
 }
 
 //==============================================================================
-void Interpolated::Waypoint::free(
-    const statespace::ConstStateSpacePtr& stateSpace)
+std::size_t Interpolated::findWaypointIndexAfterTime(
+    double _t, std::size_t _hint) const
 {
-  if (state)
+  // Search from the beginning if _t is not after the waypoint before _hint.
+  if (_hint > mWaypointTimes.size()
+      || (_hint > 0 && !(mWaypointTimes[_hint - 1] < _t)))
   {
-    stateSpace->freeState(state);
-    state = nullptr;
+    return std::distance(
+        mWaypointTimes.begin(),
+        std::lower_bound(mWaypointTimes.begin(), mWaypointTimes.end(), _t));
   }
+
+  while (_hint < mWaypointTimes.size() && mWaypointTimes[_hint] < _t)
+    ++_hint;
+
+  return _hint;
 }
 
 } // namespace trajectory
@@ -1,13 +1,16 @@
 #include "aikido/trajectory/Spline.hpp"
 
-#include "aikido/common/Spline.hpp"
+#include <algorithm>
 
 namespace aikido {
 namespace trajectory {
 
 //==============================================================================
 Spline::Spline(statespace::ConstStateSpacePtr _stateSpace, double _startTime)
-  : mStateSpace(std::move(_stateSpace)), mStartTime(_startTime)
+  : mStateSpace(std::move(_stateSpace))
+  , mStartTime(_startTime)
+  , mDuration(0.)
+  , mSegmentHint(0)
 {
   if (mStateSpace == nullptr)
     throw std::invalid_argument("StateSpace is null.");
@@ -43,6 +46,9 @@ void Spline::addSegment(
   mStateSpace->copyState(_startState, segment.mStartState);
 
   mSegments.emplace_back(std::move(segment));
+  mSegmentEndTimes.emplace_back(
+      getSegmentStartTime(mSegments.size() - 1) + _duration);
+  mDuration += _duration;
 }
 
 //==============================================================================
@@ -102,12 +108,7 @@ double Spline::getEndTime() const
 //==============================================================================
 double Spline::getDuration() const
 {
-  double duration = 0.;
-
-  for (const auto& segment : mSegments)
-    duration += segment.mDuration;
-
-  return duration;
+  return mDuration;
 }
 
 //==============================================================================
@@ -122,12 +123,18 @@ void Spline::evaluate(double _t, statespace::StateSpace::State* _out) const
   mStateSpace->copyState(targetSegment.mStartState, _out);
 
   const auto evaluationTime = _t - targetSegmentInfo.second;
-  const auto tangentVector
-      = evaluatePolynomial(targetSegment.mCoefficients, evaluationTime, 0);
 
-  auto relativeState = mStateSpace->createState();
+  // Reuse the tangent vector between calls on the same thread, so repeated
+  // evaluation does not allocate.
+  static thread_local Eigen::VectorXd tangentVector;
+  evaluatePolynomial(
+      targetSegment.mCoefficients, evaluationTime, 0, tangentVector);
+
+  // allocateState() draws from the state space's pool, unlike createState().
+  auto relativeState = mStateSpace->allocateState();
   mStateSpace->expMap(tangentVector, relativeState);
   mStateSpace->compose(_out, relativeState);
+  mStateSpace->freeState(relativeState);
 }
 
 //==============================================================================
@@ -148,8 +155,11 @@ void Spline::evaluateDerivative(
   {
     // TODO: We should transform this into the body frame using the adjoint
     // transformation.
-    _tangentVector = evaluatePolynomial(
-        targetSegment.mCoefficients, evaluationTime, _derivative);
+    evaluatePolynomial(
+        targetSegment.mCoefficients,
+        evaluationTime,
+        _derivative,
+        _tangentVector);
   }
   else
   {
@@ -159,47 +169,222 @@ void Spline::evaluateDerivative(
 }
 
 //==============================================================================
-std::pair<std::size_t, double> Spline::getSegmentForTime(double _t) const
+void Spline::evaluateBatch(
+    const Eigen::VectorXd& _times, Eigen::MatrixXd& _positions) const
 {
-  auto segmentStartTime = mStartTime;
+  if (mSegments.empty())
+    throw std::logic_error("Unable to evaluate empty trajectory.");
+
+  _positions.resize(mStateSpace->getDimension(), _times.size());
+
+  auto relativeState = mStateSpace->allocateState();
+  auto state = mStateSpace->allocateState();
+  Eigen::MatrixXd tangentVectors;
+  Eigen::VectorXd tangentVector;
+  Eigen::VectorXd position;
+
+  forEachSegmentBlock(
+      _times,
+      [&](std::size_t segmentIndex,
+          double segmentStartTime,
+          Eigen::Index begin,
+          Eigen::Index size) {
+        const auto& segment = mSegments[segmentIndex];
+        const Eigen::VectorXd evaluationTimes
+            = _times.segment(begin, size).array() - segmentStartTime;
+        evaluatePolynomialBatch(
+            segment.mCoefficients, evaluationTimes, 0, tangentVectors);
+
+        for (Eigen::Index i = 0; i < size; ++i)
+        {
+          tangentVector = tangentVectors.col(i);
+          mStateSpace->expMap(tangentVector, relativeState);
+          mStateSpace->compose(segment.mStartState, relativeState, state);
+          mStateSpace->logMap(state, position);
+          _positions.col(begin + i) = position;
+        }
+      });
+
+  mStateSpace->freeState(state);
+  mStateSpace->freeState(relativeState);
+}
+
+//==============================================================================
+void Spline::evaluateBatch(
+    const Eigen::VectorXd& _times,
+    const std::vector<statespace::StateSpace::State*>& _states) const
+{
+  if (mSegments.empty())
+    throw std::logic_error("Unable to evaluate empty trajectory.");
+  if (_states.size() != static_cast<std::size_t>(_times.size()))
+    throw std::invalid_argument("Number of states and times differ.");
+
+  auto relativeState = mStateSpace->allocateState();
+  Eigen::MatrixXd tangentVectors;
+  Eigen::VectorXd tangentVector;
+
+  forEachSegmentBlock(
+      _times,
+      [&](std::size_t segmentIndex,
+          double segmentStartTime,
+          Eigen::Index begin,
+          Eigen::Index size) {
+        const auto& segment = mSegments[segmentIndex];
+        const Eigen::VectorXd evaluationTimes
+            = _times.segment(begin, size).array() - segmentStartTime;
+        evaluatePolynomialBatch(
+            segment.mCoefficients, evaluationTimes, 0, tangentVectors);
+
+        for (Eigen::Index i = 0; i < size; ++i)
+        {
+          tangentVector = tangentVectors.col(i);
+          mStateSpace->expMap(tangentVector, relativeState);
+          mStateSpace->compose(
+              segment.mStartState, relativeState, _states[begin + i]);
+        }
+      });
+
+  mStateSpace->freeState(relativeState);
+}
 
-  for (std::size_t isegment = 0; isegment < mSegments.size(); ++isegment)
+//==============================================================================
+void Spline::evaluateDerivativeBatch(
+    const Eigen::VectorXd& _times,
+    int _derivative,
+    Eigen::MatrixXd& _tangentVectors) const
+{
+  if (mSegments.empty())
+    throw std::logic_error("Unable to evaluate empty trajectory.");
+  if (_derivative < 1)
+    throw std::logic_error("Derivative must be positive.");
+
+  _tangentVectors.resize(mStateSpace->getDimension(), _times.size());
+
+  Eigen::MatrixXd blockTangentVectors;
+  forEachSegmentBlock(
+      _times,
+      [&](std::size_t segmentIndex,
+          double segmentStartTime,
+          Eigen::Index begin,
+          Eigen::Index size) {
+        const Eigen::VectorXd evaluationTimes
+            = _times.segment(begin, size).array() - segmentStartTime;
+        // Higher-order derivatives are zero.
+        evaluatePolynomialBatch(
+            mSegments[segmentIndex].mCoefficients,
+            evaluationTimes,
+            _derivative,
+            blockTangentVectors);
+        _tangentVectors.middleCols(begin, size) = blockTangentVectors;
+      });
+}
+
+//==============================================================================
+void Spline::forEachSegmentBlock(
+    const Eigen::VectorXd& _times, const SegmentBlockFunction& _function) const
+{
+  Eigen::Index begin = 0;
+  while (begin < _times.size())
   {
-    const auto& segment = mSegments[isegment];
-    const auto nextSegmentStartTime = segmentStartTime + segment.mDuration;
+    const auto segmentInfo = getSegmentForTime(_times[begin]);
 
-    if (_t <= nextSegmentStartTime)
-      return std::make_pair(isegment, segmentStartTime);
+    Eigen::Index end = begin + 1;
+    while (end < _times.size()
+           && getSegmentForTime(_times[end]).first == segmentInfo.first)
+      ++end;
 
-    segmentStartTime = nextSegmentStartTime;
+    _function(segmentInfo.first, segmentInfo.second, begin, end - begin);
+    begin = end;
   }
+}
 
-  // After the end of the last segment.
-  return std::make_pair(
-      mSegments.size() - 1, segmentStartTime - mSegments.back().mDuration);
+//==============================================================================
+std::pair<std::size_t, double> Spline::getSegmentForTime(double _t) const
+{
+  // The segment that contains _t is the first one that ends at or after _t,
+  // or the last one if _t is after the end of the trajectory.
+  auto containsTime = [&](std::size_t index) {
+    return _t <= mSegmentEndTimes[index]
+           && (index == 0 || _t > mSegmentEndTimes[index - 1]);
+  };
+
+  // Sequential evaluation usually stays in the same segment or moves on to the
+  // next one.
+  const std::size_t hint = mSegmentHint.load(std::memory_order_relaxed);
+  std::size_t index;
+  if (hint < mSegments.size() && containsTime(hint))
+  {
+    index = hint;
+  }
+  else if (hint + 1 < mSegments.size() && containsTime(hint + 1))
+  {
+    index = hint + 1;
+  }
+  else
+  {
+    const auto it = std::lower_bound(
+        mSegmentEndTimes.begin(), mSegmentEndTimes.end(), _t);
+    index = std::min<std::size_t>(
+        it - mSegmentEndTimes.begin(), mSegments.size() - 1);
+  }
+
+  mSegmentHint.store(index, std::memory_order_relaxed);
+  return std::make_pair(index, getSegmentStartTime(index));
 }
 
 //==============================================================================
-Eigen::VectorXd Spline::evaluatePolynomial(
-    const Eigen::MatrixXd& _coefficients, double _t, int _derivative)
+double Spline::getSegmentStartTime(std::size_t _index) const
+{
+  return _index == 0 ? mStartTime : mSegmentEndTimes[_index - 1];
+}
+
+//==============================================================================
+void Spline::evaluatePolynomial(
+    const Eigen::MatrixXd& _coefficients,
+    double _t,
+    int _derivative,
+    Eigen::VectorXd& _out)
 {
-  const auto numOutputs = _coefficients.rows();
   const auto numCoeffs = _coefficients.cols();
 
-  const auto timeVector
-      = common::SplineProblem<>::createTimeVector(_t, _derivative, numCoeffs);
-  const auto derivativeMatrix
-      = common::SplineProblem<>::createCoefficientMatrix(numCoeffs);
-  const auto derivativeVector = derivativeMatrix.row(_derivative);
-  const auto evaluationVector
-      = derivativeVector.cwiseProduct(timeVector.transpose());
+  _out.resize(_coefficients.rows());
+  _out.setZero();
 
-  Eigen::VectorXd outputVector(numOutputs);
+  // Horner's method on the _derivative-th derivative of the polynomial, whose
+  // i-th coefficient is scaled by i! / (i - _derivative)!.
+  for (auto icoeff = numCoeffs - 1; icoeff >= _derivative; --icoeff)
+  {
+    double scale = 1.;
+    for (auto k = icoeff - _derivative + 1; k <= icoeff; ++k)
+      scale *= k;
+
+    _out *= _t;
+    _out.noalias() += scale * _coefficients.col(icoeff);
+  }
+}
+
+//==============================================================================
+void Spline::evaluatePolynomialBatch(
+    const Eigen::MatrixXd& _coefficients,
+    const Eigen::VectorXd& _t,
+    int _derivative,
+    Eigen::MatrixXd& _out)
+{
+  const auto numCoeffs = _coefficients.cols();
 
-  for (int ioutput = 0; ioutput < numOutputs; ++ioutput)
-    outputVector[ioutput] = _coefficients.row(ioutput).dot(evaluationVector);
+  _out.resize(_coefficients.rows(), _t.size());
+  _out.setZero();
+
+  // Same as evaluatePolynomial, with one column per time.
+  for (auto icoeff = numCoeffs - 1; icoeff >= _derivative; --icoeff)
+  {
+    double scale = 1.;
+    for (auto k = icoeff - _derivative + 1; k <= icoeff; ++k)
+      scale *= k;
 
-  return outputVector;
+    _out.array().rowwise() *= _t.transpose().array();
+    _out.colwise() += scale * _coefficients.col(icoeff);
+  }
 }
 
 //==============================================================================
@@ -211,15 +396,10 @@ std::size_t Spline::getNumWaypoints() const
 //==============================================================================
 double Spline::getWaypointTime(std::size_t _index) const
 {
-  double waypointTime = mStartTime;
-
   if (_index >= getNumWaypoints())
     throw std::domain_error("Waypoint index is out of bounds.");
 
-  for (std::size_t i = 0; i < _index; ++i)
-    waypointTime += mSegments[i].mDuration;
-
-  return waypointTime;
+  return getSegmentStartTime(_index);
 }
 
 //==============================================================================
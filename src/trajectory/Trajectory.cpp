@@ -0,0 +1,54 @@
+#include "aikido/trajectory/Trajectory.hpp"
+
+#include <stdexcept>
+
+namespace aikido {
+namespace trajectory {
+
+//==============================================================================
+void Trajectory::evaluateBatch(
+    const Eigen::VectorXd& _times, Eigen::MatrixXd& _positions) const
+{
+  const auto stateSpace = getStateSpace();
+  _positions.resize(stateSpace->getDimension(), _times.size());
+
+  auto state = stateSpace->createState();
+  Eigen::VectorXd position;
+  for (Eigen::Index i = 0; i < _times.size(); ++i)
+  {
+    evaluate(_times[i], state);
+    stateSpace->logMap(state, position);
+    _positions.col(i) = position;
+  }
+}
+
+//==============================================================================
+void Trajectory::evaluateBatch(
+    const Eigen::VectorXd& _times,
+    const std::vector<statespace::StateSpace::State*>& _states) const
+{
+  if (_states.size() != static_cast<std::size_t>(_times.size()))
+    throw std::invalid_argument("Number of states and times differ.");
+
+  for (Eigen::Index i = 0; i < _times.size(); ++i)
+    evaluate(_times[i], _states[i]);
+}
+
+//==============================================================================
+void Trajectory::evaluateDerivativeBatch(
+    const Eigen::VectorXd& _times,
+    int _derivative,
+    Eigen::MatrixXd& _tangentVectors) const
+{
+  _tangentVectors.resize(getStateSpace()->getDimension(), _times.size());
+
+  Eigen::VectorXd tangentVector;
+  for (Eigen::Index i = 0; i < _times.size(); ++i)
+  {
+    evaluateDerivative(_times[i], _derivative, tangentVector);
+    _tangentVectors.col(i) = tangentVector;
+  }
+}
+
+} // namespace trajectory
+} // namespace aikido
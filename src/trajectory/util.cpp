@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -28,11 +29,8 @@ using aikido::statespace::StateSpacePtr;
 
 using aikido::distance::createDistanceMetric;
 
-using Eigen::Vector2d;
-using LinearSplineProblem
-    = aikido::common::SplineProblem<double, int, 2, Eigen::Dynamic, 2>;
-using CubicSplineProblem = aikido::common::
-    SplineProblem<double, int, 4, Eigen::Dynamic, Eigen::Dynamic>;
+using aikido::common::fitCubicSegment;
+using aikido::common::fitLinearSegment;
 
 namespace aikido {
 namespace trajectory {
@@ -106,14 +104,10 @@ UniqueSplinePtr convertToSpline(const Interpolated& inputTrajectory)
     stateSpace->logMap(nextState, nextVec);
 
     // Compute the spline coefficients for this segment of the trajectory.
-    LinearSplineProblem problem(
-        Vector2d(0, nextTime - currentTime), 2, dimension);
-    problem.addConstantConstraint(0, 0, Eigen::VectorXd::Zero(dimension));
-    problem.addConstantConstraint(1, 0, nextVec - currentVec);
-    const auto spline = problem.fit();
-
-    assert(spline.getCoefficients().size() == 1);
-    const auto& coefficients = spline.getCoefficients().front();
+    const Eigen::MatrixXd coefficients = fitLinearSegment(
+        Eigen::VectorXd::Zero(dimension),
+        nextVec - currentVec,
+        nextTime - currentTime);
     outputTrajectory->addSegment(
         coefficients, nextTime - currentTime, currentState);
   }
@@ -168,18 +162,40 @@ double findTimeOfClosestStateOnTrajectory(
       timeStep, true, true, traj.getStartTime(), traj.getEndTime());
 
   auto metric = createDistanceMetric(stateSpace);
-  auto currState = stateSpace->createState();
 
-  for (const double currTime : sequence)
+  // Evaluate the trajectory in batches of states that are reused, so that
+  // memory does not grow with the length of the trajectory.
+  constexpr std::size_t batchSize = 16;
+  std::vector<StateSpace::ScopedState> batchStates;
+  std::vector<StateSpace::State*> states;
+  batchStates.reserve(batchSize);
+  for (std::size_t i = 0; i < batchSize; ++i)
+    batchStates.emplace_back(stateSpace->createState());
+
+  Eigen::VectorXd times;
+  for (std::size_t begin = 0; begin < sequence.getLength(); begin += batchSize)
   {
-    traj.evaluate(currTime, currState);
+    const std::size_t end = std::min(begin + batchSize, sequence.getLength());
 
-    auto currDist = metric->distance(currState, referenceState);
+    times.resize(end - begin);
+    states.clear();
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      times[i - begin] = sequence[i];
+      states.emplace_back(batchStates[i - begin].getState());
+    }
 
-    if (currDist < minDist)
+    traj.evaluateBatch(times, states);
+
+    for (Eigen::Index i = 0; i < times.size(); ++i)
     {
-      minDist = currDist;
-      timeOfClosestState = currTime;
+      auto currDist = metric->distance(states[i], referenceState);
+
+      if (currDist < minDist)
+      {
+        minDist = currDist;
+        timeOfClosestState = times[i];
+      }
     }
   }
 
@@ -233,13 +249,12 @@ UniqueSplinePtr createPartialTrajectory(
 
       if (segmentDuration > 0.0)
       {
-        CubicSplineProblem problem(Vector2d{0., segmentDuration}, 4, dimension);
-        problem.addConstantConstraint(0, 0, zeroPos);
-        problem.addConstantConstraint(0, 1, segStartVel);
-        problem.addConstantConstraint(1, 0, segEndPos - segStartPos);
-        problem.addConstantConstraint(1, 1, segEndVel);
-        const auto solution = problem.fit();
-        const auto coefficients = solution.getCoefficients().front();
+        const Eigen::MatrixXd coefficients = fitCubicSegment(
+            zeroPos,
+            segStartVel,
+            segEndPos - segStartPos,
+            segEndVel,
+            segmentDuration);
         outputTrajectory->addSegment(
             coefficients, segmentDuration, segmentStartState);
       }
@@ -282,35 +297,29 @@ UniqueInterpolatedPtr toR1JointTrajectory(const Interpolated& trajectory)
 
   auto rSpace = std::make_shared<CartesianProduct>(subspaces);
   auto rInterpolator = std::make_shared<GeodesicInterpolator>(rSpace);
-  auto rTrajectory
-      = ::aikido::common::make_unique<Interpolated>(rSpace, rInterpolator);
 
+  // The first waypoint
   Eigen::VectorXd sourceVector(space->getDimension());
-  auto sourceState = rSpace->createState();
-
-  // Add the first waypoint
   space->logMap(trajectory.getWaypoint(0), sourceVector);
-  rSpace->expMap(sourceVector, sourceState);
-  rTrajectory->addWaypoint(trajectory.getWaypointTime(0), sourceState);
 
-  auto tangentState = rSpace->createState();
-  auto targetState = rSpace->createState();
+  const std::size_t numWaypoints = trajectory.getNumWaypoints();
+  Eigen::VectorXd times(numWaypoints);
+  Eigen::MatrixXd positions(space->getDimension(), numWaypoints);
+  times[0] = trajectory.getWaypointTime(0);
+  positions.col(0) = sourceVector;
 
-  // Add the remaining waypoints
-  for (std::size_t i = 0; i < trajectory.getNumWaypoints() - 1; ++i)
+  // The remaining waypoints, unwrapped by composing tangent vectors in R^n
+  for (std::size_t i = 0; i + 1 < numWaypoints; ++i)
   {
     const auto tangentVector = interpolator->getTangentVector(
         trajectory.getWaypoint(i), trajectory.getWaypoint(i + 1));
 
-    rSpace->expMap(sourceVector, sourceState);
-    rSpace->expMap(tangentVector, tangentState);
-    rSpace->compose(sourceState, tangentState, targetState);
-
-    rTrajectory->addWaypoint(trajectory.getWaypointTime(i + 1), targetState);
-    rSpace->logMap(targetState, sourceVector);
+    times[i + 1] = trajectory.getWaypointTime(i + 1);
+    positions.col(i + 1) = positions.col(i) + tangentVector;
   }
 
-  return rTrajectory;
+  return ::aikido::common::make_unique<Interpolated>(
+      rSpace, rInterpolator, times, positions);
 }
 
 } // namespace trajectory
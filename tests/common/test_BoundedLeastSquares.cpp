@@ -0,0 +1,180 @@
+#include <Eigen/Dense>
+#include <gtest/gtest.h>
+
+#include <aikido/common/BoundedLeastSquares.hpp>
+
+using aikido::common::BoundedLeastSquares;
+
+//==============================================================================
+/// Returns whether x satisfies the optimality conditions of the bounded
+/// least-squares problem.
+bool isOptimal(
+    const Eigen::MatrixXd& mat,
+    const Eigen::VectorXd& rhs,
+    const Eigen::VectorXd& lower,
+    const Eigen::VectorXd& upper,
+    const Eigen::VectorXd& reference,
+    double regularization,
+    const Eigen::VectorXd& x)
+{
+  const double tolerance = 1e-8;
+
+  const Eigen::VectorXd gradient
+      = mat.transpose() * (mat * x - rhs)
+        + regularization * regularization * (x - reference);
+
+  for (int i = 0; i < x.size(); ++i)
+  {
+    if (x[i] < lower[i] - tolerance || x[i] > upper[i] + tolerance)
+      return false;
+
+    const bool atLower = x[i] <= lower[i] + tolerance;
+    const bool atUpper = x[i] >= upper[i] - tolerance;
+
+    if (!atLower && gradient[i] > tolerance)
+      return false;
+    if (!atUpper && gradient[i] < -tolerance)
+      return false;
+  }
+
+  return true;
+}
+
+//==============================================================================
+TEST(BoundedLeastSquares, ThrowsOnNonPositiveRegularization)
+{
+  EXPECT_THROW(BoundedLeastSquares(0.), std::invalid_argument);
+  EXPECT_THROW(BoundedLeastSquares(-1.), std::invalid_argument);
+}
+
+//==============================================================================
+TEST(BoundedLeastSquares, ThrowsOnInconsistentDimensions)
+{
+  BoundedLeastSquares solver;
+  const Eigen::MatrixXd mat = Eigen::MatrixXd::Identity(2, 3);
+  const Eigen::VectorXd bound = Eigen::VectorXd::Ones(3);
+  Eigen::VectorXd x;
+
+  EXPECT_THROW(
+      solver.solve(mat, Eigen::VectorXd::Zero(3), -bound, bound, bound, x),
+      std::invalid_argument);
+  EXPECT_THROW(
+      solver.solve(
+          mat, Eigen::VectorXd::Zero(2), -bound, bound.head<2>(), bound, x),
+      std::invalid_argument);
+  EXPECT_THROW(
+      solver.solve(mat, Eigen::VectorXd::Zero(2), bound, -bound, bound, x),
+      std::invalid_argument);
+}
+
+//==============================================================================
+TEST(BoundedLeastSquares, UnconstrainedMatchesLeastSquares)
+{
+  BoundedLeastSquares solver(1e-6);
+
+  const Eigen::MatrixXd mat = Eigen::MatrixXd::Random(6, 6);
+  const Eigen::VectorXd rhs = Eigen::VectorXd::Random(6);
+  const Eigen::VectorXd bound = Eigen::VectorXd::Constant(6, 1e6);
+
+  Eigen::VectorXd x;
+  const Eigen::VectorXd reference = Eigen::VectorXd::Zero(6);
+  ASSERT_TRUE(solver.solve(mat, rhs, -bound, bound, reference, x));
+
+  const Eigen::VectorXd expected = mat.colPivHouseholderQr().solve(rhs);
+  EXPECT_TRUE(x.isApprox(expected, 1e-6));
+}
+
+//==============================================================================
+TEST(BoundedLeastSquares, RedundantProblemStaysCloseToReference)
+{
+  BoundedLeastSquares solver(1e-6);
+
+  // Minimizers are x = (1, t) for any t; the closest to the reference is
+  // x = (1, 0.5).
+  Eigen::MatrixXd mat(1, 2);
+  mat << 1, 0;
+  const Eigen::VectorXd rhs = Eigen::VectorXd::Ones(1);
+  const Eigen::VectorXd bound = Eigen::VectorXd::Constant(2, 10);
+  const Eigen::Vector2d reference(0, 0.5);
+
+  Eigen::VectorXd x;
+  ASSERT_TRUE(solver.solve(mat, rhs, -bound, bound, reference, x));
+  EXPECT_TRUE(x.isApprox(Eigen::Vector2d(1, 0.5), 1e-6));
+}
+
+//==============================================================================
+TEST(BoundedLeastSquares, RandomProblemsSatisfyOptimalityConditions)
+{
+  const double regularization = 1e-4;
+  BoundedLeastSquares solver(regularization);
+
+  for (int trial = 0; trial < 100; ++trial)
+  {
+    const Eigen::MatrixXd mat = Eigen::MatrixXd::Random(6, 7);
+    const Eigen::VectorXd rhs = 3. * Eigen::VectorXd::Random(6);
+    Eigen::VectorXd lower = -Eigen::VectorXd::Random(7).cwiseAbs();
+    const Eigen::VectorXd upper = Eigen::VectorXd::Random(7).cwiseAbs();
+    lower[trial % 7] = 0.;
+    const Eigen::VectorXd reference = Eigen::VectorXd::Zero(7);
+
+    Eigen::VectorXd x;
+    ASSERT_TRUE(solver.solve(mat, rhs, lower, upper, reference, x));
+    EXPECT_TRUE(
+        isOptimal(mat, rhs, lower, upper, reference, regularization, x));
+
+    // The minimizer is unique, so warm-starting from it converges
+    // immediately to the same point.
+    Eigen::VectorXd warm = x;
+    ASSERT_TRUE(solver.solve(mat, rhs, lower, upper, reference, warm));
+    EXPECT_TRUE(warm.isApprox(x, 1e-8));
+    EXPECT_EQ(1, solver.getNumIterations());
+  }
+}
+
+//==============================================================================
+TEST(BoundedLeastSquares, FixedVariablesStayAtTheirBound)
+{
+  BoundedLeastSquares solver;
+
+  const Eigen::MatrixXd mat = Eigen::MatrixXd::Identity(3, 3);
+  const Eigen::Vector3d rhs(1, -1, 1);
+  const Eigen::Vector3d lower(-2, 0, -2);
+  const Eigen::Vector3d upper(2, 0, 0.5);
+
+  Eigen::VectorXd x;
+  ASSERT_TRUE(solver.solve(mat, rhs, lower, upper, Eigen::Vector3d::Zero(), x));
+  EXPECT_NEAR(1., x[0], 1e-6);
+  EXPECT_DOUBLE_EQ(0., x[1]);
+  EXPECT_DOUBLE_EQ(0.5, x[2]);
+}
+
+//==============================================================================
+TEST(BoundedLeastSquares, HoldsVariableBlockedAtZeroBound)
+{
+  // A blocked step leaves x[1] a denormal above its lower bound of zero
+  // instead of exactly at it; the solver must still hold it there rather than
+  // taking vanishing steps until it runs out of iterations.
+  Eigen::MatrixXd mat(6, 3);
+  mat << 0.2625729082749777, 0.4333100496544342, 0.5291754941657514,
+      0.8487831201464491, -0.5624939567893862, -0.7978018762205539,
+      0.5780001357695399, 0.39756461488489725, -0.16747971355951508,
+      -0.6825077151736343, -0.6657953285662459, 0.13803127331027665,
+      -0.010206850409885448, 0.31673850272447446, -0.3027825978780896,
+      -0.5877778141861988, -0.10736762731336413, 0.945223570045707;
+  Eigen::VectorXd rhs(6);
+  rhs << -0.85667742754666243, 2.0734105707454855, 0.32800453365938842,
+      2.5111046815834368, -1.8687911981116057, -0.99395603599146143;
+  const Eigen::Vector3d lower(-0.82535206413767082, 0., -0.58643793639896691);
+  const Eigen::Vector3d upper(
+      0.64435750709534856, 0.56977918425910712, 0.60935956354591858);
+  const Eigen::Vector3d reference(
+      -0.04006132093918191, 0.22854142264269706, -0.48183385019756936);
+
+  const double regularization = 1e-4;
+  BoundedLeastSquares solver(regularization);
+
+  Eigen::VectorXd x = reference;
+  ASSERT_TRUE(solver.solve(mat, rhs, lower, upper, reference, x));
+  EXPECT_EQ(0., x[1]);
+  EXPECT_TRUE(isOptimal(mat, rhs, lower, upper, reference, regularization, x));
+}
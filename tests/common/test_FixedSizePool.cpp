@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <aikido/common/FixedSizePool.hpp>
+
+using aikido::common::FixedSizePool;
+
+TEST(FixedSizePool, BlockSizeIsRoundedUpToAlignment)
+{
+  FixedSizePool pool1(1);
+  EXPECT_EQ(FixedSizePool::ALIGNMENT, pool1.getBlockSize());
+
+  FixedSizePool pool2(FixedSizePool::ALIGNMENT + 1);
+  EXPECT_EQ(2 * FixedSizePool::ALIGNMENT, pool2.getBlockSize());
+}
+
+TEST(FixedSizePool, BlocksAreAligned)
+{
+  FixedSizePool pool(24, 4);
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 100; ++i)
+  {
+    void* block = pool.allocate();
+    EXPECT_EQ(
+        0u, reinterpret_cast<std::uintptr_t>(block) % FixedSizePool::ALIGNMENT);
+    blocks.push_back(block);
+  }
+  EXPECT_EQ(100u, pool.getNumAllocatedBlocks());
+
+  for (auto block : blocks)
+    pool.deallocate(block);
+  EXPECT_EQ(0u, pool.getNumAllocatedBlocks());
+}
+
+TEST(FixedSizePool, RecyclesBlocksWithoutGrowing)
+{
+  FixedSizePool pool(8, 16);
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 16; ++i)
+    blocks.push_back(pool.allocate());
+  EXPECT_EQ(1u, pool.getNumSlabs());
+
+  for (int iteration = 0; iteration < 1000; ++iteration)
+  {
+    for (auto block : blocks)
+      pool.deallocate(block);
+    for (auto& block : blocks)
+      block = pool.allocate();
+  }
+  EXPECT_EQ(1u, pool.getNumSlabs());
+
+  pool.allocate();
+  EXPECT_EQ(2u, pool.getNumSlabs());
+}
+
+TEST(FixedSizePool, ShrinksWhenEmpty)
+{
+  FixedSizePool pool(8, 4);
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 100; ++i)
+    blocks.push_back(pool.allocate());
+  EXPECT_LT(1u, pool.getNumSlabs());
+
+  for (auto block : blocks)
+    pool.deallocate(block);
+  EXPECT_EQ(1u, pool.getNumSlabs());
+  EXPECT_EQ(0u, pool.getNumAllocatedBlocks());
+
+  // The remaining slab is still usable.
+  for (auto& block : blocks)
+    block = pool.allocate();
+  EXPECT_EQ(100u, pool.getNumAllocatedBlocks());
+  for (auto block : blocks)
+    pool.deallocate(block);
+}
+
+TEST(FixedSizePool, Clear)
+{
+  FixedSizePool pool(8);
+  for (int i = 0; i < 100; ++i)
+    pool.allocate();
+  EXPECT_LT(0u, pool.getNumSlabs());
+
+  pool.clear();
+  EXPECT_EQ(0u, pool.getNumSlabs());
+  EXPECT_EQ(0u, pool.getNumAllocatedBlocks());
+
+  EXPECT_NE(nullptr, pool.allocate());
+}
+
+TEST(FixedSizePool, DeallocateNull)
+{
+  FixedSizePool pool(8);
+  EXPECT_NO_THROW(pool.deallocate(nullptr));
+  EXPECT_EQ(0u, pool.getNumAllocatedBlocks());
+}
@@ -30,3 +30,80 @@ TEST(PseudoInverse, Matrix)
 
   EXPECT_TRUE((mat * inverse).isApprox(Eigen::Matrix3d::Identity()));
 }
+
+TEST(PseudoInverse, MatrixRankDeficient)
+{
+  Eigen::MatrixXd mat(Eigen::MatrixXd::Zero(3, 4));
+  mat.topLeftCorner<2, 4>().setRandom();
+  Eigen::MatrixXd inverse = pseudoinverse(mat);
+
+  EXPECT_TRUE((mat * inverse * mat).isApprox(mat));
+  EXPECT_TRUE((inverse * mat * inverse).isApprox(inverse));
+}
+
+template <int Rows, int Cols>
+void testSolveLeastSquaresMatchesPseudoinverse(
+    Eigen::Index rows, Eigen::Index cols)
+{
+  using Matrix = Eigen::Matrix<double, Rows, Cols>;
+  using Rhs = Eigen::Matrix<double, Rows, 1>;
+  using Solution = Eigen::Matrix<double, Cols, 1>;
+
+  LeastSquaresWorkspace<Rows, Cols> workspace;
+
+  for (int i = 0; i < 3; ++i)
+  {
+    Matrix mat = Matrix::Random(rows, cols);
+    if (i == 2)
+      mat.row(0).setZero(); // rank deficient
+    const Rhs rhs = Rhs::Random(rows);
+
+    Solution solution;
+    solveLeastSquares(mat, rhs, solution, workspace);
+
+    const Eigen::VectorXd expected = pseudoinverse(mat) * rhs;
+    EXPECT_TRUE(solution.isApprox(expected, 1e-8))
+        << "size " << rows << " x " << cols;
+  }
+}
+
+TEST(PseudoInverse, SolveLeastSquaresMatchesPseudoinverse)
+{
+  testSolveLeastSquaresMatchesPseudoinverse<6, 6>(6, 6);
+  testSolveLeastSquaresMatchesPseudoinverse<6, 7>(6, 7);
+  testSolveLeastSquaresMatchesPseudoinverse<6, Eigen::Dynamic>(6, 7);
+  testSolveLeastSquaresMatchesPseudoinverse<Eigen::Dynamic, Eigen::Dynamic>(
+      12, 14);
+  testSolveLeastSquaresMatchesPseudoinverse<Eigen::Dynamic, Eigen::Dynamic>(
+      14, 12);
+
+  // Large enough to use BDCSVD.
+  testSolveLeastSquaresMatchesPseudoinverse<Eigen::Dynamic, Eigen::Dynamic>(
+      30, 40);
+}
+
+TEST(PseudoInverse, SolveDampedLeastSquares)
+{
+  const double damping = 0.1;
+  LeastSquaresWorkspace<> workspace;
+
+  // Wide and tall matrices use different normal equations.
+  for (const auto& size :
+       {std::make_pair(6, 7), std::make_pair(7, 6), std::make_pair(6, 6)})
+  {
+    const Eigen::MatrixXd mat
+        = Eigen::MatrixXd::Random(size.first, size.second);
+    const Eigen::VectorXd rhs = Eigen::VectorXd::Random(size.first);
+
+    Eigen::VectorXd solution;
+    solveDampedLeastSquares(mat, rhs, damping, solution, workspace);
+
+    const Eigen::MatrixXd identity
+        = Eigen::MatrixXd::Identity(size.second, size.second);
+    const Eigen::VectorXd expected
+        = (mat.transpose() * mat + damping * damping * identity)
+              .ldlt()
+              .solve(mat.transpose() * rhs);
+    EXPECT_TRUE(solution.isApprox(expected, 1e-8));
+  }
+}
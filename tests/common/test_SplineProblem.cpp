@@ -72,3 +72,69 @@ TEST_F(SplineProblemTests, fit_ContinuityConstraints)
   EXPECT_EIGEN_EQUAL(coefficients2, spline.getCoefficients()[1], EPSILON);
 #endif
 }
+
+TEST_F(SplineProblemTests, fitLinearSegment_MatchesSplineProblem)
+{
+  const double duration = 1.5;
+  const Eigen::VectorXd startValue = make_vector(1., -2.);
+  const Eigen::VectorXd endValue = make_vector(4., 3.);
+
+  SplineProblem problem(make_vector(0., duration), 2, 2);
+  problem.addConstantConstraint(0, 0, startValue);
+  problem.addConstantConstraint(1, 0, endValue);
+  const auto expected = problem.fit().getCoefficients().front();
+
+  const auto coefficients
+      = aikido::common::fitLinearSegment(startValue, endValue, duration);
+  EXPECT_EIGEN_EQUAL(expected, coefficients, EPSILON);
+}
+
+TEST_F(SplineProblemTests, fitCubicSegment_MatchesSplineProblem)
+{
+  const double duration = 1.5;
+  const Eigen::VectorXd startValue = make_vector(1., -2.);
+  const Eigen::VectorXd startVelocity = make_vector(0.5, 0.);
+  const Eigen::VectorXd endValue = make_vector(4., 3.);
+  const Eigen::VectorXd endVelocity = make_vector(-1., 2.);
+
+  SplineProblem problem(make_vector(0., duration), 4, 2);
+  problem.addConstantConstraint(0, 0, startValue);
+  problem.addConstantConstraint(0, 1, startVelocity);
+  problem.addConstantConstraint(1, 0, endValue);
+  problem.addConstantConstraint(1, 1, endVelocity);
+  const auto expected = problem.fit().getCoefficients().front();
+
+  const auto coefficients = aikido::common::fitCubicSegment(
+      startValue, startVelocity, endValue, endVelocity, duration);
+  EXPECT_EIGEN_EQUAL(expected, coefficients, EPSILON);
+}
+
+TEST_F(SplineProblemTests, fitQuinticSegment_MatchesSplineProblem)
+{
+  const double duration = 1.5;
+  const Eigen::VectorXd startValue = make_vector(1., -2.);
+  const Eigen::VectorXd startVelocity = make_vector(0.5, 0.);
+  const Eigen::VectorXd startAcceleration = make_vector(2., -1.);
+  const Eigen::VectorXd endValue = make_vector(4., 3.);
+  const Eigen::VectorXd endVelocity = make_vector(-1., 2.);
+  const Eigen::VectorXd endAcceleration = make_vector(0., 3.);
+
+  SplineProblem problem(make_vector(0., duration), 6, 2);
+  problem.addConstantConstraint(0, 0, startValue);
+  problem.addConstantConstraint(0, 1, startVelocity);
+  problem.addConstantConstraint(0, 2, startAcceleration);
+  problem.addConstantConstraint(1, 0, endValue);
+  problem.addConstantConstraint(1, 1, endVelocity);
+  problem.addConstantConstraint(1, 2, endAcceleration);
+  const auto expected = problem.fit().getCoefficients().front();
+
+  const auto coefficients = aikido::common::fitQuinticSegment(
+      startValue,
+      startVelocity,
+      startAcceleration,
+      endValue,
+      endVelocity,
+      endAcceleration,
+      duration);
+  EXPECT_EIGEN_EQUAL(expected, coefficients, EPSILON);
+}
@@ -0,0 +1,49 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <aikido/common/ThreadPool.hpp>
+
+using aikido::common::ThreadPool;
+
+//==============================================================================
+TEST(ThreadPool, ThrowsOnZeroThreads)
+{
+  EXPECT_THROW(ThreadPool(0), std::invalid_argument);
+}
+
+//==============================================================================
+TEST(ThreadPool, ReturnsResults)
+{
+  ThreadPool pool(4);
+  EXPECT_EQ(4u, pool.getNumThreads());
+
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; ++i)
+    results.emplace_back(pool.submit([i]() { return i * i; }));
+
+  for (int i = 0; i < 100; ++i)
+    EXPECT_EQ(i * i, results[i].get());
+}
+
+//==============================================================================
+TEST(ThreadPool, PropagatesExceptions)
+{
+  ThreadPool pool(2);
+  auto result = pool.submit([]() { throw std::runtime_error("failure"); });
+  EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+//==============================================================================
+TEST(ThreadPool, DestructorRunsQueuedTasks)
+{
+  std::atomic<int> count(0);
+  {
+    ThreadPool pool(1);
+    for (int i = 0; i < 10; ++i)
+      pool.submit([&count]() { ++count; });
+  }
+  EXPECT_EQ(10, count.load());
+}
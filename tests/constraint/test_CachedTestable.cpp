@@ -0,0 +1,174 @@
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <aikido/constraint/CachedTestable.hpp>
+#include <aikido/statespace/Rn.hpp>
+
+using aikido::constraint::CachedTestable;
+using aikido::constraint::DefaultTestableOutcome;
+using aikido::constraint::Testable;
+using aikido::constraint::TestableOutcome;
+using aikido::statespace::R1;
+using aikido::statespace::StateSpace;
+
+using Vector1d = Eigen::Matrix<double, 1, 1>;
+
+/// Satisfied by non-negative values; counts how often it is evaluated.
+class CountingConstraint : public Testable
+{
+public:
+  explicit CountingConstraint(std::shared_ptr<const R1> stateSpace)
+    : mStateSpace(std::move(stateSpace)), mNumCalls(0)
+  {
+  }
+
+  bool isSatisfied(
+      const StateSpace::State* state,
+      TestableOutcome* /*outcome*/ = nullptr) const override
+  {
+    ++mNumCalls;
+    return mStateSpace->getValue(static_cast<const R1::State*>(state))[0]
+           >= 0.;
+  }
+
+  aikido::statespace::ConstStateSpacePtr getStateSpace() const override
+  {
+    return mStateSpace;
+  }
+
+  std::unique_ptr<TestableOutcome> createOutcome() const override
+  {
+    return std::unique_ptr<TestableOutcome>(new DefaultTestableOutcome);
+  }
+
+  std::shared_ptr<const R1> mStateSpace;
+  mutable std::size_t mNumCalls;
+};
+
+class CachedTestableTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    mStateSpace = std::make_shared<R1>();
+    mConstraint = std::make_shared<CountingConstraint>(mStateSpace);
+  }
+
+  const StateSpace::State* createState(double value)
+  {
+    mStates.emplace_back(mStateSpace->createState());
+    mStates.back().setValue(Vector1d(value));
+    return mStates.back().getState();
+  }
+
+  std::shared_ptr<R1> mStateSpace;
+  std::shared_ptr<CountingConstraint> mConstraint;
+  std::vector<R1::ScopedState> mStates;
+};
+
+TEST_F(CachedTestableTest, ConstructorThrowsOnInvalidArguments)
+{
+  EXPECT_THROW(CachedTestable(nullptr, 0.1, 10), std::invalid_argument);
+  EXPECT_THROW(CachedTestable(mConstraint, 0., 10), std::invalid_argument);
+  EXPECT_THROW(CachedTestable(mConstraint, 0.1, 0), std::invalid_argument);
+}
+
+TEST_F(CachedTestableTest, IsSatisfiedCachesResults)
+{
+  CachedTestable cached(mConstraint, 0.1, 10);
+  EXPECT_EQ(mStateSpace, cached.getStateSpace());
+
+  EXPECT_TRUE(cached.isSatisfied(createState(1.0)));
+  EXPECT_FALSE(cached.isSatisfied(createState(-1.0)));
+  EXPECT_EQ(2u, mConstraint->mNumCalls);
+
+  // Rounds to the same grid cell as 1.0.
+  EXPECT_TRUE(cached.isSatisfied(createState(1.01)));
+  EXPECT_FALSE(cached.isSatisfied(createState(-1.0)));
+  EXPECT_EQ(2u, mConstraint->mNumCalls);
+
+  EXPECT_EQ(2u, cached.getSize());
+  EXPECT_EQ(2u, cached.getNumHits());
+  EXPECT_EQ(2u, cached.getNumMisses());
+
+  cached.clear();
+  EXPECT_EQ(0u, cached.getSize());
+  EXPECT_EQ(0u, cached.getNumHits());
+  EXPECT_EQ(0u, cached.getNumMisses());
+}
+
+TEST_F(CachedTestableTest, IsSatisfiedBypassesCacheForOutcome)
+{
+  CachedTestable cached(mConstraint, 0.1, 10);
+  auto outcome = cached.createOutcome();
+
+  cached.isSatisfied(createState(1.0), outcome.get());
+  cached.isSatisfied(createState(1.0), outcome.get());
+  EXPECT_EQ(2u, mConstraint->mNumCalls);
+  EXPECT_EQ(0u, cached.getSize());
+}
+
+TEST_F(CachedTestableTest, EvictsLeastRecentlyUsed)
+{
+  CachedTestable cached(mConstraint, 0.1, 2);
+
+  auto state1 = createState(1.0);
+  auto state2 = createState(2.0);
+  auto state3 = createState(3.0);
+
+  cached.isSatisfied(state1);
+  cached.isSatisfied(state2);
+  cached.isSatisfied(state1);
+  cached.isSatisfied(state3); // Evicts state2.
+  EXPECT_EQ(3u, mConstraint->mNumCalls);
+  EXPECT_EQ(2u, cached.getSize());
+
+  cached.isSatisfied(state1);
+  EXPECT_EQ(3u, mConstraint->mNumCalls);
+
+  cached.isSatisfied(state2);
+  EXPECT_EQ(4u, mConstraint->mNumCalls);
+}
+
+TEST_F(CachedTestableTest, VersionChangeInvalidatesCache)
+{
+  std::size_t version = 0;
+  CachedTestable cached(
+      mConstraint, 0.1, 10, [&version]() { return version; });
+
+  auto state = createState(1.0);
+  cached.isSatisfied(state);
+  cached.isSatisfied(state);
+  EXPECT_EQ(1u, mConstraint->mNumCalls);
+
+  ++version;
+  cached.isSatisfied(state);
+  EXPECT_EQ(2u, mConstraint->mNumCalls);
+}
+
+TEST_F(CachedTestableTest, IsSatisfiedBatch)
+{
+  CachedTestable cached(mConstraint, 0.1, 10);
+  EXPECT_FALSE(cached.isSatisfied(createState(-2.0)));
+
+  std::vector<const StateSpace::State*> batch{
+      createState(1.0), createState(-2.0), createState(3.0)};
+  std::vector<bool> out;
+
+  // The cached failure ends the batch before anything is evaluated.
+  EXPECT_FALSE(cached.isSatisfiedBatch(
+      batch, out, Testable::BatchMode::FirstFailure));
+  EXPECT_EQ(std::vector<bool>({true, false, false}), out);
+  EXPECT_EQ(2u, mConstraint->mNumCalls);
+
+  EXPECT_FALSE(
+      cached.isSatisfiedBatch(batch, out, Testable::BatchMode::AllResults));
+  EXPECT_EQ(std::vector<bool>({true, false, true}), out);
+  EXPECT_EQ(3u, mConstraint->mNumCalls);
+
+  batch.erase(batch.begin() + 1);
+  EXPECT_TRUE(cached.isSatisfiedBatch(batch, out));
+  EXPECT_EQ(std::vector<bool>({true, true}), out);
+  EXPECT_EQ(3u, mConstraint->mNumCalls);
+}
@@ -228,3 +228,70 @@ TEST_F(CollisionFreeTest, AddAndRemoveSelfCheckFails_IsSatisfied)
   constraint.removeSelfCheck(mCollisionGroup3);
   EXPECT_TRUE(constraint.isSatisfied(state));
 }
+
+TEST_F(CollisionFreeTest, IsSatisfiedBatch)
+{
+  CollisionFree constraint(mStateSpace, mSkeleton, mCollisionDetector);
+  constraint.addPairwiseCheck(mCollisionGroup1, mCollisionGroup2);
+
+  Eigen::VectorXd farPosition(Eigen::VectorXd::Zero(7));
+  farPosition(4) = 5;
+  const Eigen::VectorXd nearPosition(Eigen::VectorXd::Zero(7));
+
+  std::vector<MetaSkeletonStateSpace::ScopedState> states;
+  std::vector<const aikido::statespace::StateSpace::State*> batch;
+  for (const auto& position : {farPosition, nearPosition, farPosition})
+  {
+    states.emplace_back(mStateSpace->createState());
+    mStateSpace->convertPositionsToState(position, states.back());
+  }
+  for (const auto& state : states)
+    batch.emplace_back(state.getState());
+
+  std::vector<bool> out;
+  EXPECT_FALSE(constraint.isSatisfiedBatch(
+      batch, out, CollisionFree::BatchMode::AllResults));
+  EXPECT_EQ(std::vector<bool>({true, false, true}), out);
+
+  EXPECT_FALSE(constraint.isSatisfiedBatch(
+      batch, out, CollisionFree::BatchMode::FirstFailure));
+  EXPECT_EQ(std::vector<bool>({true, false, false}), out);
+
+  batch.erase(batch.begin() + 1);
+  EXPECT_TRUE(constraint.isSatisfiedBatch(batch, out));
+  EXPECT_EQ(std::vector<bool>({true, true}), out);
+}
+
+TEST_F(CollisionFreeTest, IsSatisfiedBatchMatchesIsSatisfied)
+{
+  CollisionFree constraint(mStateSpace, mSkeleton, mCollisionDetector);
+  constraint.addSelfCheck(mCollisionGroup1);
+  constraint.addPairwiseCheck(mCollisionGroup1, mCollisionGroup2);
+  constraint.addSelfCheck(mCollisionGroup3);
+
+  std::vector<MetaSkeletonStateSpace::ScopedState> states;
+  std::vector<const aikido::statespace::StateSpace::State*> batch;
+  for (double x : {5.0, 0.0, 5.0, 0.1, 3.0})
+  {
+    Eigen::VectorXd position(Eigen::VectorXd::Zero(7));
+    position(4) = x;
+
+    states.emplace_back(mStateSpace->createState());
+    mStateSpace->convertPositionsToState(position, states.back());
+  }
+  for (const auto& state : states)
+    batch.emplace_back(state.getState());
+
+  // Run the batch twice, so that the second one starts from the check that
+  // found the last collision.
+  std::vector<bool> out;
+  for (int i = 0; i < 2; ++i)
+  {
+    EXPECT_FALSE(constraint.isSatisfiedBatch(
+        batch, out, CollisionFree::BatchMode::AllResults));
+    ASSERT_EQ(batch.size(), out.size());
+    for (std::size_t j = 0; j < batch.size(); ++j)
+      EXPECT_EQ(constraint.isSatisfied(batch[j]), out[j]);
+  }
+  EXPECT_EQ(std::vector<bool>({true, false, true, false, true}), out);
+}
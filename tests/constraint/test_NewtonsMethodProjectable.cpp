@@ -64,6 +64,15 @@ TEST(NewtonsMethodProjectableTest, ConstructorThrowsOnNegativeStepsize)
       std::invalid_argument);
 }
 
+TEST(NewtonsMethodProjectableTest, ConstructorThrowsOnNegativeDamping)
+{
+  auto ss = std::make_shared<R3>();
+  auto constraint = std::make_shared<Satisfied>(ss); // dimension = 0
+  EXPECT_THROW(
+      NewtonsMethodProjectable(constraint, std::vector<double>(), 1, 1, -0.1),
+      std::invalid_argument);
+}
+
 TEST(NewtonsMethodProjectable, Constructor)
 {
   // Constraint: x^2 - 1 = 0.
@@ -211,3 +220,80 @@ TEST(NewtonsMethodProjectable, ProjectTSRRotation)
 
   EXPECT_TRUE(expected.isApprox(projected, 5e-4));
 }
+
+TEST(NewtonsMethodProjectable, ProjectTSRTranslationWithDamping)
+{
+  std::shared_ptr<TSR> tsr = std::make_shared<TSR>();
+
+  // non-trivial translation bounds
+  Eigen::MatrixXd Bw = Eigen::Matrix<double, 6, 2>::Zero();
+  Bw(0, 0) = 1;
+  Bw(0, 1) = 2;
+
+  tsr->mBw = Bw;
+
+  auto space = tsr->getSE3();
+
+  auto seedState = space->createState();
+
+  Eigen::Isometry3d isometry = Eigen::Isometry3d::Identity();
+  isometry.translation() = Eigen::Vector3d(-1, 0, 1);
+  seedState.setIsometry(isometry);
+
+  NewtonsMethodProjectable projector(
+      tsr, std::vector<double>(6, 1e-4), 1000, 1e-8, 1e-3);
+
+  auto out = space->createState();
+  EXPECT_TRUE(projector.project(seedState, out));
+  auto projected = space->getIsometry(out);
+
+  Eigen::Isometry3d expected = Eigen::Isometry3d::Identity();
+  expected.translation() = Eigen::Vector3d(1, 0, 0);
+
+  EXPECT_TRUE(expected.isApprox(projected, 5e-4));
+}
+
+TEST(NewtonsMethodProjectable, ProjectInPlace)
+{
+  // Constraint: x^2 - 1 = 0.
+  NewtonsMethodProjectable projector(
+      std::make_shared<PolynomialConstraint<1>>(Eigen::Vector3d(-1, 0, 1)),
+      std::vector<double>({1e-6}),
+      10,
+      1e-8);
+
+  R1 rvss;
+  auto state = rvss.createState();
+  state.setValue(Eigen::VectorXd::Constant(1, 1.5));
+
+  EXPECT_TRUE(projector.project(state));
+  EXPECT_NEAR(1., rvss.getValue(state)(0), 1e-5);
+}
+
+TEST(NewtonsMethodProjectable, WarmStartReusesPreviousCorrection)
+{
+  // Constraint: x^2 - 1 = 0. Newton's method needs five iterations to
+  // project x = 3 and six to project x = 6.
+  auto constraint
+      = std::make_shared<PolynomialConstraint<1>>(Eigen::Vector3d(-1, 0, 1));
+
+  NewtonsMethodProjectable coldProjector(
+      constraint, std::vector<double>({1e-6}), 5, 1e-8);
+  NewtonsMethodProjectable warmProjector(
+      constraint, std::vector<double>({1e-6}), 5, 1e-8, 0.0, true);
+
+  R1 rvss;
+  auto seedState = rvss.createState();
+  auto out = rvss.createState();
+
+  seedState.setValue(Eigen::VectorXd::Constant(1, 3));
+  EXPECT_TRUE(coldProjector.project(seedState, out));
+  EXPECT_TRUE(warmProjector.project(seedState, out));
+  EXPECT_NEAR(1., rvss.getValue(out)(0), 1e-5);
+
+  // The warm-started projection starts from x = 6 - 2 = 4 instead.
+  seedState.setValue(Eigen::VectorXd::Constant(1, 6));
+  EXPECT_FALSE(coldProjector.project(seedState, out));
+  EXPECT_TRUE(warmProjector.project(seedState, out));
+  EXPECT_NEAR(1., rvss.getValue(out)(0), 1e-5);
+}
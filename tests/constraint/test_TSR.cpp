@@ -361,6 +361,70 @@ TEST(TSR, GetJacobian)
   EXPECT_TRUE(jacobian.isApprox(expected, 1e-3));
 }
 
+TEST(TSR, GetJacobian_MatchesFiniteDifferences)
+{
+  using Eigen::Isometry3d;
+  using Eigen::Vector3d;
+
+  // Sample poses far from gimbal lock and from the angle wrap-around so that
+  // the distance is differentiable.
+  auto randomPose = [](double maxAngle) {
+    const Vector3d angles = maxAngle * Vector3d::Random();
+    Isometry3d pose(Isometry3d::Identity());
+    pose.linear() = ::dart::math::eulerZYXToMatrix(angles);
+    pose.translation() = Vector3d::Random();
+    return pose;
+  };
+
+  static constexpr double eps = 1e-6;
+
+  for (int trial = 0; trial < 50; ++trial)
+  {
+    Eigen::MatrixXd Bw = Eigen::Matrix<double, 6, 2>::Zero();
+    Bw.col(0) = -0.2 * Eigen::Vector6d::Random().cwiseAbs();
+    Bw.col(1) = 0.2 * Eigen::Vector6d::Random().cwiseAbs();
+
+    const Isometry3d T0_w = randomPose(0.3);
+    const Isometry3d Tw_e = randomPose(0.3);
+    TSR tsr(T0_w, Bw, Tw_e);
+
+    const Isometry3d Tw_s = randomPose(1.);
+    auto state = tsr.getSE3()->createState();
+    state.setIsometry(T0_w * Tw_s * Tw_e);
+
+    Eigen::MatrixXd jacobian;
+    tsr.getJacobian(state, jacobian);
+    ASSERT_EQ(6, jacobian.rows());
+    ASSERT_EQ(6, jacobian.cols());
+
+    const Eigen::Vector6d twist = ::dart::math::logMap(state.getIsometry());
+    auto perturbed = tsr.getSE3()->createState();
+    Eigen::MatrixXd expected(6, 6);
+
+    for (int i = 0; i < 6; ++i)
+    {
+      Eigen::VectorXd positValue, negatValue;
+
+      Eigen::Vector6d posit(twist);
+      posit(i) += eps;
+      perturbed.setIsometry(::dart::math::expMap(posit));
+      tsr.getValue(perturbed, positValue);
+
+      Eigen::Vector6d negat(twist);
+      negat(i) -= eps;
+      perturbed.setIsometry(::dart::math::expMap(negat));
+      tsr.getValue(perturbed, negatValue);
+
+      expected.col(i) = (positValue - negatValue) / (2 * eps);
+    }
+
+    EXPECT_TRUE((jacobian - expected).cwiseAbs().maxCoeff() < 1e-5)
+        << "analytic:\n"
+        << jacobian << "\nfinite differences:\n"
+        << expected;
+  }
+}
+
 TEST(TSR, GetValueAndJacobian)
 {
   TSR tsr;
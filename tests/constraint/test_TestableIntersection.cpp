@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <aikido/constraint/TestableIntersection.hpp>
+#include <aikido/constraint/uniform/RnBoxConstraint.hpp>
 #include <aikido/statespace/Rn.hpp>
 #include <aikido/statespace/SO2.hpp>
 
@@ -10,7 +11,11 @@
 
 using aikido::constraint::Testable;
 using aikido::constraint::TestableIntersection;
+using aikido::constraint::uniform::R1BoxConstraint;
 using aikido::statespace::R0;
+using aikido::statespace::R1;
+
+using Vector1d = Eigen::Matrix<double, 1, 1>;
 
 TEST(ConjuntionConstraintTest, ThrowOnNullStateSpace)
 {
@@ -101,3 +106,63 @@ TEST(TestableIntersectionTest, ThrowIfDifferentStateSpaceConstraintAdded)
   TestableIntersection cc{ss1};
   EXPECT_THROW(cc.addConstraint(ss2C), std::invalid_argument);
 }
+
+class TestableIntersectionBatchTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    mStateSpace = std::make_shared<R1>();
+
+    // Satisfied on [1, 2].
+    auto lower = std::make_shared<const R1BoxConstraint>(
+        mStateSpace, nullptr, Vector1d(0.), Vector1d(2.));
+    auto upper = std::make_shared<const R1BoxConstraint>(
+        mStateSpace, nullptr, Vector1d(1.), Vector1d(3.));
+    mIntersection = std::make_shared<TestableIntersection>(
+        mStateSpace,
+        std::vector<std::shared_ptr<const Testable>>({lower, upper}));
+  }
+
+  std::vector<const aikido::statespace::StateSpace::State*> createBatch(
+      const std::vector<double>& values)
+  {
+    std::vector<const aikido::statespace::StateSpace::State*> batch;
+    for (const double value : values)
+    {
+      mStates.emplace_back(mStateSpace->createState());
+      mStates.back().setValue(Vector1d(value));
+      batch.emplace_back(mStates.back().getState());
+    }
+    return batch;
+  }
+
+  std::shared_ptr<R1> mStateSpace;
+  std::shared_ptr<TestableIntersection> mIntersection;
+  std::vector<R1::ScopedState> mStates;
+};
+
+TEST_F(TestableIntersectionBatchTest, AllResults)
+{
+  auto batch = createBatch({0.5, 1.5, 2.5, 1.2});
+
+  std::vector<bool> out;
+  EXPECT_FALSE(mIntersection->isSatisfiedBatch(
+      batch, out, Testable::BatchMode::AllResults));
+  EXPECT_EQ(std::vector<bool>({false, true, false, true}), out);
+}
+
+TEST_F(TestableIntersectionBatchTest, FirstFailure)
+{
+  auto batch = createBatch({1.5, 1.2, 2.5, 0.5, 1.8});
+
+  std::vector<bool> out;
+  EXPECT_FALSE(mIntersection->isSatisfiedBatch(
+      batch, out, Testable::BatchMode::FirstFailure));
+  EXPECT_EQ(std::vector<bool>({true, true, false, false, false}), out);
+
+  batch.resize(2);
+  EXPECT_TRUE(mIntersection->isSatisfiedBatch(
+      batch, out, Testable::BatchMode::FirstFailure));
+  EXPECT_EQ(std::vector<bool>({true, true}), out);
+}
@@ -0,0 +1,212 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include <dart/dart.hpp>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include <aikido/io/AssetCache.hpp>
+#include <aikido/io/KinBodyParser.hpp>
+
+#define STR_EXPAND(tok) #tok
+#define STR(tok) STR_EXPAND(tok)
+
+using aikido::io::clearAssetCache;
+using aikido::io::loadMeshShape;
+using aikido::io::readKinbody;
+using aikido::io::readKinbodyString;
+using dart::common::LocalResourceRetriever;
+
+static std::string TEST_RESOURCES_PATH = STR(AIKIDO_TEST_RESOURCES_PATH);
+
+/// Resolves every URI to the same local file.
+class SingleFileRetriever : public dart::common::ResourceRetriever
+{
+public:
+  explicit SingleFileRetriever(const std::string& path)
+    : mUri(dart::common::Uri::createFromPath(path))
+  {
+    // Do nothing
+  }
+
+  bool exists(const dart::common::Uri& /*uri*/) override
+  {
+    return mDelegate.exists(mUri);
+  }
+
+  dart::common::ResourcePtr retrieve(
+      const dart::common::Uri& /*uri*/) override
+  {
+    return mDelegate.retrieve(mUri);
+  }
+
+#if DART_VERSION_AT_LEAST(6, 10, 0)
+  std::string getFilePath(const dart::common::Uri& /*uri*/) override
+  {
+    return mDelegate.getFilePath(mUri);
+  }
+#endif
+
+private:
+  dart::common::Uri mUri;
+  LocalResourceRetriever mDelegate;
+};
+
+//==============================================================================
+TEST(AssetCache, LoadMeshShapeSharesMeshes)
+{
+  const auto retriever = std::make_shared<LocalResourceRetriever>();
+  const dart::common::Uri meshUri
+      = "file://" + TEST_RESOURCES_PATH + "/kinbody/objects/bowl.stl";
+
+  const Eigen::Vector3d scale = Eigen::Vector3d::Ones();
+  const auto shape1 = loadMeshShape(meshUri, scale, retriever);
+  const auto shape2 = loadMeshShape(meshUri, scale, retriever);
+  const auto scaledShape
+      = loadMeshShape(meshUri, Eigen::Vector3d::Constant(0.5), retriever);
+  ASSERT_NE(nullptr, shape1);
+  ASSERT_NE(nullptr, scaledShape);
+  EXPECT_EQ(shape1, shape2);
+  EXPECT_NE(shape1, scaledShape);
+
+  clearAssetCache();
+  const auto shape3 = loadMeshShape(meshUri, scale, retriever);
+  ASSERT_NE(nullptr, shape3);
+  EXPECT_NE(shape1, shape3);
+
+  const dart::common::Uri missingUri
+      = "file://" + TEST_RESOURCES_PATH + "/kinbody/objects/missing.stl";
+  EXPECT_EQ(nullptr, loadMeshShape(missingUri, scale, retriever));
+}
+
+//==============================================================================
+TEST(AssetCache, LoadMeshShapeReloadsModifiedFile)
+{
+  const auto retriever = std::make_shared<LocalResourceRetriever>();
+  const std::string fileName = "test_asset_cache.stl";
+  {
+    std::ifstream source(
+        TEST_RESOURCES_PATH + "/kinbody/objects/bowl.stl", std::ios::binary);
+    std::ofstream copy(fileName, std::ios::binary);
+    copy << source.rdbuf();
+  }
+
+  char* cwd = getcwd(nullptr, 0);
+  const dart::common::Uri meshUri
+      = "file://" + std::string(cwd) + "/" + fileName;
+  std::free(cwd);
+
+  const Eigen::Vector3d scale = Eigen::Vector3d::Ones();
+  const auto shape1 = loadMeshShape(meshUri, scale, retriever);
+  ASSERT_NE(nullptr, shape1);
+
+  // Move the modification time into the past.
+  struct utimbuf times;
+  times.actime = 1000000000;
+  times.modtime = 1000000000;
+  ASSERT_EQ(0, utime(fileName.c_str(), &times));
+
+  const auto shape2 = loadMeshShape(meshUri, scale, retriever);
+  ASSERT_NE(nullptr, shape2);
+  EXPECT_NE(shape1, shape2);
+  EXPECT_EQ(shape2, loadMeshShape(meshUri, scale, retriever));
+
+  // Modifications within the same second are detected as well.
+  struct timespec preciseTimes[2];
+  preciseTimes[0].tv_sec = 1000000000;
+  preciseTimes[0].tv_nsec = 500000000;
+  preciseTimes[1] = preciseTimes[0];
+  ASSERT_EQ(0, utimensat(AT_FDCWD, fileName.c_str(), preciseTimes, 0));
+
+  const auto shape3 = loadMeshShape(meshUri, scale, retriever);
+  ASSERT_NE(nullptr, shape3);
+  EXPECT_NE(shape2, shape3);
+
+  std::remove(fileName.c_str());
+}
+
+#if DART_VERSION_AT_LEAST(6, 10, 0)
+//==============================================================================
+TEST(AssetCache, LoadMeshShapeKeysOnResolvedFile)
+{
+  const auto bowlRetriever = std::make_shared<SingleFileRetriever>(
+      TEST_RESOURCES_PATH + "/kinbody/objects/bowl.stl");
+  const auto toolRetriever = std::make_shared<SingleFileRetriever>(
+      TEST_RESOURCES_PATH + "/kinbody/objects/kinova_tool.stl");
+  const dart::common::Uri meshUri = "mesh://object";
+
+  const Eigen::Vector3d scale = Eigen::Vector3d::Ones();
+  const auto bowl = loadMeshShape(meshUri, scale, bowlRetriever);
+  const auto tool = loadMeshShape(meshUri, scale, toolRetriever);
+  ASSERT_NE(nullptr, bowl);
+  ASSERT_NE(nullptr, tool);
+  EXPECT_NE(bowl, tool);
+  EXPECT_EQ(bowl, loadMeshShape(meshUri, scale, bowlRetriever));
+
+  // A different URI that resolves to the same file shares the mesh.
+  const auto retriever = std::make_shared<LocalResourceRetriever>();
+  EXPECT_EQ(
+      bowl,
+      loadMeshShape(
+          "file://" + TEST_RESOURCES_PATH + "/kinbody/objects/bowl.stl",
+          scale,
+          retriever));
+}
+#endif
+
+//==============================================================================
+TEST(AssetCache, LoadMeshShapeDoesNotKeepMeshesAlive)
+{
+  const auto retriever = std::make_shared<LocalResourceRetriever>();
+  const dart::common::Uri meshUri
+      = "file://" + TEST_RESOURCES_PATH + "/kinbody/objects/bowl.stl";
+  const Eigen::Vector3d scale = Eigen::Vector3d::Ones();
+
+  const std::weak_ptr<dart::dynamics::MeshShape> unused
+      = loadMeshShape(meshUri, scale, retriever);
+  EXPECT_TRUE(unused.expired());
+
+  const auto shape = loadMeshShape(meshUri, scale, retriever);
+  ASSERT_NE(nullptr, shape);
+  EXPECT_EQ(shape, loadMeshShape(meshUri, scale, retriever));
+}
+
+//==============================================================================
+TEST(AssetCache, KinBodiesShareMeshes)
+{
+  const std::string kinBodyString
+      = "<KinBody name=\"bowl\">                      \n"
+        "  <Body type=\"static\" name=\"bowl\">       \n"
+        "    <Geom type=\"trimesh\">                  \n"
+        "      <Data>kinbody/objects/bowl.stl</Data>  \n"
+        "    </Geom>                                  \n"
+        "  </Body>                                    \n"
+        "</KinBody>                                     ";
+
+  auto skel1 = readKinbodyString(kinBodyString, TEST_RESOURCES_PATH + "/");
+  auto skel2 = readKinbodyString(kinBodyString, TEST_RESOURCES_PATH + "/");
+  ASSERT_NE(nullptr, skel1);
+  ASSERT_NE(nullptr, skel2);
+  EXPECT_EQ(
+      skel1->getBodyNode(0)->getShapeNode(0)->getShape(),
+      skel2->getBodyNode(0)->getShapeNode(0)->getShape());
+
+  const auto uri = std::string("file://") + TEST_RESOURCES_PATH
+                   + std::string("/kinbody/objects/bowl.kinbody.xml");
+  auto skel3 = readKinbody(uri);
+  auto skel4 = readKinbody(uri);
+  ASSERT_NE(nullptr, skel3);
+  ASSERT_NE(nullptr, skel4);
+  EXPECT_NE(skel3, skel4);
+  EXPECT_EQ(skel3->getName(), skel4->getName());
+  EXPECT_EQ(1u, skel4->getNumBodyNodes());
+  EXPECT_EQ(1u, skel4->getBodyNode(0)->getNumShapeNodes());
+
+  // Changing a clone does not change the cached Skeleton.
+  skel3->setName("changed");
+  EXPECT_NE("changed", readKinbody(uri)->getName());
+}
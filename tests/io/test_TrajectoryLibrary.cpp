@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+#include <dart/dart.hpp>
+#include <gtest/gtest.h>
+
+#include <aikido/distance/defaults.hpp>
+#include <aikido/io/TrajectoryLibrary.hpp>
+#include <aikido/statespace/dart/MetaSkeletonStateSpace.hpp>
+#include <aikido/trajectory/Spline.hpp>
+
+using aikido::io::TrajectoryLibrary;
+using aikido::io::saveTrajectoryLibrary;
+using aikido::statespace::dart::MetaSkeletonStateSpace;
+using aikido::trajectory::ConstSplinePtr;
+using aikido::trajectory::Spline;
+
+//==============================================================================
+class TrajectoryLibraryTest : public ::testing::Test
+{
+public:
+  TrajectoryLibraryTest()
+    : skel{dart::dynamics::Skeleton::create("skel")}, rng{0}
+  {
+    using dart::dynamics::RevoluteJoint;
+
+    auto pair = skel->createJointAndBodyNodePair<RevoluteJoint>();
+    skel->createJointAndBodyNodePair<RevoluteJoint>(pair.second);
+    stateSpace = std::make_shared<MetaSkeletonStateSpace>(skel.get());
+  }
+
+  ~TrajectoryLibraryTest()
+  {
+    std::remove(libraryFileName.c_str());
+  }
+
+  Eigen::Vector2d sampleConfiguration()
+  {
+    std::uniform_real_distribution<double> distribution(-M_PI, M_PI);
+    return Eigen::Vector2d(distribution(rng), distribution(rng));
+  }
+
+  // Creates a trajectory with a linear and, if cubic is true, a cubic segment.
+  ConstSplinePtr createTrajectory(
+      const Eigen::Vector2d& start, const Eigen::Vector2d& goal, bool cubic)
+  {
+    auto trajectory = std::make_shared<Spline>(stateSpace, 0.5);
+    auto state = stateSpace->createState();
+    stateSpace->expMap(start, state);
+
+    Eigen::Matrix2d linearCoefficients;
+    linearCoefficients.col(0).setZero();
+    linearCoefficients.col(1) = goal - start;
+    if (!cubic)
+    {
+      trajectory->addSegment(linearCoefficients, 1.0, state);
+      return trajectory;
+    }
+
+    trajectory->addSegment(0.5 * linearCoefficients, 1.0, state);
+    Eigen::MatrixXd cubicCoefficients = Eigen::MatrixXd::Zero(2, 4);
+    cubicCoefficients.col(1) = 0.5 * (goal - start);
+    cubicCoefficients.col(3) = Eigen::Vector2d(0.1, -0.2);
+    trajectory->addSegment(cubicCoefficients, 2.0);
+    return trajectory;
+  }
+
+  dart::dynamics::SkeletonPtr skel;
+  std::shared_ptr<MetaSkeletonStateSpace> stateSpace;
+  std::mt19937 rng;
+  std::string libraryFileName = "test_library.bin";
+};
+
+//==============================================================================
+TEST_F(TrajectoryLibraryTest, SavedMatchesLoaded)
+{
+  std::vector<ConstSplinePtr> trajectories;
+  for (std::size_t i = 0; i < 10; ++i)
+  {
+    trajectories.emplace_back(createTrajectory(
+        sampleConfiguration(), sampleConfiguration(), i % 2 == 0));
+  }
+  saveTrajectoryLibrary(trajectories, libraryFileName);
+
+  TrajectoryLibrary library(libraryFileName, stateSpace);
+  ASSERT_EQ(trajectories.size(), library.getNumTrajectories());
+
+  auto state = stateSpace->createState();
+  Eigen::VectorXd expected(2);
+  Eigen::VectorXd actual(2);
+  for (std::size_t i = 0; i < trajectories.size(); ++i)
+  {
+    const auto& original = trajectories[i];
+    const auto loaded = library.getTrajectory(i);
+
+    EXPECT_EQ(original->getStartTime(), loaded->getStartTime());
+    ASSERT_EQ(original->getNumSegments(), loaded->getNumSegments());
+    for (std::size_t j = 0; j < loaded->getNumSegments(); ++j)
+    {
+      EXPECT_EQ(
+          original->getSegmentCoefficients(j),
+          loaded->getSegmentCoefficients(j));
+      EXPECT_EQ(
+          original->getSegmentDuration(j), loaded->getSegmentDuration(j));
+
+      stateSpace->logMap(original->getSegmentStartState(j), expected);
+      stateSpace->logMap(loaded->getSegmentStartState(j), actual);
+      EXPECT_TRUE(actual.isApprox(expected));
+    }
+
+    original->evaluate(original->getStartTime(), state);
+    stateSpace->logMap(state, expected);
+    stateSpace->logMap(library.getStartState(i), actual);
+    EXPECT_TRUE(actual.isApprox(expected));
+
+    original->evaluate(original->getEndTime(), state);
+    stateSpace->logMap(state, expected);
+    stateSpace->logMap(library.getGoalState(i), actual);
+    EXPECT_TRUE(actual.isApprox(expected));
+  }
+
+  const auto batch = library.getTrajectories({3, 1});
+  ASSERT_EQ(2u, batch.size());
+  EXPECT_EQ(trajectories[3]->getDuration(), batch[0]->getDuration());
+  EXPECT_EQ(trajectories[1]->getDuration(), batch[1]->getDuration());
+
+  EXPECT_THROW(library.getTrajectory(10), std::out_of_range);
+}
+
+//==============================================================================
+TEST_F(TrajectoryLibraryTest, FindNearestMatchesBruteForce)
+{
+  std::vector<ConstSplinePtr> trajectories;
+  for (std::size_t i = 0; i < 200; ++i)
+  {
+    trajectories.emplace_back(createTrajectory(
+        sampleConfiguration(), sampleConfiguration(), i % 3 == 0));
+  }
+  saveTrajectoryLibrary(trajectories, libraryFileName);
+
+  auto metric = aikido::distance::createDistanceMetric(stateSpace);
+  TrajectoryLibrary library(libraryFileName, stateSpace, std::move(metric));
+
+  auto bruteForceMetric = aikido::distance::createDistanceMetric(stateSpace);
+  auto startState = stateSpace->createState();
+  auto goalState = stateSpace->createState();
+  const std::size_t numNeighbors = 5;
+  for (std::size_t query = 0; query < 50; ++query)
+  {
+    stateSpace->expMap(sampleConfiguration(), startState);
+    stateSpace->expMap(sampleConfiguration(), goalState);
+
+    std::vector<double> distances;
+    for (std::size_t i = 0; i < library.getNumTrajectories(); ++i)
+    {
+      distances.push_back(
+          bruteForceMetric->distance(startState, library.getStartState(i))
+          + bruteForceMetric->distance(goalState, library.getGoalState(i)));
+    }
+    std::sort(distances.begin(), distances.end());
+
+    const auto neighbors
+        = library.findNearest(startState, goalState, numNeighbors);
+    ASSERT_EQ(numNeighbors, neighbors.size());
+    for (std::size_t i = 0; i < numNeighbors; ++i)
+      EXPECT_DOUBLE_EQ(distances[i], neighbors[i].mDistance);
+  }
+
+  // Each stored trajectory is its own nearest neighbor.
+  for (std::size_t i = 0; i < library.getNumTrajectories(); ++i)
+  {
+    const auto neighbors = library.findNearest(
+        library.getStartState(i), library.getGoalState(i));
+    ASSERT_EQ(1u, neighbors.size());
+    EXPECT_EQ(i, neighbors[0].mIndex);
+    EXPECT_DOUBLE_EQ(0., neighbors[0].mDistance);
+  }
+}
+
+//==============================================================================
+TEST_F(TrajectoryLibraryTest, RejectsInvalidLibraries)
+{
+  EXPECT_THROW(
+      saveTrajectoryLibrary({}, libraryFileName), std::runtime_error);
+  EXPECT_THROW(
+      saveTrajectoryLibrary(
+          {std::make_shared<Spline>(stateSpace)}, libraryFileName),
+      std::runtime_error);
+
+  EXPECT_THROW(
+      TrajectoryLibrary library("does_not_exist.bin", stateSpace),
+      std::runtime_error);
+
+  saveTrajectoryLibrary(
+      {createTrajectory(sampleConfiguration(), sampleConfiguration(), true)},
+      libraryFileName);
+
+  auto otherSkel = skel->cloneSkeleton();
+  otherSkel->getDof(1)->setName("other");
+  auto otherStateSpace
+      = std::make_shared<MetaSkeletonStateSpace>(otherSkel.get());
+  EXPECT_THROW(
+      TrajectoryLibrary library(libraryFileName, otherStateSpace),
+      std::runtime_error);
+}
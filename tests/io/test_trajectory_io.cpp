@@ -1,3 +1,5 @@
+#include <fstream>
+#include <iterator>
 #include <tuple>
 
 #include <dart/dart.hpp>
@@ -18,8 +20,11 @@
 
 #include "../constraint/MockConstraints.hpp"
 
+using aikido::io::convertTrajectoryToBinary;
 using aikido::io::loadSplineTrajectory;
+using aikido::io::loadSplineTrajectoryBinary;
 using aikido::io::saveTrajectory;
+using aikido::io::saveTrajectoryBinary;
 using aikido::planner::ConfigurationToConfiguration;
 using aikido::planner::SnapConfigurationToConfigurationPlanner;
 using aikido::statespace::ConstStateSpacePtr;
@@ -71,6 +76,28 @@ public:
   ~SaveLoadTrajectoryTest()
   {
     std::remove(trajFileName.c_str());
+    std::remove(binaryTrajFileName.c_str());
+  }
+
+  void expectSplinesEqual(
+      const aikido::trajectory::Spline& expected,
+      const aikido::trajectory::Spline& actual)
+  {
+    EXPECT_EQ(expected.getStartTime(), actual.getStartTime());
+    EXPECT_EQ(expected.getDuration(), actual.getDuration());
+    ASSERT_EQ(expected.getNumSegments(), actual.getNumSegments());
+    for (std::size_t i = 0; i < actual.getNumSegments(); ++i)
+    {
+      EXPECT_EQ(
+          expected.getSegmentCoefficients(i), actual.getSegmentCoefficients(i));
+      EXPECT_EQ(expected.getSegmentDuration(i), actual.getSegmentDuration(i));
+
+      Eigen::VectorXd expectedPosition(stateSpace->getDimension());
+      Eigen::VectorXd actualPosition(stateSpace->getDimension());
+      stateSpace->logMap(expected.getSegmentStartState(i), expectedPosition);
+      stateSpace->logMap(actual.getSegmentStartState(i), actualPosition);
+      EXPECT_EQ(expectedPosition, actualPosition);
+    }
   }
 
   SkeletonPtr skel;
@@ -83,6 +110,7 @@ public:
   std::shared_ptr<GeodesicInterpolator> interpolator;
   std::shared_ptr<Interpolated> interpolated;
   std::string trajFileName = "test.yml";
+  std::string binaryTrajFileName = "test.traj";
   SnapConfigurationToConfigurationPlanner::Result planningResult;
 };
 
@@ -117,3 +145,70 @@ TEST_F(SaveLoadTrajectoryTest, SavedMatchesLoaded)
     EXPECT_TRUE(loadedPosition.isApprox(originalPosition));
   }
 }
+
+//==============================================================================
+TEST_F(SaveLoadTrajectoryTest, SavedBinaryMatchesLoaded)
+{
+  auto originalSmoothTrajectory = convertToSpline(*interpolated);
+  saveTrajectoryBinary(*originalSmoothTrajectory, binaryTrajFileName);
+
+  auto loadedSmoothTrajectory
+      = loadSplineTrajectoryBinary(binaryTrajFileName, stateSpace);
+  expectSplinesEqual(*originalSmoothTrajectory, *loadedSmoothTrajectory);
+}
+
+//==============================================================================
+TEST_F(SaveLoadTrajectoryTest, ConvertedBinaryMatchesYaml)
+{
+  auto originalSmoothTrajectory = convertToSpline(*interpolated);
+  saveTrajectory(*originalSmoothTrajectory, trajFileName);
+  convertTrajectoryToBinary(trajFileName, binaryTrajFileName);
+
+  auto yamlSmoothTrajectory = loadSplineTrajectory(trajFileName, stateSpace);
+  auto binarySmoothTrajectory
+      = loadSplineTrajectoryBinary(binaryTrajFileName, stateSpace);
+  expectSplinesEqual(*yamlSmoothTrajectory, *binarySmoothTrajectory);
+}
+
+//==============================================================================
+TEST_F(SaveLoadTrajectoryTest, LoadBinaryRejectsInvalidFiles)
+{
+  auto originalSmoothTrajectory = convertToSpline(*interpolated);
+
+  // A YAML trajectory is not a binary trajectory.
+  saveTrajectory(*originalSmoothTrajectory, trajFileName);
+  EXPECT_THROW(
+      loadSplineTrajectoryBinary(trajFileName, stateSpace),
+      std::runtime_error);
+
+  EXPECT_THROW(
+      loadSplineTrajectoryBinary("does_not_exist.traj", stateSpace),
+      std::runtime_error);
+
+  // Drop the last coefficient.
+  saveTrajectoryBinary(*originalSmoothTrajectory, binaryTrajFileName);
+  std::string contents;
+  {
+    std::ifstream file(binaryTrajFileName, std::ios::binary);
+    contents.assign(
+        std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream file(binaryTrajFileName, std::ios::binary);
+    file.write(contents.data(), contents.size() - sizeof(double));
+  }
+  EXPECT_THROW(
+      loadSplineTrajectoryBinary(binaryTrajFileName, stateSpace),
+      std::runtime_error);
+
+  // Change the order stored in the header.
+  {
+    std::string wrongOrder = contents;
+    wrongOrder[24] = static_cast<char>(wrongOrder[24] + 1);
+    std::ofstream file(binaryTrajFileName, std::ios::binary);
+    file.write(wrongOrder.data(), wrongOrder.size());
+  }
+  EXPECT_THROW(
+      loadSplineTrajectoryBinary(binaryTrajFileName, stateSpace),
+      std::runtime_error);
+}
@@ -367,6 +367,62 @@ TEST_F(KunzRetimerTests, timingArbitraryMultipleWaypoints)
   });
 }
 
+TEST_F(KunzRetimerTests, MergesTimeStepsWithinFittingError)
+{
+  Interpolated inputTrajectory(mStateSpace, mInterpolator);
+
+  auto state = mStateSpace->createState();
+  Eigen::VectorXd positions(2);
+
+  positions << 1, 2;
+  mStateSpace->expMap(positions, state);
+  inputTrajectory.addWaypoint(0., state);
+
+  positions << 3, 4;
+  mStateSpace->expMap(positions, state);
+  inputTrajectory.addWaypoint(1., state);
+
+  positions << 4, 2;
+  mStateSpace->expMap(positions, state);
+  inputTrajectory.addWaypoint(2., state);
+
+  const double maxDeviation = 0.1;
+  const double timeStep = 1e-3;
+  const double maxFittingError = 1e-5;
+  auto denseTrajectory = computeKunzTiming(
+      inputTrajectory, mMaxVelocity, mMaxAcceleration, maxDeviation, timeStep);
+  auto compactTrajectory = computeKunzTiming(
+      inputTrajectory,
+      mMaxVelocity,
+      mMaxAcceleration,
+      maxDeviation,
+      timeStep,
+      maxFittingError);
+
+  EXPECT_DOUBLE_EQ(
+      denseTrajectory->getDuration(), compactTrajectory->getDuration());
+  EXPECT_LT(
+      10 * compactTrajectory->getNumSegments(),
+      denseTrajectory->getNumSegments());
+
+  Eigen::VectorXd densePositions;
+  Eigen::VectorXd compactPositions;
+  Eigen::VectorXd denseVelocity;
+  Eigen::VectorXd compactVelocity;
+  for (double t = 0.; t <= denseTrajectory->getEndTime(); t += 0.0123)
+  {
+    denseTrajectory->evaluate(t, state);
+    mStateSpace->logMap(state, densePositions);
+    compactTrajectory->evaluate(t, state);
+    mStateSpace->logMap(state, compactPositions);
+    EXPECT_EIGEN_EQUAL(densePositions, compactPositions, 1e-4);
+
+    denseTrajectory->evaluateDerivative(t, 1, denseVelocity);
+    compactTrajectory->evaluateDerivative(t, 1, compactVelocity);
+    EXPECT_EIGEN_EQUAL(denseVelocity, compactVelocity, 1e-3);
+  }
+}
+
 // TODO: Test what happens when two waypoints are coincident.
 // TODO: Add a test for different velocity limits.
 // TODO: Add a test where DOFs have different ramp transition points.
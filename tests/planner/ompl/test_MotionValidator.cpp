@@ -1,6 +1,10 @@
+#include <chrono>
+#include <future>
+
 #include <boost/make_shared.hpp>
 #include <gtest/gtest.h>
 
+#include <aikido/common/ThreadPool.hpp>
 #include <aikido/planner/ompl/GeometricStateSpace.hpp>
 #include <aikido/planner/ompl/MotionValidator.hpp>
 #include <aikido/planner/ompl/StateValidityChecker.hpp>
@@ -130,3 +134,205 @@ TEST_F(MotionValidatorTest, BadValidationSmallResolution)
       = std::make_shared<aikido::planner::ompl::MotionValidator>(si, 0.5);
   EXPECT_TRUE(validator1->checkMotion(state1, state2));
 }
+
+/// Records the size of every batch of states it tests.
+class BatchRecordingConstraint : public MockTranslationalRobotConstraint
+{
+public:
+  using MockTranslationalRobotConstraint::MockTranslationalRobotConstraint;
+
+  bool isSatisfiedBatch(
+      const std::vector<const aikido::statespace::StateSpace::State*>& states,
+      std::vector<bool>& out,
+      BatchMode mode) const override
+  {
+    mBatchSizes.emplace_back(states.size());
+    return Testable::isSatisfiedBatch(states, out, mode);
+  }
+
+  mutable std::vector<std::size_t> mBatchSizes;
+};
+
+TEST_F(MotionValidatorTest, ChecksSamplesInBatches)
+{
+  auto constraint = std::make_shared<BatchRecordingConstraint>(
+      stateSpace,
+      Eigen::Vector3d(-0.1, -0.1, -0.1),
+      Eigen::Vector3d(0.1, 0.1, 0.1));
+  si->setStateValidityChecker(
+      ompl_make_shared<aikido::planner::ompl::StateValidityChecker>(
+          si, constraint));
+
+  setTranslationalState(Eigen::Vector3d(-5, -5, 0), stateSpace, state1);
+  setTranslationalState(Eigen::Vector3d(-5, 5, 0), stateSpace, state2);
+  EXPECT_TRUE(validator->checkMotion(state1, state2));
+
+  std::size_t numSamples = 0;
+  for (const auto batchSize : constraint->mBatchSizes)
+  {
+    EXPECT_LT(0u, batchSize);
+    EXPECT_GE(8u, batchSize);
+    numSamples += batchSize;
+  }
+  EXPECT_LT(100u, numSamples);
+
+  // An edge through the obstacle stops within the chunk of the first
+  // invalid sample.
+  constraint->mBatchSizes.clear();
+  setTranslationalState(Eigen::Vector3d(0, -5, 0), stateSpace, state1);
+  setTranslationalState(Eigen::Vector3d(0, 5, 0), stateSpace, state2);
+  EXPECT_FALSE(validator->checkMotion(state1, state2));
+  EXPECT_EQ(1u, constraint->mBatchSizes.size());
+}
+
+class ParallelMotionValidatorTest : public MotionValidatorTest
+{
+public:
+  void SetUp() override
+  {
+    MotionValidatorTest::SetUp();
+
+    std::vector<aikido::constraint::ConstTestablePtr> workerConstraints;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+      workerConstraints.emplace_back(
+          std::make_shared<MockTranslationalRobotConstraint>(
+              stateSpace,
+              Eigen::Vector3d(-0.1, -0.1, -0.1),
+              Eigen::Vector3d(0.1, 0.1, 0.1)));
+    }
+    validator = std::make_shared<MotionValidator>(
+        si, 0.1, std::move(workerConstraints));
+  }
+};
+
+TEST_F(MotionValidatorTest, ConstructorThrowsOnNullWorkerConstraint)
+{
+  std::vector<aikido::constraint::ConstTestablePtr> workerConstraints{nullptr};
+  EXPECT_THROW(
+      MotionValidator(si, 0.1, workerConstraints), std::invalid_argument);
+}
+
+TEST_F(ParallelMotionValidatorTest, SuccessValidation)
+{
+  setTranslationalState(Eigen::Vector3d(-5, -5, 0), stateSpace, state1);
+  setTranslationalState(Eigen::Vector3d(-5, 5, 0), stateSpace, state2);
+  EXPECT_TRUE(validator->checkMotion(state1, state2));
+}
+
+TEST_F(ParallelMotionValidatorTest, FailedValidation)
+{
+  setTranslationalState(Eigen::Vector3d(-5, -5, 0), stateSpace, state1);
+  setTranslationalState(Eigen::Vector3d(5, 5, 0), stateSpace, state2);
+  EXPECT_FALSE(validator->checkMotion(state1, state2));
+}
+
+TEST_F(ParallelMotionValidatorTest, FailedValidationLastValid)
+{
+  setTranslationalState(Eigen::Vector3d(0, -5, 0), stateSpace, state1);
+  setTranslationalState(Eigen::Vector3d(0, 5, 0), stateSpace, state2);
+
+  std::pair<::ompl::base::State*, double> lastValid;
+  lastValid.first = si->allocState();
+  EXPECT_FALSE(validator->checkMotion(state1, state2, lastValid));
+  EXPECT_DOUBLE_EQ((5 - 0.2) / 10, lastValid.second);
+  EXPECT_TRUE(getTranslationalState(stateSpace, lastValid.first)
+                  .isApprox(Eigen::Vector3d(0, -0.2, 0.)));
+  si->freeState(lastValid.first);
+}
+
+TEST_F(ParallelMotionValidatorTest, ConcurrentCallsShareWorkers)
+{
+  EXPECT_EQ(4u, validator->getNumWorkers());
+
+  // More callers than workers, each checking both a valid and an invalid
+  // segment.
+  std::vector<std::future<bool>> results;
+  for (std::size_t i = 0; i < 6; ++i)
+  {
+    results.emplace_back(std::async(std::launch::async, [this]() {
+      auto s1 = si->allocState();
+      auto s2 = si->allocState();
+      auto s3 = si->allocState();
+      setTranslationalState(Eigen::Vector3d(-5, -5, 0), stateSpace, s1);
+      setTranslationalState(Eigen::Vector3d(-5, 5, 0), stateSpace, s2);
+      setTranslationalState(Eigen::Vector3d(5, 5, 0), stateSpace, s3);
+
+      bool correct = true;
+      for (std::size_t j = 0; j < 20; ++j)
+      {
+        correct = correct && validator->checkMotion(s1, s2);
+        correct = correct && !validator->checkMotion(s1, s3);
+      }
+
+      si->freeState(s1);
+      si->freeState(s2);
+      si->freeState(s3);
+      return correct;
+    }));
+  }
+
+  for (auto& result : results)
+    EXPECT_TRUE(result.get());
+}
+
+TEST_F(MotionValidatorTest, ParallelValidatorsShareThreadPool)
+{
+  auto threadPool = std::make_shared<aikido::common::ThreadPool>(2);
+
+  std::vector<std::shared_ptr<MotionValidator>> validators;
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    std::vector<aikido::constraint::ConstTestablePtr> workerConstraints;
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      workerConstraints.emplace_back(
+          std::make_shared<MockTranslationalRobotConstraint>(
+              stateSpace,
+              Eigen::Vector3d(-0.1, -0.1, -0.1),
+              Eigen::Vector3d(0.1, 0.1, 0.1)));
+    }
+    validators.emplace_back(std::make_shared<MotionValidator>(
+        si, 0.1, std::move(workerConstraints), threadPool));
+  }
+
+  setTranslationalState(Eigen::Vector3d(0, -5, 0), stateSpace, state1);
+  setTranslationalState(Eigen::Vector3d(0, 5, 0), stateSpace, state2);
+
+  for (const auto& parallelValidator : validators)
+  {
+    std::pair<::ompl::base::State*, double> lastValid;
+    lastValid.first = si->allocState();
+    EXPECT_FALSE(parallelValidator->checkMotion(state1, state2, lastValid));
+    EXPECT_DOUBLE_EQ((5 - 0.2) / 10, lastValid.second);
+    si->freeState(lastValid.first);
+  }
+}
+
+TEST_F(MotionValidatorTest, CheckMotionFromThreadPoolThread)
+{
+  auto threadPool = std::make_shared<aikido::common::ThreadPool>(1);
+
+  std::vector<aikido::constraint::ConstTestablePtr> workerConstraints;
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    workerConstraints.emplace_back(
+        std::make_shared<MockTranslationalRobotConstraint>(
+            stateSpace,
+            Eigen::Vector3d(-0.1, -0.1, -0.1),
+            Eigen::Vector3d(0.1, 0.1, 0.1)));
+  }
+  auto parallelValidator = std::make_shared<MotionValidator>(
+      si, 0.1, std::move(workerConstraints), threadPool);
+
+  setTranslationalState(Eigen::Vector3d(-5, -5, 0), stateSpace, state1);
+  setTranslationalState(Eigen::Vector3d(-5, 5, 0), stateSpace, state2);
+
+  // The only thread of the pool runs this check, so none of its helpers can
+  // start until it returns.
+  auto result = threadPool->submit(
+      [&]() { return parallelValidator->checkMotion(state1, state2); });
+  ASSERT_EQ(
+      std::future_status::ready, result.wait_for(std::chrono::seconds(10)));
+  EXPECT_TRUE(result.get());
+}
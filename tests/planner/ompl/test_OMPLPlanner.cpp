@@ -242,6 +242,195 @@ TEST_F(PlannerTest, PlanConstrainedCRRT)
   }
 }
 
+std::vector<CRRT::WorkerConstraints> createWorkerConstraints(
+    const aikido::statespace::dart::ConstMetaSkeletonStateSpacePtr& stateSpace,
+    const aikido::constraint::TestablePtr& validityConstraint,
+    const aikido::constraint::ProjectablePtr& pathConstraint,
+    const aikido::constraint::TestablePtr& goalTestable,
+    std::size_t numWorkers)
+{
+  // The mock constraints are stateless, so only the samplers need to be
+  // created per worker.
+  std::vector<CRRT::WorkerConstraints> workers(numWorkers);
+  for (std::size_t i = 0; i < numWorkers; ++i)
+  {
+    workers[i].validityConstraint = validityConstraint;
+    workers[i].pathConstraint = pathConstraint;
+    workers[i].goalTestable = goalTestable;
+    workers[i].sampler = aikido::constraint::createSampleableBounds(
+        stateSpace, ::aikido::common::make_unique<DefaultRNG>(i));
+  }
+  return workers;
+}
+
+TEST_F(PlannerTest, PlanConstrainedCRRTConnectWithWorkers)
+{
+  double constraintVal = -2;
+  Eigen::Vector3d startPose(constraintVal, -5, 0);
+
+  auto startState = stateSpace->createState();
+  auto subState1 = stateSpace->getSubStateHandle<R3>(startState, 0);
+  subState1.setValue(startPose);
+
+  auto boxConstraint = std::make_shared<aikido::constraint::R3BoxConstraint>(
+      stateSpace->getSubspace<R3>(0),
+      make_rng(),
+      Eigen::Vector3d(constraintVal - 1, 4, 0),
+      Eigen::Vector3d(constraintVal + 1, 5, 0));
+  std::vector<std::shared_ptr<aikido::constraint::Sampleable>> sConstraints;
+  sConstraints.push_back(boxConstraint);
+  aikido::constraint::SampleablePtr goalSampleable
+      = std::make_shared<aikido::constraint::CartesianProductSampleable>(
+          stateSpace, sConstraints);
+  std::vector<std::shared_ptr<const aikido::constraint::Testable>> tConstraints;
+  tConstraints.push_back(boxConstraint);
+  aikido::constraint::TestablePtr goalTestable
+      = std::make_shared<aikido::constraint::CartesianProductTestable>(
+          stateSpace, tConstraints);
+
+  auto trajConstraint = std::make_shared<MockProjectionConstraint>(
+      stateSpace, goalSampleable, constraintVal);
+
+  auto workers = createWorkerConstraints(
+      stateSpace, collConstraint, trajConstraint, goalTestable, 4);
+
+  // Plan
+  auto traj = aikido::planner::ompl::planCRRTConnect(
+      startState,
+      goalTestable,
+      trajConstraint,
+      trajConstraint,
+      stateSpace,
+      interpolator,
+      std::move(dmetric),
+      std::move(sampler),
+      std::move(collConstraint),
+      std::move(boundsConstraint),
+      std::move(boundsProjection),
+      5.0,
+      std::numeric_limits<double>::infinity(),
+      0.1,
+      0.05,
+      0.1,
+      std::move(workers));
+
+  ASSERT_TRUE(traj != nullptr);
+
+  // Check the first waypoint
+  auto s0 = stateSpace->createState();
+  traj->evaluate(0, s0);
+  auto r0 = s0.getSubStateHandle<R3>(0);
+  EXPECT_TRUE(r0.getValue().isApprox(startPose));
+
+  // Check the last waypoint
+  traj->evaluate(traj->getEndTime(), s0);
+  EXPECT_TRUE(goalTestable->isSatisfied(s0));
+
+  // Check all intermediate waypoints adhere to constraint
+  aikido::common::StepSequence seq(
+      0.1, true, true, traj->getStartTime(), traj->getEndTime());
+  for (double t : seq)
+  {
+    traj->evaluate(t, s0);
+    EXPECT_TRUE(trajConstraint->isSatisfied(s0));
+  }
+}
+
+TEST_F(PlannerTest, PlanConstrainedCRRTWithWorkers)
+{
+  double constraintVal = -2;
+  Eigen::Vector3d startPose(constraintVal, -5, 0);
+
+  auto startState = stateSpace->createState();
+  auto subState1 = stateSpace->getSubStateHandle<R3>(startState, 0);
+  subState1.setValue(startPose);
+
+  auto boxConstraint = std::make_shared<aikido::constraint::R3BoxConstraint>(
+      stateSpace->getSubspace<R3>(0),
+      make_rng(),
+      Eigen::Vector3d(constraintVal - 1, 4, 0),
+      Eigen::Vector3d(constraintVal + 1, 5, 0));
+  std::vector<std::shared_ptr<aikido::constraint::Sampleable>> sConstraints;
+  sConstraints.push_back(boxConstraint);
+  aikido::constraint::SampleablePtr goalSampleable
+      = std::make_shared<aikido::constraint::CartesianProductSampleable>(
+          stateSpace, sConstraints);
+  std::vector<std::shared_ptr<const aikido::constraint::Testable>> tConstraints;
+  tConstraints.push_back(boxConstraint);
+  aikido::constraint::TestablePtr goalTestable
+      = std::make_shared<aikido::constraint::CartesianProductTestable>(
+          stateSpace, tConstraints);
+
+  auto trajConstraint = std::make_shared<MockProjectionConstraint>(
+      stateSpace, goalSampleable, constraintVal);
+
+  auto workers = createWorkerConstraints(
+      stateSpace, collConstraint, trajConstraint, goalTestable, 4);
+
+  // Plan
+  auto traj = aikido::planner::ompl::planCRRT(
+      startState,
+      goalTestable,
+      trajConstraint,
+      trajConstraint,
+      stateSpace,
+      interpolator,
+      std::move(dmetric),
+      std::move(sampler),
+      std::move(collConstraint),
+      std::move(boundsConstraint),
+      std::move(boundsProjection),
+      5.0,
+      std::numeric_limits<double>::infinity(),
+      0.1,
+      0.05,
+      std::move(workers));
+
+  ASSERT_TRUE(traj != nullptr);
+
+  // Check the first waypoint
+  auto s0 = stateSpace->createState();
+  traj->evaluate(0, s0);
+  auto r0 = s0.getSubStateHandle<R3>(0);
+  EXPECT_TRUE(r0.getValue().isApprox(startPose));
+
+  // Check the last waypoint
+  traj->evaluate(traj->getEndTime(), s0);
+  EXPECT_TRUE(goalTestable->isSatisfied(s0));
+
+  // Check all intermediate waypoints adhere to constraint
+  aikido::common::StepSequence seq(
+      0.1, true, true, traj->getStartTime(), traj->getEndTime());
+  for (double t : seq)
+  {
+    traj->evaluate(t, s0);
+    EXPECT_TRUE(trajConstraint->isSatisfied(s0));
+  }
+}
+
+TEST_F(PlannerTest, CRRTThrowsOnNullWorkerConstraint)
+{
+  auto si = getSpaceInformation(
+      stateSpace,
+      interpolator,
+      std::move(dmetric),
+      std::move(sampler),
+      collConstraint,
+      std::move(boundsConstraint),
+      boundsProjection,
+      0.1);
+  CRRTConnect crrtConnect(si);
+  EXPECT_EQ(1u, crrtConnect.getNumWorkers());
+
+  auto workers = createWorkerConstraints(
+      stateSpace, collConstraint, boundsProjection, collConstraint, 2);
+  workers[1].pathConstraint = nullptr;
+  EXPECT_THROW(
+      crrtConnect.setWorkerConstraints(std::move(workers)),
+      std::invalid_argument);
+  EXPECT_EQ(1u, crrtConnect.getNumWorkers());
+}
+
 TEST_F(PlannerTest, PlanThrowsOnNullGoalTestable)
 {
   auto startState = stateSpace->createState();
@@ -668,3 +857,115 @@ TEST_F(PlannerTest, GetSpaceInformationCreatesMotionValidator)
           si->getMotionValidator());
   EXPECT_FALSE(mvalidator == nullptr);
 }
+
+TEST_F(PlannerTest, GetSpaceInformationCreatesParallelMotionValidator)
+{
+  std::vector<aikido::constraint::TestablePtr> workerConstraints;
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    workerConstraints.emplace_back(
+        std::make_shared<MockTranslationalRobotConstraint>(
+            stateSpace,
+            Eigen::Vector3d(-0.1, -0.1, -0.1),
+            Eigen::Vector3d(0.1, 0.1, 0.1)));
+  }
+
+  auto si = getSpaceInformation(
+      stateSpace,
+      std::move(interpolator),
+      std::move(dmetric),
+      std::move(sampler),
+      std::move(collConstraint),
+      std::move(boundsConstraint),
+      std::move(boundsProjection),
+      0.1,
+      std::move(workerConstraints));
+
+  auto mvalidator
+      = ompl_dynamic_pointer_cast<aikido::planner::ompl::MotionValidator>(
+          si->getMotionValidator());
+  ASSERT_FALSE(mvalidator == nullptr);
+  EXPECT_EQ(2u, mvalidator->getNumWorkers());
+
+  auto state1 = si->allocState();
+  auto state2 = si->allocState();
+  setTranslationalState(Eigen::Vector3d(-5, -5, 0), stateSpace, state1);
+  setTranslationalState(Eigen::Vector3d(5, 5, 0), stateSpace, state2);
+  EXPECT_FALSE(mvalidator->checkMotion(state1, state2));
+  si->freeState(state1);
+  si->freeState(state2);
+}
+
+TEST_F(PlannerTest, GetSpaceInformationThrowsOnNullWorkerConstraint)
+{
+  EXPECT_THROW(
+      getSpaceInformation(
+          std::move(stateSpace),
+          std::move(interpolator),
+          std::move(dmetric),
+          std::move(sampler),
+          std::move(collConstraint),
+          std::move(boundsConstraint),
+          std::move(boundsProjection),
+          0.1,
+          std::vector<aikido::constraint::TestablePtr>{nullptr}),
+      std::invalid_argument);
+}
+
+TEST_F(PlannerTest, PlanStopsOnTerminationCondition)
+{
+  Eigen::Vector3d startPose(-5, -5, 0);
+  Eigen::Vector3d goalPose(5, 5, 0);
+
+  auto startState = stateSpace->createState();
+  stateSpace->getSubStateHandle<R3>(startState, 0).setValue(startPose);
+
+  auto goalState = stateSpace->createState();
+  stateSpace->getSubStateHandle<R3>(goalState, 0).setValue(goalPose);
+
+  auto si = getSpaceInformation(
+      stateSpace,
+      interpolator,
+      std::move(dmetric),
+      std::move(sampler),
+      std::move(collConstraint),
+      std::move(boundsConstraint),
+      std::move(boundsProjection),
+      0.1);
+
+  auto sspace = aikido::planner::ompl::ompl_static_pointer_cast<
+      aikido::planner::ompl::GeometricStateSpace>(si->getStateSpace());
+  auto start = sspace->allocState(startState);
+  auto goal = sspace->allocState(goalState);
+  auto pdef
+      = aikido::planner::ompl::ompl_make_shared<ompl::base::ProblemDefinition>(
+          si);
+  pdef->setStartAndGoalStates(start, goal);
+  sspace->freeState(start);
+  sspace->freeState(goal);
+
+  auto planner = aikido::planner::ompl::ompl_make_shared<
+      ompl::geometric::RRTConnect>(si);
+
+  // A condition that holds from the start stops the planner immediately.
+  auto traj = aikido::planner::ompl::planOMPL(
+      planner,
+      pdef,
+      stateSpace,
+      interpolator,
+      ompl::base::PlannerTerminationCondition([]() { return true; }));
+  EXPECT_EQ(nullptr, traj);
+
+  planner->clear();
+  traj = aikido::planner::ompl::planOMPL(
+      planner,
+      pdef,
+      stateSpace,
+      interpolator,
+      ompl::base::timedPlannerTerminationCondition(5.0));
+  ASSERT_NE(nullptr, traj);
+
+  auto s0 = stateSpace->createState();
+  traj->evaluate(traj->getDuration(), s0);
+  EXPECT_TRUE(s0.getSubStateHandle<R3>(0).getValue().isApprox(goalPose));
+}
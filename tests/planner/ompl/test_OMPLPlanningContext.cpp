@@ -0,0 +1,136 @@
+#include <ompl/geometric/planners/prm/PRM.h>
+#include <ompl/geometric/planners/rrt/RRTConnect.h>
+
+#include <aikido/constraint.hpp>
+#include <aikido/planner/ompl/OMPLPlanningContext.hpp>
+
+#include "OMPLTestHelpers.hpp"
+
+using aikido::planner::ompl::OMPLPlanningContext;
+
+//==============================================================================
+TEST_F(PlannerTest, PlanningContextSolvesRepeatedQueries)
+{
+  OMPLPlanningContext<ompl::geometric::RRTConnect> context(
+      stateSpace,
+      interpolator,
+      std::move(dmetric),
+      std::move(sampler),
+      std::move(collConstraint),
+      std::move(boundsConstraint),
+      std::move(boundsProjection),
+      0.1);
+  auto si = context.getSpaceInformation();
+  auto planner = context.getPlanner();
+  auto pdef = planner->getProblemDefinition();
+  ASSERT_TRUE(pdef != nullptr);
+
+  auto startState = stateSpace->createState();
+  auto goalState = stateSpace->createState();
+  auto s0 = stateSpace->createState();
+
+  for (double x : {5.0, -5.0, 3.0})
+  {
+    Eigen::Vector3d startPose(-5, -5, 0);
+    Eigen::Vector3d goalPose(x, 5, 0);
+    stateSpace->getSubStateHandle<R3>(startState, 0).setValue(startPose);
+    stateSpace->getSubStateHandle<R3>(goalState, 0).setValue(goalPose);
+
+    auto traj = context.plan(startState, goalState, 5.0);
+    ASSERT_TRUE(traj != nullptr);
+    EXPECT_TRUE(planner->isSetup());
+    EXPECT_EQ(pdef, planner->getProblemDefinition());
+
+    traj->evaluate(0, s0);
+    EXPECT_TRUE(s0.getSubStateHandle<R3>(0).getValue().isApprox(startPose));
+
+    traj->evaluate(traj->getEndTime(), s0);
+    EXPECT_TRUE(s0.getSubStateHandle<R3>(0).getValue().isApprox(goalPose));
+  }
+
+  // The same SpaceInformation and planner are used by every query.
+  EXPECT_EQ(si, context.getSpaceInformation());
+  EXPECT_EQ(planner, context.getPlanner());
+}
+
+//==============================================================================
+TEST_F(PlannerTest, PlanningContextReusesRoadmap)
+{
+  OMPLPlanningContext<ompl::geometric::PRM> context(
+      stateSpace,
+      interpolator,
+      std::move(dmetric),
+      std::move(sampler),
+      std::move(collConstraint),
+      std::move(boundsConstraint),
+      std::move(boundsProjection),
+      0.1,
+      true);
+
+  auto startState = stateSpace->createState();
+  auto goalState = stateSpace->createState();
+  stateSpace->getSubStateHandle<R3>(startState, 0)
+      .setValue(Eigen::Vector3d(-5, -5, 0));
+  stateSpace->getSubStateHandle<R3>(goalState, 0)
+      .setValue(Eigen::Vector3d(5, 5, 0));
+
+  ASSERT_TRUE(context.plan(startState, goalState, 1.0) != nullptr);
+  const auto numMilestones = context.getPlanner()->milestoneCount();
+  EXPECT_LT(0u, numMilestones);
+
+  stateSpace->getSubStateHandle<R3>(goalState, 0)
+      .setValue(Eigen::Vector3d(-5, 5, 0));
+  ASSERT_TRUE(context.plan(startState, goalState, 1.0) != nullptr);
+  EXPECT_LE(numMilestones, context.getPlanner()->milestoneCount());
+
+  context.clear();
+  EXPECT_EQ(0u, context.getPlanner()->milestoneCount());
+}
+
+//==============================================================================
+TEST_F(PlannerTest, PlanningContextPlansToGoalRegion)
+{
+  OMPLPlanningContext<ompl::geometric::RRTConnect> context(
+      stateSpace,
+      interpolator,
+      std::move(dmetric),
+      std::move(sampler),
+      std::move(collConstraint),
+      std::move(boundsConstraint),
+      std::move(boundsProjection),
+      0.1);
+
+  auto startState = stateSpace->createState();
+  stateSpace->getSubStateHandle<R3>(startState, 0)
+      .setValue(Eigen::Vector3d(-5, -5, 0));
+
+  auto goalSampleable = std::make_shared<aikido::constraint::R3BoxConstraint>(
+      stateSpace->getSubspace<R3>(0),
+      make_rng(),
+      Eigen::Vector3d(4, 4, 0),
+      Eigen::Vector3d(5, 5, 0));
+  std::vector<std::shared_ptr<aikido::constraint::Sampleable>> sConstraints{
+      goalSampleable};
+  std::vector<std::shared_ptr<const aikido::constraint::Testable>> tConstraints{
+      goalSampleable};
+  auto goalSampler
+      = std::make_shared<aikido::constraint::CartesianProductSampleable>(
+          stateSpace, sConstraints);
+  auto goalTestable
+      = std::make_shared<aikido::constraint::CartesianProductTestable>(
+          stateSpace, tConstraints);
+
+  auto traj = context.plan(startState, goalTestable, goalSampler, 5.0);
+  ASSERT_TRUE(traj != nullptr);
+
+  auto s0 = stateSpace->createState();
+  traj->evaluate(traj->getEndTime(), s0);
+  EXPECT_TRUE(goalTestable->isSatisfied(s0));
+
+  EXPECT_THROW(
+      context.plan(startState, nullptr, goalSampler, 5.0),
+      std::invalid_argument);
+  EXPECT_THROW(
+      context.plan(startState, goalTestable, nullptr, 5.0),
+      std::invalid_argument);
+}
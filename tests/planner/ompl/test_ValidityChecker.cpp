@@ -84,3 +84,31 @@ TEST_F(StateValidityCheckerTest, NullOmplState)
   StateValidityChecker vchecker(si, constraint);
   EXPECT_FALSE(vchecker.isValid(nullptr));
 }
+
+TEST_F(StateValidityCheckerTest, AreValid)
+{
+  using BatchMode = aikido::constraint::Testable::BatchMode;
+
+  auto constraint = std::make_shared<PassingConstraint>(stateSpace);
+  StateValidityChecker vchecker(si, constraint);
+  auto validState = si->allocState();
+  auto invalidState = si->allocState()->as<GeometricStateSpace::StateType>();
+  invalidState->mValid = false;
+
+  std::vector<const ::ompl::base::State*> states{
+      validState, invalidState, nullptr, validState};
+  std::vector<bool> valid;
+
+  EXPECT_FALSE(vchecker.areValid(states, valid, BatchMode::AllResults));
+  EXPECT_EQ(std::vector<bool>({true, false, false, true}), valid);
+
+  EXPECT_FALSE(vchecker.areValid(states, valid, BatchMode::FirstFailure));
+  EXPECT_EQ(std::vector<bool>({true, false, false, false}), valid);
+
+  states.resize(1);
+  EXPECT_TRUE(vchecker.areValid(states, valid));
+  EXPECT_EQ(std::vector<bool>({true}), valid);
+
+  si->freeState(validState);
+  si->freeState(invalidState);
+}
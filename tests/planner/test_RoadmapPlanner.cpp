@@ -0,0 +1,260 @@
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <aikido/common/RNG.hpp>
+#include <aikido/common/memory.hpp>
+#include <aikido/constraint/Testable.hpp>
+#include <aikido/constraint/uniform/RnBoxConstraint.hpp>
+#include <aikido/distance/RnEuclidean.hpp>
+#include <aikido/planner/ConfigurationToConfiguration.hpp>
+#include <aikido/planner/RoadmapConfigurationToConfigurationPlanner.hpp>
+#include <aikido/statespace/Rn.hpp>
+#include <aikido/trajectory/Interpolated.hpp>
+
+#include "../constraint/MockConstraints.hpp"
+
+using aikido::common::RNGWrapper;
+using aikido::constraint::uniform::R2BoxConstraint;
+using aikido::distance::R2Euclidean;
+using aikido::planner::ConfigurationToConfiguration;
+using aikido::planner::RoadmapConfigurationToConfigurationPlanner;
+using aikido::statespace::R2;
+using std::make_shared;
+
+//==============================================================================
+/// Wall at 4.5 <= x <= 5.5 with an optional gap at 8 <= y <= 9.
+class WallConstraint : public aikido::constraint::Testable
+{
+public:
+  explicit WallConstraint(std::shared_ptr<const R2> stateSpace)
+    : mStateSpace(std::move(stateSpace)), mHasGap(true)
+  {
+  }
+
+  bool isSatisfied(
+      const aikido::statespace::StateSpace::State* state,
+      TestableOutcome* outcome = nullptr) const override
+  {
+    auto defaultOutcomeObject
+        = aikido::constraint::dynamic_cast_or_throw<DefaultTestableOutcome>(
+            outcome);
+
+    const Eigen::Vector2d value
+        = mStateSpace->getValue(static_cast<const R2::State*>(state));
+    const bool isInWall = value[0] >= 4.5 && value[0] <= 5.5;
+    const bool isInGap = mHasGap && value[1] >= 8.0 && value[1] <= 9.0;
+    const bool isSatisfiedResult = !isInWall || isInGap;
+
+    if (defaultOutcomeObject)
+      defaultOutcomeObject->setSatisfiedFlag(isSatisfiedResult);
+    return isSatisfiedResult;
+  }
+
+  std::unique_ptr<TestableOutcome> createOutcome() const override
+  {
+    return std::unique_ptr<TestableOutcome>(new DefaultTestableOutcome);
+  }
+
+  aikido::statespace::ConstStateSpacePtr getStateSpace() const override
+  {
+    return mStateSpace;
+  }
+
+  void setHasGap(bool hasGap)
+  {
+    mHasGap = hasGap;
+  }
+
+private:
+  std::shared_ptr<const R2> mStateSpace;
+  bool mHasGap;
+};
+
+//==============================================================================
+class RoadmapPlannerTest : public ::testing::Test
+{
+public:
+  RoadmapPlannerTest()
+    : stateSpace{make_shared<R2>()}
+    , startState{stateSpace->createState()}
+    , goalState{stateSpace->createState()}
+    , wallConstraint{make_shared<WallConstraint>(stateSpace)}
+  {
+    stateSpace->setValue(startState, Eigen::Vector2d(1.0, 1.0));
+    stateSpace->setValue(goalState, Eigen::Vector2d(9.0, 1.0));
+  }
+
+  std::shared_ptr<RoadmapConfigurationToConfigurationPlanner> createPlanner()
+  {
+    auto sampler = make_shared<R2BoxConstraint>(
+        stateSpace,
+        aikido::common::make_unique<RNGWrapper<std::default_random_engine>>(
+            0),
+        Eigen::Vector2d::Zero(),
+        Eigen::Vector2d::Constant(10.0));
+
+    return make_shared<RoadmapConfigurationToConfigurationPlanner>(
+        stateSpace,
+        make_shared<R2Euclidean>(stateSpace),
+        sampler,
+        nullptr,
+        10,
+        0.05);
+  }
+
+  void expectValidPath(const aikido::trajectory::TrajectoryPtr& trajectory)
+  {
+    ASSERT_TRUE(trajectory != nullptr);
+
+    auto state = stateSpace->createState();
+    trajectory->evaluate(trajectory->getStartTime(), state);
+    EXPECT_TRUE(stateSpace->getValue(state).isApprox(Eigen::Vector2d(1, 1)));
+    trajectory->evaluate(trajectory->getEndTime(), state);
+    EXPECT_TRUE(stateSpace->getValue(state).isApprox(Eigen::Vector2d(9, 1)));
+
+    for (double t = trajectory->getStartTime(); t < trajectory->getEndTime();
+         t += 0.01)
+    {
+      trajectory->evaluate(t, state);
+      EXPECT_TRUE(wallConstraint->isSatisfied(state));
+    }
+  }
+
+  std::shared_ptr<R2> stateSpace;
+  R2::ScopedState startState;
+  R2::ScopedState goalState;
+  std::shared_ptr<WallConstraint> wallConstraint;
+};
+
+//==============================================================================
+TEST_F(RoadmapPlannerTest, ThrowsOnNullArguments)
+{
+  auto sampler = make_shared<R2BoxConstraint>(
+      stateSpace,
+      aikido::common::make_unique<RNGWrapper<std::default_random_engine>>(0),
+      Eigen::Vector2d::Zero(),
+      Eigen::Vector2d::Constant(10.0));
+  auto dmetric = make_shared<R2Euclidean>(stateSpace);
+
+  EXPECT_THROW(
+      RoadmapConfigurationToConfigurationPlanner(stateSpace, nullptr, sampler),
+      std::invalid_argument);
+  EXPECT_THROW(
+      RoadmapConfigurationToConfigurationPlanner(stateSpace, dmetric, nullptr),
+      std::invalid_argument);
+}
+
+//==============================================================================
+TEST_F(RoadmapPlannerTest, PlansAroundObstacles)
+{
+  auto planner = createPlanner();
+  planner->buildRoadmap(500);
+  EXPECT_EQ(500u, planner->getNumVertices());
+  EXPECT_LT(0u, planner->getNumEdges());
+
+  const auto numEdges = planner->getNumEdges();
+  ConfigurationToConfiguration problem(
+      stateSpace, startState, goalState, wallConstraint);
+  expectValidPath(planner->plan(problem));
+
+  // The roadmap is not modified by planning, so it can be reused after the
+  // world changes.
+  EXPECT_EQ(500u, planner->getNumVertices());
+  EXPECT_EQ(numEdges, planner->getNumEdges());
+
+  RoadmapConfigurationToConfigurationPlanner::Result result;
+  wallConstraint->setHasGap(false);
+  EXPECT_EQ(nullptr, planner->plan(problem, &result));
+  EXPECT_FALSE(result.getMessage().empty());
+
+  wallConstraint->setHasGap(true);
+  expectValidPath(planner->plan(problem));
+}
+
+//==============================================================================
+TEST_F(RoadmapPlannerTest, PlansWithEmptyRoadmap)
+{
+  auto planner = createPlanner();
+  ConfigurationToConfiguration problem(
+      stateSpace,
+      startState,
+      goalState,
+      make_shared<PassingConstraint>(stateSpace));
+
+  auto trajectory = planner->plan(problem);
+  ASSERT_TRUE(trajectory != nullptr);
+  EXPECT_EQ(
+      2u,
+      std::static_pointer_cast<aikido::trajectory::Interpolated>(trajectory)
+          ->getNumWaypoints());
+
+  ConfigurationToConfiguration blockedProblem(
+      stateSpace, startState, goalState, wallConstraint);
+  EXPECT_EQ(nullptr, planner->plan(blockedProblem));
+}
+
+//==============================================================================
+TEST_F(RoadmapPlannerTest, SavesAndLoadsRoadmap)
+{
+  auto planner = createPlanner();
+  planner->buildRoadmap(200);
+
+  std::stringstream stream;
+  planner->saveRoadmap(stream);
+
+  auto loadedPlanner = createPlanner();
+  loadedPlanner->loadRoadmap(stream);
+  EXPECT_EQ(planner->getNumVertices(), loadedPlanner->getNumVertices());
+  EXPECT_EQ(planner->getNumEdges(), loadedPlanner->getNumEdges());
+
+  std::stringstream savedStream;
+  std::stringstream loadedStream;
+  planner->saveRoadmap(savedStream);
+  loadedPlanner->saveRoadmap(loadedStream);
+  EXPECT_EQ(savedStream.str(), loadedStream.str());
+
+  ConfigurationToConfiguration problem(
+      stateSpace, startState, goalState, wallConstraint);
+  expectValidPath(loadedPlanner->plan(problem));
+
+  // Invalid input leaves the roadmap unchanged.
+  std::stringstream invalidStream("not a roadmap");
+  EXPECT_THROW(loadedPlanner->loadRoadmap(invalidStream), std::runtime_error);
+
+  std::string truncated = savedStream.str();
+  truncated.resize(truncated.size() / 2);
+  std::stringstream truncatedStream(truncated);
+  EXPECT_THROW(
+      loadedPlanner->loadRoadmap(truncatedStream), std::runtime_error);
+  EXPECT_EQ(planner->getNumVertices(), loadedPlanner->getNumVertices());
+}
+
+//==============================================================================
+TEST_F(RoadmapPlannerTest, RejectsRoadmapLargerThanStream)
+{
+  auto planner = createPlanner();
+  planner->buildRoadmap(10);
+  const auto numVertices = planner->getNumVertices();
+
+  std::stringstream stream;
+  planner->saveRoadmap(stream);
+  std::string header = stream.str().substr(0, 32);
+
+  // The header is little-endian: version 1 follows the magic.
+  EXPECT_EQ(std::string("\x01\x00\x00\x00", 4), header.substr(8, 4));
+
+  // Claim far more vertices than the stream holds.
+  std::string vertices = header;
+  vertices.replace(16, 8, std::string("\x00\x00\x00\xf0\x00\x00\x00\x00", 8));
+  std::stringstream verticesStream(vertices);
+  EXPECT_THROW(planner->loadRoadmap(verticesStream), std::runtime_error);
+
+  // Claim far more edges than the stream holds.
+  std::string edges = stream.str();
+  edges.replace(24, 8, std::string("\x00\x00\x00\x00\x00\x00\x00\x01", 8));
+  std::stringstream edgesStream(edges);
+  EXPECT_THROW(planner->loadRoadmap(edgesStream), std::runtime_error);
+
+  EXPECT_EQ(numVertices, planner->getNumVertices());
+}
@@ -165,3 +165,74 @@ TEST_F(WorldTest, SetStateThrowsErrorsOnWorldsWithSkeletonsWithDifferentNames)
   state = clonedWorld->getState();
   EXPECT_THROW(mWorld->setState(state), std::invalid_argument);
 }
+
+TEST_F(WorldTest, VersionChangesWhenWorldChanges)
+{
+  auto version = mWorld->getVersion();
+
+  mWorld->addSkeleton(skel1);
+  EXPECT_NE(version, mWorld->getVersion());
+  version = mWorld->getVersion();
+
+  // Adding the same Skeleton again does nothing.
+  mWorld->addSkeleton(skel1);
+  EXPECT_EQ(version, mWorld->getVersion());
+
+  mWorld->setState(mWorld->getState());
+  EXPECT_NE(version, mWorld->getVersion());
+  version = mWorld->getVersion();
+
+  mWorld->incrementVersion();
+  EXPECT_NE(version, mWorld->getVersion());
+  version = mWorld->getVersion();
+
+  mWorld->removeSkeleton(skel1);
+  EXPECT_NE(version, mWorld->getVersion());
+}
+
+TEST_F(WorldTest, VersionChangesWhenSkeletonMoves)
+{
+  skel1->createJointAndBodyNodePair<dart::dynamics::FreeJoint>();
+  skel2->createJointAndBodyNodePair<dart::dynamics::FreeJoint>();
+  mWorld->addSkeleton(skel1);
+  mWorld->addSkeleton(skel2);
+
+  auto version = mWorld->getVersion();
+  EXPECT_EQ(version, mWorld->getVersion());
+
+  // Moving a Skeleton directly, rather than through setState, also changes
+  // the version.
+  skel1->setPosition(3, 1.0);
+  EXPECT_NE(version, mWorld->getVersion());
+  version = mWorld->getVersion();
+  EXPECT_EQ(version, mWorld->getVersion());
+
+  // Ignored Skeletons may move freely.
+  const std::vector<std::string> ignored{"skel2"};
+  skel2->setPosition(3, 1.0);
+  EXPECT_EQ(version, mWorld->getVersion(ignored));
+
+  skel1->setPosition(3, 2.0);
+  EXPECT_NE(version, mWorld->getVersion(ignored));
+
+  // Moving the same Skeleton twice without computing its transforms in
+  // between is also detected.
+  version = mWorld->getVersion(ignored);
+  skel1->setPosition(3, 3.0);
+  EXPECT_NE(version, mWorld->getVersion(ignored));
+  version = mWorld->getVersion(ignored);
+  skel1->setPosition(3, 4.0);
+  EXPECT_NE(version, mWorld->getVersion(ignored));
+}
+
+TEST_F(WorldTest, VersionChangesWhenChildBodyNodeMoves)
+{
+  auto root
+      = skel1->createJointAndBodyNodePair<dart::dynamics::FreeJoint>().second;
+  skel1->createJointAndBodyNodePair<dart::dynamics::RevoluteJoint>(root);
+  mWorld->addSkeleton(skel1);
+
+  const auto version = mWorld->getVersion();
+  skel1->setPosition(6, 1.0);
+  EXPECT_NE(version, mWorld->getVersion());
+}
@@ -0,0 +1,281 @@
+#include <dart/dart.hpp>
+#include <gtest/gtest.h>
+
+#include <aikido/common/RNG.hpp>
+#include <aikido/planner/toppra/ToppraRetimer.hpp>
+#include <aikido/statespace/CartesianProduct.hpp>
+#include <aikido/statespace/GeodesicInterpolator.hpp>
+#include <aikido/statespace/Rn.hpp>
+#include <aikido/statespace/dart/MetaSkeletonStateSpace.hpp>
+#include <aikido/trajectory/util.hpp>
+
+#include "eigen_tests.hpp"
+
+using aikido::planner::toppra::computeToppraTiming;
+using aikido::planner::toppra::ToppraRetimer;
+using aikido::statespace::CartesianProduct;
+using aikido::statespace::GeodesicInterpolator;
+using aikido::statespace::R1;
+using aikido::statespace::dart::MetaSkeletonStateSpace;
+using aikido::trajectory::convertToSpline;
+using aikido::trajectory::Interpolated;
+using aikido::trajectory::Spline;
+using Eigen::Vector2d;
+
+class ToppraRetimerTests : public ::testing::Test
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+protected:
+  void SetUp() override
+  {
+    std::vector<aikido::statespace::ConstStateSpacePtr> subspaces;
+    for (std::size_t i = 0; i < 2; ++i)
+      subspaces.emplace_back(std::make_shared<R1>());
+    mStateSpace = std::make_shared<CartesianProduct>(subspaces);
+
+    mMaxVelocity = Eigen::Vector2d(1., 1.);
+    mMaxAcceleration = Eigen::Vector2d(2., 2.);
+
+    mInterpolator = std::make_shared<GeodesicInterpolator>(mStateSpace);
+    mStraightLine = createTrajectory({Vector2d(1., 2.), Vector2d(3., 4.)});
+  }
+
+  std::shared_ptr<Interpolated> createTrajectory(
+      const std::vector<Vector2d>& waypoints, double startTime = 0.)
+  {
+    auto trajectory
+        = std::make_shared<Interpolated>(mStateSpace, mInterpolator);
+    auto state = mStateSpace->createState();
+    for (std::size_t i = 0; i < waypoints.size(); ++i)
+    {
+      mStateSpace->expMap(waypoints[i], state);
+      trajectory->addWaypoint(startTime + i, state);
+    }
+    return trajectory;
+  }
+
+  Eigen::VectorXd evaluate(const Spline& trajectory, double t)
+  {
+    auto state = mStateSpace->createState();
+    Eigen::VectorXd positions;
+    trajectory.evaluate(t, state);
+    mStateSpace->logMap(state, positions);
+    return positions;
+  }
+
+  void expectWithinLimits(
+      const Spline& trajectory,
+      const Eigen::VectorXd& maxVelocity,
+      const Eigen::VectorXd& maxAcceleration)
+  {
+    Eigen::VectorXd velocity;
+    Eigen::VectorXd acceleration;
+    for (double t = trajectory.getStartTime(); t <= trajectory.getEndTime();
+         t += 1e-3)
+    {
+      trajectory.evaluateDerivative(t, 1, velocity);
+      trajectory.evaluateDerivative(t, 2, acceleration);
+      // The limits are only enforced at the grid points, so the acceleration
+      // may exceed them slightly where the curvature of the path changes.
+      for (int i = 0; i < velocity.size(); ++i)
+      {
+        EXPECT_LE(std::abs(velocity[i]), maxVelocity[i] * 1.01);
+        EXPECT_LE(std::abs(acceleration[i]), maxAcceleration[i] * 1.1);
+      }
+    }
+  }
+
+  std::shared_ptr<CartesianProduct> mStateSpace;
+  Eigen::Vector2d mMaxVelocity;
+  Eigen::Vector2d mMaxAcceleration;
+
+  std::shared_ptr<GeodesicInterpolator> mInterpolator;
+  std::shared_ptr<Interpolated> mStraightLine;
+};
+
+TEST_F(ToppraRetimerTests, InvalidArguments_Throws)
+{
+  EXPECT_THROW(
+      computeToppraTiming(
+          *mStraightLine, Vector2d(1., 0.), mMaxAcceleration),
+      std::invalid_argument);
+  EXPECT_THROW(
+      computeToppraTiming(
+          *mStraightLine, Vector2d(1., -1.), mMaxAcceleration),
+      std::invalid_argument);
+  EXPECT_THROW(
+      computeToppraTiming(*mStraightLine, mMaxVelocity, Vector2d(1., 0.)),
+      std::invalid_argument);
+  EXPECT_THROW(
+      computeToppraTiming(*mStraightLine, mMaxVelocity, Vector2d(1., -1.)),
+      std::invalid_argument);
+  EXPECT_THROW(
+      computeToppraTiming(
+          *mStraightLine, Eigen::Vector3d::Ones(), mMaxAcceleration),
+      std::invalid_argument);
+  EXPECT_THROW(
+      computeToppraTiming(
+          *mStraightLine, mMaxVelocity, mMaxAcceleration, 1e-2, 1),
+      std::invalid_argument);
+
+  auto emptyTrajectory = createTrajectory({Vector2d(1., 2.)});
+  EXPECT_THROW(
+      computeToppraTiming(*emptyTrajectory, mMaxVelocity, mMaxAcceleration),
+      std::invalid_argument);
+}
+
+TEST_F(ToppraRetimerTests, StraightLine_TriangularProfile)
+{
+  // The optimal timing accelerates at 1 for 1 s, then decelerates at -1 for
+  // 1 s, moving each axis by 1.
+  auto inputTrajectory
+      = createTrajectory({Vector2d(1., 2.), Vector2d(2., 3.)}, 1.);
+  auto timedTrajectory = computeToppraTiming(
+      *inputTrajectory, Vector2d::Constant(2.), Vector2d::Constant(1.));
+  ASSERT_FALSE(timedTrajectory == nullptr);
+
+  EXPECT_DOUBLE_EQ(1., timedTrajectory->getStartTime());
+  EXPECT_NEAR(2., timedTrajectory->getDuration(), 1e-2);
+  EXPECT_EIGEN_EQUAL(Vector2d(1., 2.), evaluate(*timedTrajectory, 1.), 1e-6);
+  EXPECT_EIGEN_EQUAL(Vector2d(1.5, 2.5), evaluate(*timedTrajectory, 2.), 1e-2);
+  EXPECT_EIGEN_EQUAL(
+      Vector2d(2., 3.),
+      evaluate(*timedTrajectory, timedTrajectory->getEndTime()),
+      1e-6);
+  expectWithinLimits(
+      *timedTrajectory, Vector2d::Constant(2.), Vector2d::Constant(1.));
+}
+
+TEST_F(ToppraRetimerTests, StraightLine_TrapezoidalProfile)
+{
+  // The optimal timing accelerates for 1 s, cruises at the maximum velocity
+  // for 1 s and decelerates for 1 s.
+  auto inputTrajectory = createTrajectory({Vector2d(1., 2.), Vector2d(3., 4.)});
+  auto timedTrajectory = computeToppraTiming(
+      *inputTrajectory, Vector2d::Constant(1.), Vector2d::Constant(1.));
+  ASSERT_FALSE(timedTrajectory == nullptr);
+
+  EXPECT_NEAR(3., timedTrajectory->getDuration(), 1e-2);
+  EXPECT_EIGEN_EQUAL(Vector2d(2., 3.), evaluate(*timedTrajectory, 1.5), 1e-2);
+
+  Eigen::VectorXd velocity;
+  timedTrajectory->evaluateDerivative(1.5, 1, velocity);
+  EXPECT_EIGEN_EQUAL(Vector2d(1., 1.), velocity, 1e-2);
+  expectWithinLimits(
+      *timedTrajectory, Vector2d::Constant(1.), Vector2d::Constant(1.));
+}
+
+TEST_F(ToppraRetimerTests, MultipleWaypoints_RespectsLimits)
+{
+  auto inputTrajectory = createTrajectory({Vector2d(0., 0.),
+                                           Vector2d(1., 2.),
+                                           Vector2d(3., 1.),
+                                           Vector2d(2., -1.)});
+  auto timedTrajectory = computeToppraTiming(
+      *inputTrajectory, mMaxVelocity, mMaxAcceleration, 1e-1);
+  ASSERT_FALSE(timedTrajectory == nullptr);
+
+  EXPECT_EIGEN_EQUAL(Vector2d(0., 0.), evaluate(*timedTrajectory, 0.), 1e-6);
+  EXPECT_EIGEN_EQUAL(
+      Vector2d(2., -1.),
+      evaluate(*timedTrajectory, timedTrajectory->getEndTime()),
+      1e-6);
+  expectWithinLimits(*timedTrajectory, mMaxVelocity, mMaxAcceleration);
+
+  // Enforcing the limits at fewer grid points cannot take longer.
+  auto coarseTrajectory = computeToppraTiming(
+      *inputTrajectory, mMaxVelocity, mMaxAcceleration, 1e-1, 100);
+  EXPECT_LE(
+      coarseTrajectory->getDuration(),
+      timedTrajectory->getDuration() * 1.01);
+}
+
+TEST_F(ToppraRetimerTests, Spline_FollowsPathExactly)
+{
+  auto inputTrajectory = convertToSpline(*mStraightLine);
+  auto timedTrajectory = computeToppraTiming(
+      *inputTrajectory, Vector2d::Constant(1.), Vector2d::Constant(1.));
+  ASSERT_FALSE(timedTrajectory == nullptr);
+
+  EXPECT_NEAR(3., timedTrajectory->getDuration(), 1e-2);
+  EXPECT_EIGEN_EQUAL(Vector2d(1., 2.), evaluate(*timedTrajectory, 0.), 1e-6);
+  EXPECT_EIGEN_EQUAL(
+      Vector2d(3., 4.),
+      evaluate(*timedTrajectory, timedTrajectory->getEndTime()),
+      1e-6);
+}
+
+TEST_F(ToppraRetimerTests, PostProcessor_MatchesFunction)
+{
+  aikido::common::RNGWrapper<std::mt19937> rng(0);
+  ToppraRetimer retimer(mMaxVelocity, mMaxAcceleration, 1e-1, 200);
+  EXPECT_EIGEN_EQUAL(mMaxVelocity, retimer.getVelocityLimits(), 0.);
+  EXPECT_EIGEN_EQUAL(mMaxAcceleration, retimer.getAccelerationLimits(), 0.);
+  EXPECT_DOUBLE_EQ(1e-1, retimer.getMaxDeviation());
+  EXPECT_EQ(200u, retimer.getNumGridPoints());
+  EXPECT_EQ(nullptr, retimer.getMetaSkeleton());
+
+  auto timedTrajectory = retimer.postprocess(*mStraightLine, rng);
+  auto expectedTrajectory = computeToppraTiming(
+      *mStraightLine, mMaxVelocity, mMaxAcceleration, 1e-1, 200);
+  EXPECT_DOUBLE_EQ(
+      expectedTrajectory->getDuration(), timedTrajectory->getDuration());
+
+  retimer.setNumGridPoints(1);
+  EXPECT_THROW(retimer.postprocess(*mStraightLine, rng), std::invalid_argument);
+}
+
+TEST_F(ToppraRetimerTests, TorqueLimits_LimitAccelerationAgainstGravity)
+{
+  // A unit mass on a vertical prismatic joint can only accelerate upwards at
+  // (11.81 - 9.81) m/s^2 = 2 m/s^2.
+  auto skeleton = dart::dynamics::Skeleton::create("skeleton");
+  using dart::dynamics::PrismaticJoint;
+  auto joint = skeleton->createJointAndBodyNodePair<PrismaticJoint>().first;
+  joint->setAxis(Eigen::Vector3d::UnitZ());
+  joint->setForceLowerLimit(0, -11.81);
+  joint->setForceUpperLimit(0, 11.81);
+  skeleton->setPositions(Eigen::VectorXd::Constant(1, 0.5));
+
+  auto stateSpace = std::make_shared<MetaSkeletonStateSpace>(skeleton.get());
+  Interpolated inputTrajectory(
+      stateSpace, std::make_shared<GeodesicInterpolator>(stateSpace));
+  auto state = stateSpace->createState();
+  stateSpace->expMap(Eigen::VectorXd::Constant(1, 0.), state);
+  inputTrajectory.addWaypoint(0., state);
+  stateSpace->expMap(Eigen::VectorXd::Constant(1, 1.), state);
+  inputTrajectory.addWaypoint(1., state);
+
+  const Eigen::VectorXd maxVelocity = Eigen::VectorXd::Constant(1, 100.);
+  const Eigen::VectorXd maxAcceleration = Eigen::VectorXd::Constant(1, 100.);
+  auto unlimitedTrajectory
+      = computeToppraTiming(inputTrajectory, maxVelocity, maxAcceleration);
+  auto timedTrajectory = computeToppraTiming(
+      inputTrajectory, maxVelocity, maxAcceleration, 1e-2, 1000, skeleton);
+  ASSERT_FALSE(timedTrajectory == nullptr);
+
+  EXPECT_GT(timedTrajectory->getDuration(), unlimitedTrajectory->getDuration());
+
+  Eigen::VectorXd acceleration;
+  for (double t = 0.; t <= timedTrajectory->getEndTime(); t += 1e-3)
+  {
+    timedTrajectory->evaluateDerivative(t, 2, acceleration);
+    EXPECT_LE(acceleration[0], 2.1);
+  }
+
+  // The state of the skeleton is restored.
+  EXPECT_DOUBLE_EQ(0.5, skeleton->getPosition(0));
+  EXPECT_DOUBLE_EQ(0., skeleton->getVelocity(0));
+
+  auto wrongSkeleton = dart::dynamics::Skeleton::create("wrong");
+  EXPECT_THROW(
+      computeToppraTiming(
+          inputTrajectory,
+          maxVelocity,
+          maxAcceleration,
+          1e-2,
+          1000,
+          wrongSkeleton),
+      std::invalid_argument);
+}
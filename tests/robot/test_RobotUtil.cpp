@@ -0,0 +1,183 @@
+#include <random>
+
+#include <dart/dart.hpp>
+#include <gtest/gtest.h>
+
+#include <aikido/common/RNG.hpp>
+#include <aikido/constraint/dart/TSR.hpp>
+#include <aikido/robot/util.hpp>
+#include <aikido/statespace/dart/MetaSkeletonStateSpace.hpp>
+
+#include "../constraint/MockConstraints.hpp"
+
+using aikido::common::RNG;
+using aikido::common::RNGWrapper;
+using aikido::constraint::dart::TSR;
+using aikido::robot::util::CollisionTestableFactory;
+using aikido::robot::util::planToTSR;
+using aikido::statespace::dart::MetaSkeletonStateSpace;
+using aikido::statespace::dart::MetaSkeletonStateSpacePtr;
+using aikido::trajectory::TrajectoryPtr;
+using dart::dynamics::BodyNodePtr;
+using dart::dynamics::MetaSkeletonPtr;
+using dart::dynamics::RevoluteJoint;
+using dart::dynamics::Skeleton;
+using dart::dynamics::SkeletonPtr;
+
+//==============================================================================
+class PlanToTSRTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    mRng.reset(new RNGWrapper<std::default_random_engine>(0));
+
+    // Planar manipulator with 2 revolute joints and unit-length links.
+    mSkeleton = Skeleton::create("Manipulator");
+
+    RevoluteJoint::Properties properties1;
+    properties1.mAxis = Eigen::Vector3d::UnitZ();
+    properties1.mName = "Joint1";
+    auto bn1 = mSkeleton
+                   ->createJointAndBodyNodePair<RevoluteJoint>(
+                       nullptr, properties1)
+                   .second;
+    bn1->setName("Body1");
+
+    RevoluteJoint::Properties properties2;
+    properties2.mAxis = Eigen::Vector3d::UnitZ();
+    properties2.mName = "Joint2";
+    properties2.mT_ParentBodyToJoint.translation() = Eigen::Vector3d(1, 0, 0);
+    mEndEffector = mSkeleton
+                       ->createJointAndBodyNodePair<RevoluteJoint>(
+                           bn1, properties2)
+                       .second;
+    mEndEffector->setName("Body2");
+
+    mStateSpace = std::make_shared<MetaSkeletonStateSpace>(mSkeleton.get());
+    mCollisionTestable = std::make_shared<PassingConstraint>(mStateSpace);
+
+    // The end effector must reach (0, 1, 0) in any orientation about z.
+    Eigen::Isometry3d T0_w = Eigen::Isometry3d::Identity();
+    T0_w.translation() = Eigen::Vector3d(0, 1, 0);
+    Eigen::Matrix<double, 6, 2> Bw = Eigen::Matrix<double, 6, 2>::Zero();
+    Bw(5, 0) = -M_PI;
+    Bw(5, 1) = M_PI;
+    mTsr = std::make_shared<TSR>(T0_w, Bw);
+    mTsr->setRNG(mRng->clone());
+
+    mSkeleton->setPositions(Eigen::Vector2d(0.1, 0.2));
+  }
+
+  /// Checks that \c trajectory moves the end effector from its current pose
+  /// into the TSR, without changing the state of the robot.
+  void expectReachesTSR(const TrajectoryPtr& trajectory)
+  {
+    ASSERT_TRUE(trajectory != nullptr);
+
+    const Eigen::VectorXd startPositions = mSkeleton->getPositions();
+    EXPECT_TRUE(startPositions.isApprox(Eigen::Vector2d(0.1, 0.2)));
+
+    auto state = mStateSpace->createState();
+    Eigen::VectorXd positions;
+
+    trajectory->evaluate(trajectory->getStartTime(), state);
+    mStateSpace->convertStateToPositions(state, positions);
+    EXPECT_TRUE(positions.isApprox(startPositions, 1e-6));
+
+    trajectory->evaluate(trajectory->getEndTime(), state);
+    mStateSpace->setState(mSkeleton.get(), state);
+    EXPECT_TRUE(mEndEffector->getWorldTransform().translation().isApprox(
+        Eigen::Vector3d(0, 1, 0), 1e-3));
+
+    mSkeleton->setPositions(startPositions);
+  }
+
+  std::unique_ptr<RNG> mRng;
+  SkeletonPtr mSkeleton;
+  BodyNodePtr mEndEffector;
+  MetaSkeletonStateSpacePtr mStateSpace;
+  std::shared_ptr<PassingConstraint> mCollisionTestable;
+  std::shared_ptr<TSR> mTsr;
+};
+
+//==============================================================================
+TEST_F(PlanToTSRTest, ThrowsOnZeroThreads)
+{
+  EXPECT_THROW(
+      planToTSR(
+          mStateSpace,
+          mSkeleton,
+          mEndEffector,
+          mTsr,
+          mCollisionTestable,
+          mRng.get(),
+          1.0,
+          10,
+          nullptr,
+          0),
+      std::invalid_argument);
+}
+
+//==============================================================================
+TEST_F(PlanToTSRTest, ParallelMatchesSerial)
+{
+  const CollisionTestableFactory createCollisionTestable
+      = [](const MetaSkeletonStateSpacePtr& space,
+           const MetaSkeletonPtr& /*metaSkeleton*/) {
+          return std::make_shared<PassingConstraint>(space);
+        };
+
+  auto serial = planToTSR(
+      mStateSpace,
+      mSkeleton,
+      mEndEffector,
+      mTsr,
+      mCollisionTestable,
+      mRng.get(),
+      1.0,
+      10);
+  expectReachesTSR(serial);
+
+  // Without per-thread constraints, only the IK solutions are sampled
+  // concurrently.
+  auto parallelSampling = planToTSR(
+      mStateSpace,
+      mSkeleton,
+      mEndEffector,
+      mTsr,
+      mCollisionTestable,
+      mRng.get(),
+      1.0,
+      10,
+      nullptr,
+      4);
+  expectReachesTSR(parallelSampling);
+
+  auto parallel = planToTSR(
+      mStateSpace,
+      mSkeleton,
+      mEndEffector,
+      mTsr,
+      mCollisionTestable,
+      mRng.get(),
+      1.0,
+      10,
+      nullptr,
+      4,
+      createCollisionTestable);
+  expectReachesTSR(parallel);
+
+  // Every plan reaches the goal with the same shoulder angle; only the
+  // orientation of the end effector, which the TSR leaves free, may differ.
+  auto serialGoal = mStateSpace->createState();
+  auto parallelGoal = mStateSpace->createState();
+  serial->evaluate(serial->getEndTime(), serialGoal);
+  parallel->evaluate(parallel->getEndTime(), parallelGoal);
+
+  Eigen::VectorXd serialPositions;
+  Eigen::VectorXd parallelPositions;
+  mStateSpace->convertStateToPositions(serialGoal, serialPositions);
+  mStateSpace->convertStateToPositions(parallelGoal, parallelPositions);
+  EXPECT_NEAR(serialPositions[0], parallelPositions[0], 1e-3);
+}
@@ -239,3 +239,51 @@ TEST(MetaSkeletonStateSpace, MultipleJoints_CreatesCartesianProduct)
   EXPECT_EQ(5 - 2 * M_PI, substate1.toAngle());
   EXPECT_TRUE(value2.isApprox(substate2.getValue()));
 }
+
+TEST(MetaSkeletonStateSpace, MultipleJoints_ConvertsPositionsInMetaSkeletonOrder)
+{
+  auto skeleton = Skeleton::create();
+  auto pair1 = skeleton->createJointAndBodyNodePair<RevoluteJoint>();
+  auto pair2
+      = skeleton->createJointAndBodyNodePair<FreeJoint>(pair1.second);
+  auto pair3
+      = skeleton->createJointAndBodyNodePair<PrismaticJoint>(pair2.second);
+
+  // Order the joints differently than in the Skeleton.
+  auto group = dart::dynamics::Group::create();
+  group->addJoint(pair3.first, true);
+  group->addJoint(pair2.first, true);
+  group->addJoint(pair1.first, true);
+
+  MetaSkeletonStateSpace space(group.get());
+  ASSERT_EQ(3, space.getNumSubspaces());
+
+  const auto& properties = space.getProperties();
+  EXPECT_EQ(0, properties.getDofIndex(0, 0));
+  EXPECT_EQ(6, properties.getDofIndex(1, 5));
+  EXPECT_EQ(7, properties.getDofIndex(2, 0));
+  EXPECT_THROW(properties.getDofIndex(1, 6), std::out_of_range);
+  EXPECT_THROW(properties.getDofIndex(3, 0), std::out_of_range);
+
+  const auto& jointDofIndices = properties.getJointDofIndices();
+  ASSERT_EQ(8u, jointDofIndices.size());
+  EXPECT_EQ(1u, properties.getJointDofOffset(1));
+  EXPECT_EQ(7u, properties.getJointDofOffset(2));
+  EXPECT_EQ(6u, jointDofIndices[properties.getJointDofOffset(1) + 5]);
+  EXPECT_THROW(properties.getJointDofOffset(3), std::out_of_range);
+
+  Eigen::VectorXd positions(8);
+  positions << 0.5, 0.1, 0.2, 0.3, 1., 2., 3., 2.;
+
+  auto state = space.createState();
+  space.convertPositionsToState(positions, state);
+  EXPECT_DOUBLE_EQ(0.5, state.getSubStateHandle<R1>(0).getValue()[0]);
+  EXPECT_DOUBLE_EQ(2., state.getSubStateHandle<SO2>(2).toAngle());
+
+  Eigen::VectorXd roundTripPositions;
+  space.convertStateToPositions(state, roundTripPositions);
+  EXPECT_TRUE(positions.isApprox(roundTripPositions));
+
+  space.setState(group.get(), state);
+  EXPECT_TRUE(positions.isApprox(group->getPositions()));
+}
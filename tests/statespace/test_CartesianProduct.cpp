@@ -8,6 +8,7 @@
 #include <aikido/statespace/SO3.hpp>
 
 using aikido::statespace::CartesianProduct;
+using aikido::statespace::R1;
 using aikido::statespace::R2;
 using aikido::statespace::R3;
 using aikido::statespace::SE2;
@@ -144,6 +145,97 @@ TEST(CartesianProduct, LogMap)
   EXPECT_TRUE(out.isApprox(Eigen::Vector3d(M_PI_2, 1, 2)));
 }
 
+TEST(CartesianProduct, IsPacked)
+{
+  auto so2 = std::make_shared<SO2>();
+  auto r2 = std::make_shared<R2>();
+
+  EXPECT_TRUE(CartesianProduct({so2, r2}).isPacked());
+  EXPECT_FALSE(CartesianProduct({r2, std::make_shared<SE2>()}).isPacked());
+  EXPECT_FALSE(CartesianProduct({so2, std::make_shared<SO3>()}).isPacked());
+}
+
+TEST(CartesianProduct, RealVectorAndSO2Subspaces_MatchSubspaceOperations)
+{
+  using Eigen::Vector2d;
+  using Vector1d = Eigen::Matrix<double, 1, 1>;
+
+  auto so2 = std::make_shared<SO2>();
+  auto r2 = std::make_shared<R2>();
+  auto r1 = std::make_shared<R1>();
+  CartesianProduct space({so2, r2, so2, r1});
+
+  auto s1 = space.createState();
+  auto s2 = space.createState();
+  auto out = space.createState();
+
+  for (auto i = 0u; i < 10u; ++i)
+  {
+    const Eigen::Vector4d angles = 4. * M_PI * Eigen::Vector4d::Random();
+    const Vector2d v1 = Vector2d::Random();
+    const Vector2d v2 = Vector2d::Random();
+    const Vector1d w1 = Vector1d::Random();
+    const Vector1d w2 = Vector1d::Random();
+
+    s1.getSubStateHandle<SO2>(0).fromAngle(angles[0]);
+    s1.getSubStateHandle<R2>(1).setValue(v1);
+    s1.getSubStateHandle<SO2>(2).fromAngle(angles[1]);
+    s1.getSubStateHandle<R1>(3).setValue(w1);
+
+    s2.getSubStateHandle<SO2>(0).fromAngle(angles[2]);
+    s2.getSubStateHandle<R2>(1).setValue(v2);
+    s2.getSubStateHandle<SO2>(2).fromAngle(angles[3]);
+    s2.getSubStateHandle<R1>(3).setValue(w2);
+
+    // Compose
+    space.compose(s1, s2, out);
+    for (auto j : {0u, 2u})
+    {
+      auto expected = so2->createState();
+      so2->compose(
+          s1.getSubStateHandle<SO2>(j).getState(),
+          s2.getSubStateHandle<SO2>(j).getState(),
+          expected);
+      EXPECT_DOUBLE_EQ(
+          expected.toAngle(), out.getSubStateHandle<SO2>(j).toAngle());
+    }
+    EXPECT_TRUE(out.getSubStateHandle<R2>(1).getValue().isApprox(v1 + v2));
+    EXPECT_TRUE(out.getSubStateHandle<R1>(3).getValue().isApprox(w1 + w2));
+
+    // Inverse
+    space.getInverse(s1, out);
+    for (auto j : {0u, 2u})
+    {
+      auto expected = so2->createState();
+      so2->getInverse(s1.getSubStateHandle<SO2>(j).getState(), expected);
+      EXPECT_DOUBLE_EQ(
+          expected.toAngle(), out.getSubStateHandle<SO2>(j).toAngle());
+    }
+    EXPECT_TRUE(out.getSubStateHandle<R2>(1).getValue().isApprox(-v1));
+    EXPECT_TRUE(out.getSubStateHandle<R1>(3).getValue().isApprox(-w1));
+
+    // ExpMap wraps the angles into (-pi, pi].
+    Eigen::VectorXd tangent(5);
+    tangent << angles[0], v1, angles[1], w1;
+    space.expMap(tangent, out);
+    EXPECT_DOUBLE_EQ(
+        s1.getSubStateHandle<SO2>(0).toAngle(),
+        out.getSubStateHandle<SO2>(0).toAngle());
+    EXPECT_DOUBLE_EQ(
+        s1.getSubStateHandle<SO2>(2).toAngle(),
+        out.getSubStateHandle<SO2>(2).toAngle());
+
+    // LogMap
+    Eigen::VectorXd log;
+    space.logMap(out, log);
+    ASSERT_EQ(5, log.size());
+    EXPECT_DOUBLE_EQ(s1.getSubStateHandle<SO2>(0).toAngle(), log[0]);
+    EXPECT_TRUE(log.segment<2>(1).isApprox(v1));
+    EXPECT_DOUBLE_EQ(s1.getSubStateHandle<SO2>(2).toAngle(), log[3]);
+    EXPECT_DOUBLE_EQ(w1[0], log[4]);
+  }
+}
+
 TEST(CartesianProduct, CopyState)
 {
   CartesianProduct space({
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include <aikido/statespace/CartesianProduct.hpp>
+#include <aikido/statespace/GeodesicInterpolator.hpp>
+#include <aikido/statespace/InterpolationContext.hpp>
+#include <aikido/statespace/Rn.hpp>
+#include <aikido/statespace/SE2.hpp>
+#include <aikido/statespace/SO2.hpp>
+
+using aikido::statespace::CartesianProduct;
+using aikido::statespace::GeodesicInterpolator;
+using aikido::statespace::InterpolationContext;
+using aikido::statespace::Interpolator;
+using aikido::statespace::R2;
+using aikido::statespace::R3;
+using aikido::statespace::SE2;
+using aikido::statespace::SO2;
+using aikido::statespace::StateSpace;
+
+namespace {
+
+class IdentityInterpolator : public Interpolator
+{
+public:
+  explicit IdentityInterpolator(aikido::statespace::ConstStateSpacePtr space)
+    : mStateSpace(std::move(space))
+  {
+  }
+
+  aikido::statespace::ConstStateSpacePtr getStateSpace() const override
+  {
+    return mStateSpace;
+  }
+
+  std::size_t getNumDerivatives() const override
+  {
+    return 0;
+  }
+
+  void interpolate(
+      const StateSpace::State* from,
+      const StateSpace::State* /*to*/,
+      double /*alpha*/,
+      StateSpace::State* state) const override
+  {
+    mStateSpace->copyState(from, state);
+  }
+
+  void getDerivative(
+      const StateSpace::State* /*from*/,
+      const StateSpace::State* /*to*/,
+      std::size_t /*derivative*/,
+      double /*alpha*/,
+      Eigen::VectorXd& tangentVector) const override
+  {
+    tangentVector.setZero(mStateSpace->getDimension());
+  }
+
+private:
+  aikido::statespace::ConstStateSpacePtr mStateSpace;
+};
+
+} // namespace
+
+TEST(InterpolationContext, ThrowsOnNullInterpolator)
+{
+  EXPECT_THROW(InterpolationContext(nullptr), std::invalid_argument);
+}
+
+TEST(InterpolationContext, ThrowsWithoutEndpoints)
+{
+  auto space = std::make_shared<R3>();
+  InterpolationContext context(std::make_shared<GeodesicInterpolator>(space));
+
+  auto out = space->createState();
+  EXPECT_THROW(context.interpolate(0.5, out), std::logic_error);
+}
+
+TEST(InterpolationContext, MatchesGeodesicInterpolatorInRn)
+{
+  auto space = std::make_shared<R3>();
+  auto interpolator = std::make_shared<GeodesicInterpolator>(space);
+  InterpolationContext context(interpolator);
+
+  auto from = space->createState();
+  auto to = space->createState();
+  from.setValue(Eigen::Vector3d(1., 2., 3.));
+  to.setValue(Eigen::Vector3d(-1., 0., 5.));
+  context.setEndpoints(from, to);
+
+  auto expected = space->createState();
+  auto actual = space->createState();
+  for (double alpha : {0., 0.25, 0.5, 0.75, 1.})
+  {
+    interpolator->interpolate(from, to, alpha, expected);
+    context.interpolate(alpha, actual);
+    EXPECT_TRUE(expected.getValue().isApprox(actual.getValue()));
+  }
+}
+
+TEST(InterpolationContext, MatchesGeodesicInterpolatorInCartesianProduct)
+{
+  auto space = std::make_shared<CartesianProduct>(
+      std::vector<aikido::statespace::ConstStateSpacePtr>(
+          {std::make_shared<SO2>(), std::make_shared<R2>()}));
+  auto interpolator = std::make_shared<GeodesicInterpolator>(space);
+  InterpolationContext context(interpolator);
+
+  auto from = space->createState();
+  auto to = space->createState();
+  from.getSubStateHandle<SO2>(0).fromAngle(3.);
+  from.getSubStateHandle<R2>(1).setValue(Eigen::Vector2d(1., 2.));
+  to.getSubStateHandle<SO2>(0).fromAngle(-3.);
+  to.getSubStateHandle<R2>(1).setValue(Eigen::Vector2d(-1., 4.));
+  context.setEndpoints(from, to);
+
+  auto expected = space->createState();
+  auto actual = space->createState();
+  for (double alpha : {0., 0.25, 0.5, 0.75, 1.})
+  {
+    interpolator->interpolate(from, to, alpha, expected);
+    context.interpolate(alpha, actual);
+
+    EXPECT_DOUBLE_EQ(
+        expected.getSubStateHandle<SO2>(0).toAngle(),
+        actual.getSubStateHandle<SO2>(0).toAngle());
+    EXPECT_TRUE(expected.getSubStateHandle<R2>(1).getValue().isApprox(
+        actual.getSubStateHandle<R2>(1).getValue()));
+  }
+
+  // Endpoints can be reset without reallocating the context.
+  context.setEndpoints(to, from);
+  interpolator->interpolate(to, from, 0.5, expected);
+  context.interpolate(0.5, actual);
+  EXPECT_TRUE(expected.getSubStateHandle<R2>(1).getValue().isApprox(
+      actual.getSubStateHandle<R2>(1).getValue()));
+}
+
+TEST(InterpolationContext, MatchesGeodesicInterpolatorInUnpackedProduct)
+{
+  auto space = std::make_shared<CartesianProduct>(
+      std::vector<aikido::statespace::ConstStateSpacePtr>(
+          {std::make_shared<SE2>(), std::make_shared<R2>()}));
+  ASSERT_FALSE(space->isPacked());
+
+  auto interpolator = std::make_shared<GeodesicInterpolator>(space);
+  InterpolationContext context(interpolator);
+
+  Eigen::Isometry2d fromPose = Eigen::Isometry2d::Identity();
+  fromPose.rotate(Eigen::Rotation2Dd(0.5));
+  fromPose.translation() = Eigen::Vector2d(1., 2.);
+  Eigen::Isometry2d toPose = Eigen::Isometry2d::Identity();
+  toPose.rotate(Eigen::Rotation2Dd(-1.));
+  toPose.translation() = Eigen::Vector2d(-3., 1.);
+
+  auto from = space->createState();
+  auto to = space->createState();
+  from.getSubStateHandle<SE2>(0).setIsometry(fromPose);
+  from.getSubStateHandle<R2>(1).setValue(Eigen::Vector2d(1., 2.));
+  to.getSubStateHandle<SE2>(0).setIsometry(toPose);
+  to.getSubStateHandle<R2>(1).setValue(Eigen::Vector2d(-1., 4.));
+  context.setEndpoints(from, to);
+
+  auto expected = space->createState();
+  auto actual = space->createState();
+  for (double alpha : {0., 0.25, 0.5, 0.75, 1.})
+  {
+    interpolator->interpolate(from, to, alpha, expected);
+    context.interpolate(alpha, actual);
+
+    EXPECT_TRUE(
+        expected.getSubStateHandle<SE2>(0).getIsometry().isApprox(
+            actual.getSubStateHandle<SE2>(0).getIsometry()));
+    EXPECT_TRUE(expected.getSubStateHandle<R2>(1).getValue().isApprox(
+        actual.getSubStateHandle<R2>(1).getValue()));
+  }
+}
+
+TEST(InterpolationContext, FallsBackToInterpolator)
+{
+  auto space = std::make_shared<R3>();
+  InterpolationContext context(std::make_shared<IdentityInterpolator>(space));
+
+  auto from = space->createState();
+  auto to = space->createState();
+  from.setValue(Eigen::Vector3d(1., 2., 3.));
+  to.setValue(Eigen::Vector3d(-1., 0., 5.));
+  context.setEndpoints(from, to);
+
+  auto out = space->createState();
+  context.interpolate(0.5, out);
+  EXPECT_TRUE(from.getValue().isApprox(out.getValue()));
+}
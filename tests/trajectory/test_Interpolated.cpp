@@ -128,3 +128,122 @@ TEST_F(InterpolatedTest, ConcatenateTwoTrajectories)
   EXPECT_DOUBLE_EQ(
       traj1.getDuration() + traj2.getDuration(), newTraj->getDuration());
 }
+
+TEST_F(InterpolatedTest, EvaluateBatch)
+{
+  Eigen::VectorXd times(9);
+  times << -1., 1., 1.5, 3., 4., 7., 8., 2., 5.;
+
+  Eigen::MatrixXd positions;
+  traj->evaluateBatch(times, positions);
+  ASSERT_EQ(2, positions.rows());
+  ASSERT_EQ(times.size(), positions.cols());
+
+  Eigen::MatrixXd velocities;
+  traj->evaluateDerivativeBatch(times, 1, velocities);
+  ASSERT_EQ(2, velocities.rows());
+  ASSERT_EQ(times.size(), velocities.cols());
+
+  auto istate = rvss->createState();
+  Eigen::VectorXd velocity;
+  for (Eigen::Index i = 0; i < times.size(); ++i)
+  {
+    traj->evaluate(times[i], istate);
+    EXPECT_TRUE(rvss->getValue(istate).isApprox(positions.col(i)));
+
+    traj->evaluateDerivative(times[i], 1, velocity);
+    EXPECT_TRUE(velocity.isApprox(velocities.col(i))) << "t = " << times[i];
+  }
+
+  std::vector<aikido::statespace::StateSpace::State*> states;
+  for (Eigen::Index i = 0; i < times.size(); ++i)
+    states.emplace_back(rvss->allocateState());
+  traj->evaluateBatch(times, states);
+  for (Eigen::Index i = 0; i < times.size(); ++i)
+  {
+    EXPECT_TRUE(rvss->getValue(static_cast<const R2::State*>(states[i]))
+                    .isApprox(positions.col(i)))
+        << "t = " << times[i];
+  }
+
+  EXPECT_THROW(
+      traj->evaluateBatch(times.head(2), states), std::invalid_argument);
+  for (auto batchState : states)
+    rvss->freeState(batchState);
+
+  EXPECT_THROW(
+      traj->evaluateDerivativeBatch(times, 0, velocities),
+      std::invalid_argument);
+}
+
+TEST_F(InterpolatedTest, AddWaypoint_KeepsWaypointsSorted)
+{
+  Interpolated trajectory(rvss, interpolator);
+  auto state = rvss->createState();
+
+  // Append most waypoints, but insert some out of order.
+  for (int i = 0; i < 100; ++i)
+  {
+    const double t = (i % 10 == 9) ? i - 5.5 : i;
+    rvss->setValue(state, Eigen::Vector2d(t, -t));
+    trajectory.addWaypoint(t, state);
+  }
+
+  // Copy waypoints of the trajectory into itself, which may move them.
+  for (int i = 0; i < 20; ++i)
+    trajectory.addWaypoint(200. + i, trajectory.getWaypoint(i));
+
+  ASSERT_EQ(120u, trajectory.getNumWaypoints());
+  for (std::size_t i = 0; i < trajectory.getNumWaypoints(); ++i)
+  {
+    const double t = trajectory.getWaypointTime(i);
+    if (i > 0)
+      EXPECT_LE(trajectory.getWaypointTime(i - 1), t);
+
+    const Eigen::Vector2d value = rvss->getValue(
+        static_cast<const R2::State*>(trajectory.getWaypoint(i)));
+    if (t < 200.)
+      EXPECT_TRUE(value.isApprox(Eigen::Vector2d(t, -t))) << "t = " << t;
+  }
+
+  // Waypoints copied from the start of the trajectory, in time order.
+  const Eigen::Vector2d copiedValue = rvss->getValue(
+      static_cast<const R2::State*>(trajectory.getWaypoint(100)));
+  EXPECT_TRUE(copiedValue.isApprox(Eigen::Vector2d(0., 0.)));
+}
+
+TEST_F(InterpolatedTest, ConstructFromMatrix)
+{
+  Eigen::VectorXd times(3);
+  times << 1., 3., 7.;
+  Eigen::MatrixXd positions(2, 3);
+  positions << 0., 3., 8., 0., 3., 1.;
+
+  Interpolated trajectory(rvss, interpolator, times, positions);
+  ASSERT_EQ(traj->getNumWaypoints(), trajectory.getNumWaypoints());
+
+  auto state = rvss->createState();
+  auto expectedState = rvss->createState();
+  for (double t = 0.; t < 8.; t += 0.5)
+  {
+    trajectory.evaluate(t, state);
+    traj->evaluate(t, expectedState);
+    EXPECT_TRUE(rvss->getValue(expectedState).isApprox(rvss->getValue(state)));
+  }
+
+  // More waypoints can be appended.
+  rvss->setValue(state, Eigen::Vector2d(1., 1.));
+  trajectory.addWaypoint(8., state);
+  EXPECT_DOUBLE_EQ(8., trajectory.getEndTime());
+
+  EXPECT_THROW(
+      Interpolated(rvss, interpolator, times, Eigen::MatrixXd::Zero(2, 2)),
+      std::invalid_argument);
+  EXPECT_THROW(
+      Interpolated(rvss, interpolator, times, Eigen::MatrixXd::Zero(3, 3)),
+      std::invalid_argument);
+  EXPECT_THROW(
+      Interpolated(
+          rvss, interpolator, Eigen::Vector3d(1., 0., 2.), positions),
+      std::invalid_argument);
+}
@@ -420,3 +420,111 @@ TEST_F(SplineTest, CreatePartialTrajectory)
 
   EXPECT_EQ(partialTraj->getDuration() + 1.0, trajectory.getDuration());
 }
+
+TEST_F(SplineTest, Evaluate_ManySegments_FindsSegmentInAnyOrder)
+{
+  const std::size_t numSegments = 1000;
+  const double startTime = 1.;
+  const double duration = 0.5;
+
+  Matrix2d coefficients;
+  coefficients << 0., 2., 0., 4.;
+
+  Spline trajectory(mStateSpace, startTime);
+  auto startState = mStateSpace->createState();
+  for (std::size_t i = 0; i < numSegments; ++i)
+  {
+    mStateSpace->expMap(Vector2d(i, 2. * i), startState);
+    trajectory.addSegment(coefficients, duration, startState);
+  }
+
+  EXPECT_DOUBLE_EQ(numSegments * duration, trajectory.getDuration());
+  EXPECT_DOUBLE_EQ(startTime + numSegments * duration, trajectory.getEndTime());
+  for (std::size_t i = 0; i < trajectory.getNumWaypoints(); ++i)
+    EXPECT_DOUBLE_EQ(startTime + i * duration, trajectory.getWaypointTime(i));
+
+  auto state = mStateSpace->createState();
+  Eigen::VectorXd positions;
+  auto expectValue = [&](double t) {
+    trajectory.evaluate(t, state);
+    mStateSpace->logMap(state, positions);
+    const double s = t - startTime;
+    EXPECT_TRUE(Vector2d(2. * s, 4. * s).isApprox(positions)) << "t = " << t;
+  };
+
+  // Forward, as when sampling the trajectory.
+  for (double t = startTime; t <= trajectory.getEndTime(); t += 0.01)
+    expectValue(t);
+
+  // Backward.
+  for (double t = trajectory.getEndTime(); t >= startTime; t -= 0.37)
+    expectValue(t);
+
+  // Exactly at the waypoints, in arbitrary order.
+  for (std::size_t i = 0; i < trajectory.getNumWaypoints(); i += 7)
+    expectValue(trajectory.getWaypointTime((i * 389) % numSegments));
+}
+
+TEST_F(SplineTest, EvaluateBatch_MatchesEvaluate)
+{
+  Eigen::Matrix<double, 2, 3> coefficients1;
+  coefficients1 << 0., 1., 2., 0., -1., 0.5;
+  Eigen::Matrix<double, 2, 2> coefficients2;
+  coefficients2 << 0., 3., 0., 1.;
+
+  Spline trajectory(mStateSpace, 1.);
+  trajectory.addSegment(coefficients1, 1., mStartState);
+  trajectory.addSegment(coefficients2, 2.);
+
+  Eigen::VectorXd times(10);
+  times << 0., 1., 1.25, 1.5, 2., 2.5, 3., 4., 5., 1.75;
+
+  Eigen::MatrixXd positions;
+  trajectory.evaluateBatch(times, positions);
+  ASSERT_EQ(2, positions.rows());
+  ASSERT_EQ(times.size(), positions.cols());
+
+  auto state = mStateSpace->createState();
+  Eigen::VectorXd expected;
+  for (Eigen::Index i = 0; i < times.size(); ++i)
+  {
+    trajectory.evaluate(times[i], state);
+    mStateSpace->logMap(state, expected);
+    EXPECT_TRUE(expected.isApprox(positions.col(i))) << "t = " << times[i];
+  }
+
+  std::vector<aikido::statespace::StateSpace::State*> states;
+  for (Eigen::Index i = 0; i < times.size(); ++i)
+    states.emplace_back(mStateSpace->allocateState());
+  trajectory.evaluateBatch(times, states);
+  for (Eigen::Index i = 0; i < times.size(); ++i)
+  {
+    mStateSpace->logMap(states[i], expected);
+    EXPECT_TRUE(expected.isApprox(positions.col(i))) << "t = " << times[i];
+  }
+
+  EXPECT_THROW(
+      trajectory.evaluateBatch(times.head(2), states), std::invalid_argument);
+  for (auto batchState : states)
+    mStateSpace->freeState(batchState);
+
+  for (int derivative = 1; derivative <= 3; ++derivative)
+  {
+    Eigen::MatrixXd tangentVectors;
+    trajectory.evaluateDerivativeBatch(times, derivative, tangentVectors);
+    ASSERT_EQ(2, tangentVectors.rows());
+    ASSERT_EQ(times.size(), tangentVectors.cols());
+
+    for (Eigen::Index i = 0; i < times.size(); ++i)
+    {
+      trajectory.evaluateDerivative(times[i], derivative, expected);
+      EXPECT_TRUE(expected.isApprox(tangentVectors.col(i)))
+          << "t = " << times[i] << ", derivative = " << derivative;
+    }
+  }
+
+  Eigen::MatrixXd tangentVectors;
+  EXPECT_THROW(
+      trajectory.evaluateDerivativeBatch(times, 0, tangentVectors),
+      std::logic_error);
+}